@@ -0,0 +1,117 @@
+/*!
+ * @copyright   © 2017 UFAM - Universidade Federal do Amazonas.
+ *
+ * @brief       Transporte por software (GPIO) dos quadros do Display Multiplexado - Módulo 74HC595.
+ *
+ * @file        dsf_BitBangTransport.cpp
+ * @version     1.3
+ * @date        17 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   GPIO e Módulo 74HC595 com Display 4 Dígitos.
+ *              +compiler     Kinetis® Design Studio IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão (data): Descrição breve.
+ *                             ++ 1.0 (17 Outubro 2026): Versão inicial.
+ *                             ++ 1.1 (17 Outubro 2026): Envio do bloco de quatro quadros.
+ *                             ++ 1.2 (17 Outubro 2026): Deslocamento sem desvio por bit e descida do RCLK no primeiro store.
+ *                             ++ 1.3 (17 Outubro 2026): Envio de count quadros, para a varredura de um dígito por vez.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas
+ *              +courses      Engenharia da Computação
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Versão inicial:
+ *                             ++ Patrick Chagas dos Santos <patrick.chagas@gmail.com>
+ *                             ++ Gabriel Montenegro Villacrez <gvmontenegro19@gmail.com>
+ *                             ++ Andrezza Bonfim <andrezzabonfiiim@gmail.com>
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ *              Este programa é um software livre; Você pode redistribuí-lo
+ *              e/ou modificá-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              versão 3 da licença, ou qualquer versão posterior.
+ *
+ *              Este programa é distribuído na esperança de que seja útil,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implícita de
+ *              COMERCIALIZAÇÃO OU USO PARA UM DETERMINADO PROPÓSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include <dsf_BitBangTransport.h>
+
+/*!
+ *  Seta os pinos de saída referentes ao componente DIO (dado), SCLK (desloca)
+ *  e RCLK (transfere de um registrador para o outro).
+ */
+dsf_BitBangTransport::dsf_BitBangTransport(gpio_Pin Pin_DIO, gpio_Pin Pin_SCLK,
+                                           gpio_Pin Pin_RCLK)
+    : pins(mkl_GPIOBus::gpioName(Pin_DIO),
+           mkl_GPIOBus::pinMask(Pin_DIO) | mkl_GPIOBus::pinMask(Pin_SCLK) |
+           mkl_GPIOBus::pinMask(Pin_RCLK)) {
+
+  dioMask = mkl_GPIOBus::pinMask(Pin_DIO);
+  sclkMask = mkl_GPIOBus::pinMask(Pin_SCLK);
+  rclkMask = mkl_GPIOBus::pinMask(Pin_RCLK);
+  pins.setPortMode(gpio_output);
+
+  /*!
+   *  Estado de repouso: SCLK e RCLK em '1' e DIO em '0'.
+   */
+  pins.writeBus(sclkMask | rclkMask);
+  dioLevel = 0;
+}
+
+/*!
+ *  Envia os count quadros, um após o outro.
+ */
+void dsf_BitBangTransport::sendFrames(const uint8_t *frames, uint8_t count) {
+  for (int i = 0; i < 2*count; i += 2) {
+    sendFrame(frames[i], frames[i + 1]);
+  }
+}
+
+/*!
+ *  Envia o byte dos segmentos e o de seleção do dígito e cria um pulso de
+ *  Low-High no RCLK. A descida do RCLK vai junto com a primeira borda de
+ *  descida do SCLK; o 74HC595 transfere os dados apenas na subida do RCLK.
+ */
+void dsf_BitBangTransport::sendFrame(uint8_t segments, uint8_t digit) {
+  sendByte(segments, rclkMask);
+  sendByte(digit, 0);
+  pins.setBits(rclkMask);
+}
+
+void dsf_BitBangTransport::sendByte(uint8_t data, uint32_t extraToggle) {
+  /*!
+   * Valor auxiliar
+   */
+  int t = 0;
+  for (t = 8; t >= 1; t--) {
+    /*!
+     *  Máscara do DIO sem desvio: 0 - 1 = 0xFFFFFFFF se o bit 7 for '1'.
+     */
+    uint32_t level = (0 - static_cast<uint32_t>(data >> 7)) & dioMask;
+    data <<= 1;
+
+    /*!
+     *  Borda de descida do SCLK e mudança do DIO, se necessária, no mesmo
+     *  store. O 74HC595 amostra o DIO apenas na borda de subida.
+     */
+    pins.toogleBits(sclkMask | (level ^ dioLevel) | extraToggle);
+    dioLevel = level;
+    extraToggle = 0;
+
+    /*!
+     *  Borda de subida do SCLK.
+     */
+    pins.toogleBits(sclkMask);
+  }
+}
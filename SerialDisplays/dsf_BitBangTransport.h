@@ -0,0 +1,87 @@
+/*!
+ * @copyright   © 2017 UFAM - Universidade Federal do Amazonas.
+ *
+ * @brief       Transporte por software (GPIO) dos quadros do Display Multiplexado - Módulo 74HC595.
+ *
+ * @file        dsf_BitBangTransport.h
+ * @version     1.3
+ * @date        17 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   GPIO e Módulo 74HC595 com Display 4 Dígitos.
+ *              +compiler     Kinetis® Design Studio IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão (data): Descrição breve.
+ *                             ++ 1.0 (17 Outubro 2026): Versão inicial.
+ *                             ++ 1.1 (17 Outubro 2026): Envio do bloco de quatro quadros.
+ *                             ++ 1.2 (17 Outubro 2026): Deslocamento sem desvio por bit e descida do RCLK no primeiro store.
+ *                             ++ 1.3 (17 Outubro 2026): Envio de count quadros, para a varredura de um dígito por vez.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas
+ *              +courses      Engenharia da Computação
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Versão inicial:
+ *                             ++ Patrick Chagas dos Santos <patrick.chagas@gmail.com>
+ *                             ++ Gabriel Montenegro Villacrez <gvmontenegro19@gmail.com>
+ *                             ++ Andrezza Bonfim <andrezzabonfiiim@gmail.com>
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ *              Este programa é um software livre; Você pode redistribuí-lo
+ *              e/ou modificá-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              versão 3 da licença, ou qualquer versão posterior.
+ *
+ *              Este programa é distribuído na esperança de que seja útil,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implícita de
+ *              COMERCIALIZAÇÃO OU USO PARA UM DETERMINADO PROPÓSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#ifndef DSF_BITBANGTRANSPORT_H
+#define DSF_BITBANGTRANSPORT_H
+
+#include <mkl_GPIOBus/mkl_GPIOBus.h>
+#include <dsf_DisplayTransport.h>
+#include <stdint.h>
+
+/*!
+ *  @class    dsf_BitBangTransport
+ *
+ *  @brief    Envia os quadros aos 74HC595 deslocando os bits por software.
+ *
+ *  @details  Os pinos DIO, SCLK e RCLK devem pertencer ao mesmo GPIO e são
+ *            escritos como um grupo (mkl_GPIOBus): cada bit enviado custa dois
+ *            stores no PTOR, o primeiro com a borda de descida do SCLK e a
+ *            mudança do DIO e o segundo com a borda de subida do SCLK.
+ *
+ *            O nível do DIO é calculado sem desvio (máscara a partir do bit
+ *            mais significativo) e a descida do RCLK vai no primeiro store do
+ *            quadro: cada quadro custa 33 stores.
+ *
+ *  @section  EXAMPLES USAGE
+ *
+ *             +fn dsf_BitBangTransport pins(gpio_PTC7, gpio_PTC0, gpio_PTC3);
+ *             +fn dsf_SerialDisplays disp(&pins);
+ */
+class dsf_BitBangTransport : public dsf_DisplayTransport {
+ public:
+  dsf_BitBangTransport(gpio_Pin Pin_DIO, gpio_Pin Pin_SCLK, gpio_Pin Pin_RCLK);
+  void sendFrames(const uint8_t *frames, uint8_t count);
+
+ private:
+  void sendFrame(uint8_t segments, uint8_t digit);
+  mkl_GPIOBus pins;
+  uint32_t dioMask, sclkMask, rclkMask;
+  uint32_t dioLevel;
+  void sendByte(uint8_t data, uint32_t extraToggle);
+};
+
+#endif
@@ -0,0 +1,123 @@
+/*!
+ * @copyright   © 2017 UFAM - Universidade Federal do Amazonas.
+ *
+ * @brief       Transporte por DMA dos quadros do Display Multiplexado - Módulo 74HC595.
+ *
+ * @file        dsf_DMATransport.cpp
+ * @version     1.3
+ * @date        17 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   DMA, SPI, PIT e Módulo 74HC595 com Display 4 Dígitos.
+ *              +compiler     Kinetis® Design Studio IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão (data): Descrição breve.
+ *                             ++ 1.0 (17 Outubro 2026): Versão inicial.
+ *                             ++ 1.1 (17 Outubro 2026): Envio de count quadros, para a varredura de um dígito por vez.
+ *                             ++ 1.2 (17 Outubro 2026): Requisição do SPI Tx (SPTEF) e transferências de 8 bits.
+ *                             ++ 1.3 (17 Outubro 2026): RCLK em GPIO, pulsado pela interrupção do canal do receptor ao fim de cada quadro.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas
+ *              +courses      Engenharia da Computação
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Versão inicial:
+ *                             ++ Patrick Chagas dos Santos <patrick.chagas@gmail.com>
+ *                             ++ Gabriel Montenegro Villacrez <gvmontenegro19@gmail.com>
+ *                             ++ Andrezza Bonfim <andrezzabonfiiim@gmail.com>
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ *              Este programa é um software livre; Você pode redistribuí-lo
+ *              e/ou modificá-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              versão 3 da licença, ou qualquer versão posterior.
+ *
+ *              Este programa é distribuído na esperança de que seja útil,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implícita de
+ *              COMERCIALIZAÇÃO OU USO PARA UM DETERMINADO PROPÓSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+#include <dsf_DMATransport.h>
+
+/*!
+ *  Configura o SPI com as requisições de DMA do transmissor e do receptor,
+ *  o pino do RCLK, em '1' no repouso, e os dois canais: transferências de
+ *  8 bits, uma por requisição. O canal do receptor lê o SPIx_D para um byte
+ *  descartado e interrompe ao fim do bloco. Os dois canais ficam com o DONE
+ *  e as requisições habilitadas: sem o BCR, nada é transferido.
+ */
+dsf_DMATransport::dsf_DMATransport(spi_MOSIPin Pin_DIO, spi_SCKPin Pin_SCLK,
+                                   gpio_Pin Pin_RCLK, dma_Channel txChannel,
+                                   dma_Channel rxChannel)
+    : spi(Pin_SCLK, Pin_DIO), RCLK(Pin_RCLK), txDma(txChannel),
+      rxDma(rxChannel), block(0), remaining(0), discarded(0) {
+  bool spi1 = (Pin_SCLK & spi_SPI1) != 0;
+
+  spi.setClockMode(spi_mode0);
+  spi.enableTransmitDMA();
+  spi.enableReceiveDMA();
+  RCLK.setPortMode(gpio_output);
+  RCLK.setBit();
+
+  txDma.setDestinationAddress(spi.dataRegister(), dma_8bits, false);
+  txDma.setSource(spi1 ? dma_spi1Tx : dma_spi0Tx, false);
+  txDma.enableRequests(true);
+
+  rxDma.setSourceAddress(spi.dataRegister(), dma_8bits, false);
+  rxDma.setDestinationAddress(&discarded, dma_8bits, false);
+  rxDma.setSource(spi1 ? dma_spi1Rx : dma_spi0Rx, false);
+  rxDma.enableRequests(true);
+  rxDma.enableInterruptRequests();
+}
+
+/*!
+ *  Inicia o envio dos count quadros, se o bloco anterior terminou. Uma
+ *  chamada com o bloco ainda em envio (período da varredura menor que o
+ *  envio) é ignorada.
+ */
+void dsf_DMATransport::sendFrames(const uint8_t *frames, uint8_t count) {
+  if (remaining || !count) {
+    return;
+  }
+  block = frames;
+  remaining = count;
+  armFrame();
+}
+
+/*!
+ *  Interrupção do fim do bloco do receptor: o último bit do quadro já está
+ *  nos 74HC595. Limpa o DONE, cria um pulso de Low-High no RCLK e arma o
+ *  quadro seguinte. O quadro seguinte só começa após o pulso, de modo que
+ *  as saídas nunca copiam um quadro incompleto.
+ */
+void dsf_DMATransport::handleInterrupt() {
+  rxDma.clearDone();
+  RCLK.clearBit();
+  RCLK.setBit();
+  block += 2;
+  if (--remaining) {
+    armFrame();
+  }
+}
+
+/*!
+ *  Arma os 2 bytes do quadro em "block". O BCR e o endereço são escritos
+ *  com o DONE ainda em '1', e só então o DONE é limpo: com o SPTEF em '1',
+ *  limpar o DONE com o BCR em 0 faria o canal do transmissor atender a
+ *  requisição e terminar com erro de configuração (CE). O receptor é armado
+ *  primeiro, antes do primeiro byte deslocado.
+ */
+void dsf_DMATransport::armFrame() {
+  rxDma.setByteCount(2);
+  rxDma.clearDone();
+  txDma.setSourceAddress(block, dma_8bits, true);
+  txDma.setByteCount(2);
+  txDma.clearDone();
+}
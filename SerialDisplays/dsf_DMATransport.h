@@ -0,0 +1,128 @@
+/*!
+ * @copyright   © 2017 UFAM - Universidade Federal do Amazonas.
+ *
+ * @brief       Transporte por DMA dos quadros do Display Multiplexado - Módulo 74HC595.
+ *
+ * @file        dsf_DMATransport.h
+ * @version     1.3
+ * @date        17 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   DMA, SPI, PIT e Módulo 74HC595 com Display 4 Dígitos.
+ *              +compiler     Kinetis® Design Studio IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão (data): Descrição breve.
+ *                             ++ 1.0 (17 Outubro 2026): Versão inicial.
+ *                             ++ 1.1 (17 Outubro 2026): Envio de count quadros, para a varredura de um dígito por vez.
+ *                             ++ 1.2 (17 Outubro 2026): Requisição do SPI Tx (SPTEF) e transferências de 8 bits.
+ *                             ++ 1.3 (17 Outubro 2026): RCLK em GPIO, pulsado pela interrupção do canal do receptor ao fim de cada quadro.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas
+ *              +courses      Engenharia da Computação
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Versão inicial:
+ *                             ++ Patrick Chagas dos Santos <patrick.chagas@gmail.com>
+ *                             ++ Gabriel Montenegro Villacrez <gvmontenegro19@gmail.com>
+ *                             ++ Andrezza Bonfim <andrezzabonfiiim@gmail.com>
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ *              Este programa é um software livre; Você pode redistribuí-lo
+ *              e/ou modificá-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              versão 3 da licença, ou qualquer versão posterior.
+ *
+ *              Este programa é distribuído na esperança de que seja útil,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implícita de
+ *              COMERCIALIZAÇÃO OU USO PARA UM DETERMINADO PROPÓSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+#ifndef DSF_DMATRANSPORT_H
+#define DSF_DMATRANSPORT_H
+
+#include <mkl_DMA/mkl_DMA.h>
+#include <mkl_SPI/mkl_SPI.h>
+#include <mkl_GPIOPort/mkl_GPIOPort.h>
+#include <dsf_DisplayTransport.h>
+#include <stdint.h>
+
+/*!
+ *  @class    dsf_DMATransport
+ *
+ *  @brief    Envia os quadros aos 74HC595 pelo DMA e pelo SPI, sem a CPU
+ *            esperar o deslocamento.
+ *
+ *  @details  O SCK do SPI é ligado ao SCLK e o MOSI ao DIO dos 74HC595; o
+ *            RCLK é um pino GPIO. O slave select (PCS0) não serve ao RCLK:
+ *            ele sobe ao fim de cada byte e copiaria para as saídas um
+ *            quadro deslocado pela metade.
+ *
+ *            Dois canais do DMA por quadro de 2 bytes: o do transmissor
+ *            (TXDMAE) escreve cada byte no SPIx_D quando o buffer esvazia
+ *            (SPTEF), e o do receptor (RXDMAE) descarta cada byte recebido
+ *            (SPRF). O SPRF só sobe com o último bit deslocado, de modo que
+ *            o fim do bloco do receptor marca o quadro inteiro nos 74HC595:
+ *            a interrupção DONE desse canal chama handleInterrupt, que
+ *            pulsa o RCLK e arma o quadro seguinte, se houver. A rotina
+ *            DMAn_IRQHandler do canal do receptor deve chamar
+ *            handleInterrupt.
+ *
+ *            A CPU não espera o SPI, mas não fica fora do envio: a cada
+ *            quadro, sendFrames (na interrupção da varredura) escreve o
+ *            endereço e o BCR dos dois canais, e handleInterrupt limpa o
+ *            DONE e pulsa o RCLK. São algumas dezenas de ciclos do
+ *            barramento por quadro (test_DMATransport), e não zero: sem um
+ *            RCLK gerado pelo hardware ao fim do quadro, o pulso tem de vir
+ *            da CPU.
+ *
+ *            Use a varredura de um dígito por chamada (dsf_scanOneDigit),
+ *            com o período dado por scanFrequency(): cada interrupção envia
+ *            os 2 bytes de um dígito e uma só interrupção do DMA. Uma
+ *            chamada com um bloco ainda em envio (isBusy) é ignorada.
+ *
+ *            Na FRDM-KL25Z, com o DIO em PTC7 (SPI0_MOSI), o SCLK deve ser
+ *            ligado ao PTC5 (SPI0_SCK); o RCLK pode ficar no PTC4, agora
+ *            como GPIO.
+ *
+ *  @section  EXAMPLES USAGE
+ *
+ *             +fn dsf_DMATransport dma(spi_MOSI_PTC7, spi_SCK_PTC5,
+ *                                      gpio_PTC4, dma_ch0, dma_ch1);
+ *             +fn dsf_SerialDisplays disp(&dma);
+ *             +fn disp.setScanMode(dsf_scanOneDigit);
+ *             +fn void DMA1_IRQHandler() { dma.handleInterrupt(); }
+ *             +fn void PIT_IRQHandler() { disp.updateDisplays(); ... }
+ */
+class dsf_DMATransport : public dsf_DisplayTransport {
+ public:
+  dsf_DMATransport(spi_MOSIPin Pin_DIO, spi_SCKPin Pin_SCLK,
+                   gpio_Pin Pin_RCLK, dma_Channel txChannel,
+                   dma_Channel rxChannel);
+  void sendFrames(const uint8_t *frames, uint8_t count);
+  void handleInterrupt();
+  bool isBusy() const { return remaining != 0; }
+
+ private:
+  mkl_SPI spi;
+  mkl_GPIOPort RCLK;
+  mkl_DMA txDma;
+  mkl_DMA rxDma;
+
+  /*!
+   *  Quadro em envio e número de quadros ainda não copiados para as saídas.
+   */
+  const uint8_t *block;
+  volatile uint8_t remaining;
+  uint8_t discarded;
+
+  void armFrame();
+};
+
+#endif
@@ -0,0 +1,73 @@
+/*!
+ * @copyright   © 2017 UFAM - Universidade Federal do Amazonas.
+ *
+ * @brief       Ajuste de brilho do Display Multiplexado pelo OE dos 74HC595.
+ *
+ * @file        dsf_DisplayDimmer.cpp
+ * @version     1.1
+ * @date        17 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   TPM e Módulo 74HC595 com Display 4 Dígitos.
+ *              +compiler     Kinetis® Design Studio IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão (data): Descrição breve.
+ *                             ++ 1.0 (17 Outubro 2026): Versão inicial.
+ *                             ++ 1.1 (17 Outubro 2026): Construído sobre o mkl_TPMPulseWidthModulation.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas
+ *              +courses      Engenharia da Computação
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Versão inicial:
+ *                             ++ Patrick Chagas dos Santos <patrick.chagas@gmail.com>
+ *                             ++ Gabriel Montenegro Villacrez <gvmontenegro19@gmail.com>
+ *                             ++ Andrezza Bonfim <andrezzabonfiiim@gmail.com>
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ *              Este programa é um software livre; Você pode redistribuí-lo
+ *              e/ou modificá-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              versão 3 da licença, ou qualquer versão posterior.
+ *
+ *              Este programa é distribuído na esperança de que seja útil,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implícita de
+ *              COMERCIALIZAÇÃO OU USO PARA UM DETERMINADO PROPÓSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+#include <dsf_DisplayDimmer.h>
+
+/*!
+ *  Módulo do contador: período do PWM de 255 contagens, o que dá níveis de
+ *  0 (CnV = 0) a 255 (CnV > MOD, OE sempre em '0').
+ */
+static const uint16_t kDimmerModulo = 254;
+
+/*!
+ *  Associa o objeto ao TPM e ao canal do pino OE e inicia o PWM com o
+ *  brilho máximo.
+ */
+dsf_DisplayDimmer::dsf_DisplayDimmer(tpm_Pin Pin_OE) : pwm(Pin_OE) {
+  /*!
+   *  Pulsos em '0': o pino vai a '0' no início do período e a '1' quando
+   *  CNT = CnV. O canal e o CnV são ajustados antes do contador começar.
+   */
+  pwm.enableOutput(tpm_lowTrue);
+  setBrightness(255);
+  pwm.setFrequency(tpm_div1, kDimmerModulo);
+}
+
+/*!
+ *  Ajusta o brilho de 0 (apagado) a 255 (máximo). O CnV é atualizado pelo
+ *  hardware no fim do período corrente.
+ */
+void dsf_DisplayDimmer::setBrightness(uint8_t level) {
+  pwm.setDutyCycle(level);
+}
@@ -0,0 +1,82 @@
+/*!
+ * @copyright   © 2017 UFAM - Universidade Federal do Amazonas.
+ *
+ * @brief       Ajuste de brilho do Display Multiplexado pelo OE dos 74HC595.
+ *
+ * @file        dsf_DisplayDimmer.h
+ * @version     1.2
+ * @date        17 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   TPM e Módulo 74HC595 com Display 4 Dígitos.
+ *              +compiler     Kinetis® Design Studio IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão (data): Descrição breve.
+ *                             ++ 1.0 (17 Outubro 2026): Versão inicial.
+ *                             ++ 1.1 (17 Outubro 2026): Usado pelo dsf_SerialDisplays para o brilho.
+ *                             ++ 1.2 (17 Outubro 2026): Construído sobre o mkl_TPMPulseWidthModulation.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas
+ *              +courses      Engenharia da Computação
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Versão inicial:
+ *                             ++ Patrick Chagas dos Santos <patrick.chagas@gmail.com>
+ *                             ++ Gabriel Montenegro Villacrez <gvmontenegro19@gmail.com>
+ *                             ++ Andrezza Bonfim <andrezzabonfiiim@gmail.com>
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ *              Este programa é um software livre; Você pode redistribuí-lo
+ *              e/ou modificá-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              versão 3 da licença, ou qualquer versão posterior.
+ *
+ *              Este programa é distribuído na esperança de que seja útil,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implícita de
+ *              COMERCIALIZAÇÃO OU USO PARA UM DETERMINADO PROPÓSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+#ifndef DSF_DISPLAYDIMMER_H
+#define DSF_DISPLAYDIMMER_H
+
+#include <mkl_TPMPulseWidthModulation/mkl_TPMPulseWidthModulation.h>
+#include <stdint.h>
+
+/*!
+ *  @class    dsf_DisplayDimmer
+ *
+ *  @brief    Ajusta o brilho global dos displays por PWM no pino OE.
+ *
+ *  @details  O OE (ativo em '0') dos 74HC595 é ligado a um canal do TPM,
+ *            um mkl_TPMPulseWidthModulation alinhado à borda com pulsos em
+ *            '0' (tpm_lowTrue): as saídas ficam habilitadas durante CnV
+ *            contagens de cada período de 255. O dimmer programa o período
+ *            do TPM, que não pode ter outro uso.
+ *            Com o TPM a 20,97 MHz, o PWM tem 82 kHz, muito acima da
+ *            varredura, e todos os dígitos são atenuados igualmente sem
+ *            nenhum custo de CPU. É o ajuste de brilho do
+ *            dsf_SerialDisplays (attachDimmer), que também o usa para o
+ *            brilho por dígito na varredura de um dígito por chamada.
+ *
+ *  @section  EXAMPLES USAGE
+ *
+ *             +fn dsf_DisplayDimmer dimmer(tpm_PTC2);
+ *             +fn dimmer.setBrightness(64);    // 25%
+ */
+class dsf_DisplayDimmer {
+ public:
+  explicit dsf_DisplayDimmer(tpm_Pin Pin_OE);
+  void setBrightness(uint8_t level);
+
+ private:
+  mkl_TPMPulseWidthModulation pwm;
+};
+
+#endif
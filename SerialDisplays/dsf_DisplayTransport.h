@@ -0,0 +1,83 @@
+/*!
+ * @copyright   © 2017 UFAM - Universidade Federal do Amazonas.
+ *
+ * @brief       Interface de transporte dos quadros do Display Multiplexado - Módulo 74HC595.
+ *
+ * @file        dsf_DisplayTransport.h
+ * @version     1.4
+ * @date        17 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   GPIO ou SPI e Módulo 74HC595 com Display 4 Dígitos.
+ *              +compiler     Kinetis® Design Studio IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão (data): Descrição breve.
+ *                             ++ 1.0 (17 Outubro 2026): Versão inicial.
+ *                             ++ 1.1 (17 Outubro 2026): Envio do bloco de quatro quadros.
+ *                             ++ 1.2 (17 Outubro 2026): Envio de count quadros, para a varredura de um dígito por vez.
+ *                             ++ 1.3 (17 Outubro 2026): O transporte pelo SPI também continua a ler o bloco após a chamada.
+ *                             ++ 1.4 (17 Outubro 2026): O dsf_DMATransport pulsa o RCLK na interrupção do DMA.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas
+ *              +courses      Engenharia da Computação
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Versão inicial:
+ *                             ++ Patrick Chagas dos Santos <patrick.chagas@gmail.com>
+ *                             ++ Gabriel Montenegro Villacrez <gvmontenegro19@gmail.com>
+ *                             ++ Andrezza Bonfim <andrezzabonfiiim@gmail.com>
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ *              Este programa é um software livre; Você pode redistribuí-lo
+ *              e/ou modificá-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              versão 3 da licença, ou qualquer versão posterior.
+ *
+ *              Este programa é distribuído na esperança de que seja útil,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implícita de
+ *              COMERCIALIZAÇÃO OU USO PARA UM DETERMINADO PROPÓSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#ifndef DSF_DISPLAYTRANSPORT_H
+#define DSF_DISPLAYTRANSPORT_H
+
+#include <stdint.h>
+
+/*!
+ *  @class    dsf_DisplayTransport
+ *
+ *  @brief    Interface de envio dos quadros aos registradores 74HC595.
+ *
+ *  @details  Um quadro tem 16 bits: o byte dos segmentos, enviado primeiro, e
+ *            o byte de seleção do dígito. Após o envio, o quadro é transferido
+ *            para as saídas com um pulso no RCLK.
+ *
+ *            sendFrames() recebe count quadros consecutivos de um bloco
+ *            pré-calculado, com 2 bytes por quadro: segmentos, dígito. Na
+ *            varredura completa, count = 4 (segmentos 0, dígito 0, ...,
+ *            segmentos 3, dígito 3); na de um dígito por vez, count = 1. O
+ *            bloco deve permanecer válido após a chamada, pois um transporte
+ *            por interrupção ou por DMA continua a lê-lo.
+ *
+ *            Implementações:
+ *             +fn dsf_BitBangTransport - deslocamento por software (GPIO).
+ *             +fn dsf_SPITransport - deslocamento pelo periférico SPI, um
+ *                                    byte por interrupção.
+ *             +fn dsf_DMATransport - envio pelo DMA ao SPI, sem esperar o
+ *                                    SPI; a CPU arma cada quadro e pulsa
+ *                                    o RCLK na interrupção do DMA.
+ */
+class dsf_DisplayTransport {
+ public:
+  virtual void sendFrames(const uint8_t *frames, uint8_t count) = 0;
+};
+
+#endif
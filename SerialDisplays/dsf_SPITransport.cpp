@@ -0,0 +1,97 @@
+/*!
+ * @copyright   © 2017 UFAM - Universidade Federal do Amazonas.
+ *
+ * @brief       Transporte pelo SPI dos quadros do Display Multiplexado - Módulo 74HC595.
+ *
+ * @file        dsf_SPITransport.cpp
+ * @version     1.3
+ * @date        17 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   SPI, GPIO e Módulo 74HC595 com Display 4 Dígitos.
+ *              +compiler     Kinetis® Design Studio IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão (data): Descrição breve.
+ *                             ++ 1.0 (17 Outubro 2026): Versão inicial.
+ *                             ++ 1.1 (17 Outubro 2026): Envio do bloco de quatro quadros.
+ *                             ++ 1.2 (17 Outubro 2026): Envio de count quadros, para a varredura de um dígito por vez.
+ *                             ++ 1.3 (17 Outubro 2026): Envio dos bytes pela interrupção do SPI (handleInterrupt), sem espera ativa.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas
+ *              +courses      Engenharia da Computação
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Versão inicial:
+ *                             ++ Patrick Chagas dos Santos <patrick.chagas@gmail.com>
+ *                             ++ Gabriel Montenegro Villacrez <gvmontenegro19@gmail.com>
+ *                             ++ Andrezza Bonfim <andrezzabonfiiim@gmail.com>
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ *              Este programa é um software livre; Você pode redistribuí-lo
+ *              e/ou modificá-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              versão 3 da licença, ou qualquer versão posterior.
+ *
+ *              Este programa é distribuído na esperança de que seja útil,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implícita de
+ *              COMERCIALIZAÇÃO OU USO PARA UM DETERMINADO PROPÓSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include <dsf_SPITransport.h>
+
+/*!
+ *  Configura o SPI ligado ao DIO e ao SCLK, com a interrupção do fim de cada
+ *  byte, e o pino GPIO do RCLK, que fica em '1' no repouso.
+ */
+dsf_SPITransport::dsf_SPITransport(spi_MOSIPin Pin_DIO, spi_SCKPin Pin_SCLK,
+                                   gpio_Pin Pin_RCLK)
+    : spi(Pin_SCLK, Pin_DIO), RCLK(Pin_RCLK), block(0), position(0),
+      length(0) {
+  spi.setClockMode(spi_mode0);
+  spi.enableReceiveInterrupt();
+  RCLK.setPortMode(gpio_output);
+  RCLK.setBit();
+}
+
+/*!
+ *  Inicia o envio dos count quadros, escrevendo o primeiro byte; os demais
+ *  são enviados por handleInterrupt. Ignorada se o bloco anterior ainda não
+ *  terminou.
+ */
+void dsf_SPITransport::sendFrames(const uint8_t *frames, uint8_t count) {
+  if (length || !count) {
+    return;
+  }
+  block = frames;
+  position = 0;
+  length = 2*count;
+  spi.writeData(frames[0]);
+}
+
+/*!
+ *  Rotina de serviço do SPI, ao fim do deslocamento de um byte: lê o byte
+ *  recebido (o que limpa o SPRF), cria um pulso de Low-High no RCLK após o
+ *  byte do dígito e escreve o byte seguinte do bloco.
+ */
+void dsf_SPITransport::handleInterrupt() {
+  spi.readData();
+  uint8_t sent = position + 1;
+  position = sent;
+  if (!(sent & 1)) {
+    RCLK.clearBit();
+    RCLK.setBit();
+  }
+  if (sent < length) {
+    spi.writeData(block[sent]);
+  } else {
+    length = 0;
+  }
+}
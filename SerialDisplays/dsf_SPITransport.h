@@ -0,0 +1,109 @@
+/*!
+ * @copyright   © 2017 UFAM - Universidade Federal do Amazonas.
+ *
+ * @brief       Transporte pelo SPI dos quadros do Display Multiplexado - Módulo 74HC595.
+ *
+ * @file        dsf_SPITransport.h
+ * @version     1.3
+ * @date        17 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   SPI, GPIO e Módulo 74HC595 com Display 4 Dígitos.
+ *              +compiler     Kinetis® Design Studio IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão (data): Descrição breve.
+ *                             ++ 1.0 (17 Outubro 2026): Versão inicial.
+ *                             ++ 1.1 (17 Outubro 2026): Envio do bloco de quatro quadros.
+ *                             ++ 1.2 (17 Outubro 2026): Envio de count quadros, para a varredura de um dígito por vez.
+ *                             ++ 1.3 (17 Outubro 2026): Envio dos bytes pela interrupção do SPI (handleInterrupt), sem espera ativa.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas
+ *              +courses      Engenharia da Computação
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Versão inicial:
+ *                             ++ Patrick Chagas dos Santos <patrick.chagas@gmail.com>
+ *                             ++ Gabriel Montenegro Villacrez <gvmontenegro19@gmail.com>
+ *                             ++ Andrezza Bonfim <andrezzabonfiiim@gmail.com>
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ *              Este programa é um software livre; Você pode redistribuí-lo
+ *              e/ou modificá-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              versão 3 da licença, ou qualquer versão posterior.
+ *
+ *              Este programa é distribuído na esperança de que seja útil,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implícita de
+ *              COMERCIALIZAÇÃO OU USO PARA UM DETERMINADO PROPÓSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#ifndef DSF_SPITRANSPORT_H
+#define DSF_SPITRANSPORT_H
+
+#include <mkl_SPI/mkl_SPI.h>
+#include <mkl_GPIOPort/mkl_GPIOPort.h>
+#include <dsf_DisplayTransport.h>
+#include <stdint.h>
+
+/*!
+ *  @class    dsf_SPITransport
+ *
+ *  @brief    Envia os quadros aos 74HC595 pelo periférico SPI.
+ *
+ *  @details  O SCK do SPI é ligado ao SCLK e o MOSI ao DIO dos 74HC595; o
+ *            RCLK é um pino GPIO pulsado após o deslocamento dos 16 bits.
+ *            O SPI opera no modo 0 com o baud rate máximo (clock do
+ *            barramento / 2), de modo que o quadro é deslocado pelo hardware
+ *            em 32 ciclos do barramento.
+ *
+ *            Os bytes são enviados pela interrupção do SPI, sem espera
+ *            ativa: sendFrames escreve o primeiro byte e retorna, e a cada
+ *            byte deslocado (SPRF) handleInterrupt lê o byte recebido,
+ *            pulsa o RCLK se o quadro terminou e escreve o byte seguinte.
+ *            Um byte por vez: o SPI de 8 bits não tem buffer de recepção
+ *            duplo, e um segundo byte recebido com o SPRF ainda ativo seria
+ *            perdido. A rotina SPIx_IRQHandler do SPI usado deve chamar
+ *            handleInterrupt.
+ *
+ *            O bloco deve terminar antes da chamada seguinte: uma chamada
+ *            com o envio anterior em curso (isBusy) é ignorada. Na
+ *            varredura, 8 bytes levam algumas centenas de ciclos, muito
+ *            menos que o período de qualquer scanFrequency().
+ *
+ *            Na FRDM-KL25Z, com o DIO em PTC7 (SPI0_MOSI), o SCLK deve ser
+ *            ligado ao PTC5 (SPI0_SCK).
+ *
+ *  @section  EXAMPLES USAGE
+ *
+ *             +fn dsf_SPITransport spi(spi_MOSI_PTC7, spi_SCK_PTC5, gpio_PTC3);
+ *             +fn dsf_SerialDisplays disp(&spi);
+ *             +fn void SPI0_IRQHandler() { spi.handleInterrupt(); }
+ */
+class dsf_SPITransport : public dsf_DisplayTransport {
+ public:
+  dsf_SPITransport(spi_MOSIPin Pin_DIO, spi_SCKPin Pin_SCLK, gpio_Pin Pin_RCLK);
+  void sendFrames(const uint8_t *frames, uint8_t count);
+  void handleInterrupt();
+  bool isBusy() const { return length != 0; }
+
+ private:
+  mkl_SPI spi;
+  mkl_GPIOPort RCLK;
+
+  /*!
+   *  Bloco em envio: "position" bytes já deslocados de "length".
+   */
+  const uint8_t *block;
+  volatile uint8_t position;
+  volatile uint8_t length;
+};
+
+#endif
@@ -1,276 +1,480 @@
-/*!
- * @copyright    2017 UFAM - Universidade Federal do Amazonas.
- *
- * @brief       Interface de programao de aplicaes em C++ para Display Multiplexado - Mdulo 74HC595.
- *
- * @file        dsf_SerialDisplays.cpp
- * @version     1.0
- * @date        2 Agosto 2017
- *
- * @section     HARDWARES & SOFTWARES
- *              +board        FRDM-KL25Z da NXP.
- *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+
- *              +compiler     Kinetis Design Studio IDE
- *              +peripherals  GPIO, PIT e Mdulo 74HC595 com Display 4 Dgitos.
- *              +manual       L25P80M48SF0RM, Rev.3, September 2012
- *              +revisions    Verso (data): Descrio breve.
- *                             ++ 0.9 (17 Julho 2017): Verso inicial.
- *                             ++ 1.0 (2 Agosto 2017): Generalizao dos perifricos
- *
- * @section     AUTHORS & DEVELOPERS
- *              +institution  Universidade Federal do Amazonas
- *              +courses      Engenharia Eltrica / Engenharia da Computao.
- *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
- *              +student      Verso inicial:
- *                             ++ Magno Aguiar de Carvalho <carvalhodemagno@gmail.com>
- *                             ++ Phillipp de Souza Gama Lavor <lavorphillipp@gmail.com>
- *                             ++ Jadir Campos Barbosa Junior <jadirjr96@gmail.com>
- *              +student      Revises - Nome revisor <e-mail do revisor>
- *                             ++v1.0 - Jose Luis da Silva e Silva <joseluis70123@gmail.com>
- *
- * @section     LICENSE
- *
- *              GNU General Public License (GNU GPL).
- *
- *              Este programa  um software livre; Voc pode redistribu-lo
- *              e/ou modific-lo de acordo com os termos do "GNU General Public
- *              License" como publicado pela Free Software Foundation; Seja a
- *              verso 3 da licena, ou qualquer verso posterior.
- *
- *              Este programa  distribudo na esperana de que seja til,
- *              mas SEM QUALQUER GARANTIA; Sem a garantia implcita de
- *              COMERCIALIZAO OU USO PARA UM DETERMINADO PROPSITO.
- *              Veja o site da "GNU General Public License" para mais detalhes.
- *
- * @htmlonly    http://www.gnu.org/copyleft/gpl.html
- */
-
-#include <mkl_GPIOPort/mkl_GPIOPort.h>
-#include <stdint.h>
-#include <dsf_SerialDisplays.h>
-
-// dsf_GPIO_ocp  DIO;
-
-/*!
- *  Seta o perifrico, considerando os pinos de sada referentes ao componente
- *  DIO (dado), SCLK (desloca), RCLK (transfere de um registrador para o outro)
- */
-dsf_SerialDisplays:: dsf_SerialDisplays(gpio_Pin Pin_DIO, gpio_Pin Pin_SCLK, gpio_Pin Pin_RCLK){
-
-  DIO = mkl_GPIOPort(Pin_DIO);
-  SCLK = mkl_GPIOPort(Pin_SCLK);
-  RCLK = mkl_GPIOPort(Pin_RCLK);
-  DIO.setPortMode(gpio_output);
-  SCLK.setPortMode(gpio_output);
-  RCLK.setPortMode(gpio_output);
-
-  setNibble();
-}
-
-/*!
- *  Atualiza o dado nos registradores internos.
- */
-void dsf_SerialDisplays::updateDisplays() {
-  /*!
-   *  Envia o valor do vetor storeData na posio 0 para o primeiro
-   *  display, que  referido com o binrio.
-   */
-  sendNibble(storeData[0]);
-  sendNibble(0b0001);
-
-  /*!
-   *  Cria um pulso de Low-High.
-   */
-  RCLK.writeBit(0);
-  RCLK.writeBit(1);
-
-  sendNibble(storeData[1]);
-  sendNibble(0b0010);
-  RCLK.writeBit(0);
-  RCLK.writeBit(1);
-
-  sendNibble(storeData[2]);
-  sendNibble(0b0100);
-  RCLK.writeBit(0);
-  RCLK.writeBit(1);
-
-  sendNibble(storeData[3]);
-  sendNibble(0b1000);
-  RCLK.writeBit(0);
-  RCLK.writeBit(1);
-}
-
-/*!
- *  Armazena o valor do nmero e a posio do display a ser mostrada.
- */
-void dsf_SerialDisplays::writeNibble(uint8_t bin, uint8_t number) {
-  storeData[number] = nibble[bin];
-}
-
-void dsf_SerialDisplays::writeWord(uint16_t bcd) {
-  /*!
-   *  Variveis auxiliares
-   */
-  int A = 0, B = 0, C = 0, D = 0;
-
-  /*!
-   *  Retirar a casa dos milhares.
-   */
-  A = static_cast<int>(bcd/1000);
-
-  /*!
-   *  Retirar a casa das centenas.
-   */
-  B = static_cast<int>(bcd - A*1000)/100;
-
-  /*!
-   * Retirar a casa das dezenas
-   */
-  C = static_cast<int>(bcd - A*1000 - B*100)/10;
-
-  /*!
-   *  Retirar a casa das unidades.
-   */
-  D = static_cast<int>(bcd - A*1000 - B*100 - C*10);
-
-  /*!
-   *  Armazena na posio 3 o valor nmerico de A.
-   */
-  storeData[3] = nibble[A];
-
-  /*!
-   *  Armazena na posio 2 o valor nmerico de B.
-   */
-  storeData[2] = nibble[B];
-
-  /*!
-   *  Armazena na posio 1 o valor nmerico de C.
-   */
-  storeData[1] = nibble[C];
-
-  /*!
-   *  Armazena na posio 0 o valor nmerico de D.
-   */
-  storeData[0] = nibble[D];
-}
-
-
-void dsf_SerialDisplays::clearDisplays() {
-  /*!
-   *  Varivel auxiliar.
-   */
-  int i = 0;
-  for (i=0; i <= 3; i++) {
-    /*!
-     *  Limpa o registrador de acordo com a posio "i".
-     */
-    storeData[i] = 0xFF;
-  }
-}
-
-/*!
- *  Mostra os Zeros a esquerda
- */
-void dsf_SerialDisplays::showZerosLeft() {
-  /*!
-   *  Se a posio 3 for zero o dado ser mostrado.
-   */
-  if (storeData[3] == 0xFF) {
-    /*!
-     *  Dado sendo mostrado
-     */
-    storeData[3] = 0xC0;
-    /*!
-     *  Se a posio 2 for zero o dado ser mostrado.
-     */
-    if (storeData[2] == 0xFF) {
-      /*!
-       *  Dado sendo mostrado
-       */
-      storeData[2] = 0xC0;
-
-	  /*!
-       *  Se a posio 2 for zero o dado ser mostrado.
-       */
-      if (storeData[1] == 0xFF) {
-	    /*!
-         *  Dado sendo mostrado.
-         */
-        storeData[1] = 0xC0;
-      }
-    }
-  }
-}
-
-/*!
- *  Apaga os Zeros a esquerda.
- */
-void dsf_SerialDisplays::hideZerosLeft() {
-  /*!
-   *  Se o dado na posio 3 for 0, logo ele ser apagado,
-   *  se no continua normalmente.
-   */
-  if (storeData[3] == 0xC0) {
-    /*!
-     *  Dado sendo apagado
-     */
-    storeData[3] = 0xFF;
-	/*!
-     *  Se o dado na posio 2 for 0, logo ele ser apagado,
-	 *  se no continua normalmente.
-     */
-    if (storeData[2] == 0xC0) {
-      /*!
-       *  Dado sendo apagado.
-       */
-      storeData[2] = 0xFF;
-	  /*!
-       *  Se o dado na posio 1 for 0, logo ele ser apagado,
-	   *  se no continua normalmente.
-       */
-      if (storeData[1] == 0xC0) {
-        /*!
-         *  Dado sendo apagado.
-         */
-        storeData[1] = 0xFF;
-      }
-    }
-  }
-}
-
-void dsf_SerialDisplays:: sendNibble(char digit) {
-  /*!
-   * Valor auxiliar
-   */
-  int t = 0;
-  for (t = 8; t >= 1; t--) {
-    if (digit & 0x80) {
-      DIO.writeBit(1);
-    } else {
-      DIO.writeBit(0);
-    }
-    digit <<= 1;
-    SCLK.writeBit(0);
-    SCLK.writeBit(1);
-  }
-}
-
-/*!
- *  Criao de um vetor de constantes com seus respectivos valores decodificados
- */
-void dsf_SerialDisplays::setNibble() {
-  /*!
-   *  Valores 0,1,2,3,4,5,6,7,8 e 9
-   */
-  nibble[0] = 0xC0;
-  nibble[1] = 0xF9;
-  nibble[2] = 0xA4;
-  nibble[3] = 0xB0;
-  nibble[4] = 0x99;
-  nibble[5] = 0x92;
-  nibble[6] = 0x82;
-  nibble[7] = 0xF8;
-  nibble[8] = 0x80;
-  nibble[9] = 0x90;
-}
-
+/*!
+ * @copyright   © 2017 UFAM - Universidade Federal do Amazonas.
+ *
+ * @brief       Interface de programação de aplicações em C++ para Display Multiplexado - Módulo 74HC595.
+ *
+ * @file        dsf_SerialDisplays.cpp
+ * @version     1.10
+ * @date        17 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+
+ *              +compiler     Kinetis® Design Studio IDE
+ *              +peripherals  GPIO, PIT e Módulo 74HC595 com Display 4 Dígitos.
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão (data): Descrição breve.
+ *                             ++ 0.9 (17 Julho 2017): Versão inicial.
+ *                             ++ 1.0 (2 Agosto 2017): Generalização dos periféricos
+ *                             ++ 1.1 (17 Outubro 2026): Escrita dos pinos com mkl_GPIOBus.
+ *                             ++ 1.2 (17 Outubro 2026): Transporte por GPIO ou SPI.
+ *                             ++ 1.3 (17 Outubro 2026): Bloco de quadros pré-calculado (frames).
+ *                             ++ 1.4 (17 Outubro 2026): Bloco de quadros duplo, trocado apenas após uma escrita.
+ *                             ++ 1.5 (17 Outubro 2026): writeWord sem divisões e tabela de segmentos constexpr.
+ *                             ++ 1.6 (17 Outubro 2026): Formatação: texto, sinal, ponto fixo, hexadecimal e alinhamento.
+ *                             ++ 1.7 (17 Outubro 2026): Brilho global e por dígito com sub-slots da varredura.
+ *                             ++ 1.8 (17 Outubro 2026): Varredura de um dígito por chamada (dsf_scanOneDigit) e scanFrequency.
+ *                             ++ 1.9 (17 Outubro 2026): Brilho pelo OE (dsf_DisplayDimmer), sem sub-slots na varredura.
+ *                             ++ 1.10 (17 Outubro 2026): writeWord acima de 9999 mostra "----" e writeNibble ignora valores e displays fora da faixa.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas
+ *              +courses      Engenharia Elétrica / Engenharia da Computação.
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Versão inicial:
+ *                             ++ Magno Aguiar de Carvalho <carvalhodemagno@gmail.com>
+ *                             ++ Phillipp de Souza Gama Lavor <lavorphillipp@gmail.com>
+ *                             ++ Jadir Campos Barbosa Junior <jadirjr96@gmail.com>
+ *              +student      Revisões - Nome revisor <e-mail do revisor>
+ *                             ++v1.0 - Jose Luis da Silva e Silva <joseluis70123@gmail.com>
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ *              Este programa é um software livre; Você pode redistribuí-lo
+ *              e/ou modificá-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              versão 3 da licença, ou qualquer versão posterior.
+ *
+ *              Este programa é distribuído na esperança de que seja útil,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implícita de
+ *              COMERCIALIZAÇÃO OU USO PARA UM DETERMINADO PROPÓSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include <stdint.h>
+#include <dsf_SerialDisplays.h>
+
+/*!
+ *  Tabela dos segmentos (catodo em '0') dos valores 0 a 9, em flash.
+ */
+constexpr uint8_t dsf_SerialDisplays::nibble[10];
+
+/*!
+ *  Tabela dos glifos dos caracteres ASCII de 0x20 a 0x7E, em flash.
+ */
+constexpr uint8_t dsf_SerialDisplays::glyphs[95];
+
+// dsf_GPIO_ocp  DIO;
+
+/*!
+ *  Seta o periférico, considerando o transporte dos quadros até os
+ *  registradores 74HC595.
+ */
+dsf_SerialDisplays:: dsf_SerialDisplays(dsf_DisplayTransport *transport)
+    : position(0), framesPerCall(4), front(0), dirty(false),
+      transport(transport), dimmer(0) {
+  /*!
+   *  Bytes de seleção dos dígitos, fixos nos dois blocos de quadros, e
+   *  brilho máximo.
+   */
+  for (int i = 0; i <= 3; i++) {
+    brightness[i] = 255;
+    frames[0][2*i + 1] = 1 << i;
+    frames[1][2*i + 1] = 1 << i;
+  }
+  storeFrames();
+}
+
+/*!
+ *  Atualiza o dado nos registradores internos.
+ */
+void dsf_SerialDisplays::updateDisplays() {
+  /*!
+   *  Se houve escrita desde a última varredura, o bloco de trás, já
+   *  completo, passa a ser o da frente.
+   */
+  if (dirty) {
+    front ^= 1;
+    dirty = false;
+  }
+
+  /*!
+   *  Entrega ao transporte os próximos quadros (os quatro ou um só): o
+   *  quadro i tem o valor do vetor storeData na posição i, ou 0xFF se o
+   *  display i estiver apagado, e o binário do display i. No modo de um
+   *  dígito, o dimmer recebe o brilho do dígito enviado.
+   */
+  transport->sendFrames(&frames[front][0] + position, framesPerCall);
+  if (dimmer && framesPerCall == 1) {
+    dimmer->setBrightness(brightness[position >> 1]);
+  }
+  position = (position + 2*framesPerCall) & (sizeof(frames[0]) - 1);
+}
+
+/*!
+ *  Seleciona quantos quadros cada chamada de updateDisplays() envia e
+ *  recomeça a varredura no dígito 0.
+ */
+void dsf_SerialDisplays::setScanMode(dsf_ScanMode mode) {
+  framesPerCall = (mode == dsf_scanOneDigit) ? 1 : 4;
+  position = 0;
+}
+
+/*!
+ *  Retorna a frequência de chamadas de updateDisplays(), em Hz, para que
+ *  todos os dígitos sejam mostrados refreshHz vezes por segundo no modo de
+ *  varredura atual. O brilho não altera a frequência.
+ */
+uint32_t dsf_SerialDisplays::scanFrequency(uint32_t refreshHz) {
+  return refreshHz * (4 / framesPerCall);
+}
+
+/*!
+ *  Armazena o valor do número e a posição do display a ser mostrada.
+ *
+ *  Um valor acima de 9 mostra '-' e uma posição acima de 3 é ignorada.
+ */
+void dsf_SerialDisplays::writeNibble(uint8_t bin, uint8_t number) {
+  if (number > 3) {
+    return;
+  }
+  storeData[number] = (bin > 9) ? glyph('-') : nibble[bin];
+  storeFrames();
+}
+
+/*!
+ *  Escreve um valor de 0 a 9999 nos quatro displays. Acima de 9999, mostra
+ *  "----", como writeFixed.
+ *
+ *  Os dígitos são extraídos com três divisões por 10 feitas por
+ *  multiplicação e deslocamento (divideBy10), pois o Cortex-M0+ não tem
+ *  instrução de divisão e cada "/" seria uma chamada à libgcc.
+ */
+void dsf_SerialDisplays::writeWord(uint16_t bcd) {
+  /*!
+   *  Variáveis auxiliares
+   */
+  uint32_t A = 0, B = 0, C = 0, D = 0;
+  uint32_t tens = 0, hundreds = 0;
+
+  if (bcd > 9999) {
+    writeString("----");
+    return;
+  }
+
+  /*!
+   *  Retirar a casa das unidades.
+   */
+  tens = divideBy10(bcd);
+  D = bcd - tens*10;
+
+  /*!
+   * Retirar a casa das dezenas
+   */
+  hundreds = divideBy10(tens);
+  C = tens - hundreds*10;
+
+  /*!
+   *  Retirar a casa das centenas e a dos milhares.
+   */
+  A = divideBy10(hundreds);
+  B = hundreds - A*10;
+
+  /*!
+   *  Armazena na posição 3 o valor númerico de A.
+   */
+  storeData[3] = nibble[A];
+
+  /*!
+   *  Armazena na posição 2 o valor númerico de B.
+   */
+  storeData[2] = nibble[B];
+
+  /*!
+   *  Armazena na posição 1 o valor númerico de C.
+   */
+  storeData[1] = nibble[C];
+
+  /*!
+   *  Armazena na posição 0 o valor númerico de D.
+   */
+  storeData[0] = nibble[D];
+  storeFrames();
+}
+
+
+void dsf_SerialDisplays::clearDisplays() {
+  /*!
+   *  Variável auxiliar.
+   */
+  int i = 0;
+  for (i=0; i <= 3; i++) {
+    /*!
+     *  Limpa o registrador de acordo com a posição "i".
+     */
+    storeData[i] = 0xFF;
+  }
+  storeFrames();
+}
+
+/*!
+ *  Mostra os Zeros a esquerda
+ */
+void dsf_SerialDisplays::showZerosLeft() {
+  /*!
+   *  Se a posição 3 for zero o dado será mostrado.
+   */
+  if (storeData[3] == 0xFF) {
+    /*!
+     *  Dado sendo mostrado
+     */
+    storeData[3] = 0xC0;
+    /*!
+     *  Se a posição 2 for zero o dado será mostrado.
+     */
+    if (storeData[2] == 0xFF) {
+      /*!
+       *  Dado sendo mostrado
+       */
+      storeData[2] = 0xC0;
+
+	  /*!
+       *  Se a posição 2 for zero o dado será mostrado.
+       */
+      if (storeData[1] == 0xFF) {
+	    /*!
+         *  Dado sendo mostrado.
+         */
+        storeData[1] = 0xC0;
+      }
+    }
+  }
+  storeFrames();
+}
+
+/*!
+ *  Apaga os Zeros a esquerda.
+ */
+void dsf_SerialDisplays::hideZerosLeft() {
+  /*!
+   *  Se o dado na posição 3 for 0, logo ele será apagado,
+   *  se não continua normalmente.
+   */
+  if (storeData[3] == 0xC0) {
+    /*!
+     *  Dado sendo apagado
+     */
+    storeData[3] = 0xFF;
+	/*!
+     *  Se o dado na posição 2 for 0, logo ele será apagado,
+	 *  se não continua normalmente.
+     */
+    if (storeData[2] == 0xC0) {
+      /*!
+       *  Dado sendo apagado.
+       */
+      storeData[2] = 0xFF;
+	  /*!
+       *  Se o dado na posição 1 for 0, logo ele será apagado,
+	   *  se não continua normalmente.
+       */
+      if (storeData[1] == 0xC0) {
+        /*!
+         *  Dado sendo apagado.
+         */
+        storeData[1] = 0xFF;
+      }
+    }
+  }
+  storeFrames();
+}
+
+/*!
+ *  Escreve um texto de até 4 caracteres.
+ *
+ *  Um '.' acende o ponto decimal do caractere anterior (ou de um display
+ *  apagado, no início do texto) e os caracteres além do quarto são
+ *  ignorados. Ex.: "23.5", "E-03", "OFF".
+ */
+void dsf_SerialDisplays::writeString(const char *text, dsf_Align align) {
+  /*!
+   *  Glifos do texto, da esquerda para a direita.
+   */
+  uint8_t glyphData[4];
+  uint8_t count = 0;
+
+  for (; *text; text++) {
+    if (*text == '.' && count > 0 &&
+        (glyphData[count - 1] & kDecimalPoint)) {
+      glyphData[count - 1] &= ~kDecimalPoint;
+    } else if (count < 4) {
+      glyphData[count++] = (*text == '.') ? 0xFF & ~kDecimalPoint
+                                          : glyph(*text);
+    }
+  }
+  writeGlyphs(glyphData, count, align);
+}
+
+/*!
+ *  Escreve um inteiro com sinal, de -999 a 9999.
+ */
+void dsf_SerialDisplays::writeInteger(int16_t value, dsf_Align align) {
+  writeFixed(value, 0, align);
+}
+
+/*!
+ *  Escreve um valor em ponto fixo: value / 10^decimals, com zeros até o
+ *  ponto decimal. Ex.: writeFixed(235, 1) mostra "23.5" e
+ *  writeFixed(-5, 1) mostra "-0.5".
+ *
+ *  Os dígitos são extraídos com divideBy10, sem divisões.
+ */
+void dsf_SerialDisplays::writeFixed(int16_t value, uint8_t decimals,
+                                    dsf_Align align) {
+  /*!
+   *  Glifos montados da direita para a esquerda, em glyphData[4 - count].
+   */
+  uint8_t glyphData[4];
+  uint8_t count = 0;
+  uint32_t magnitude = value < 0 ? -static_cast<int32_t>(value) : value;
+
+  do {
+    uint32_t quotient = divideBy10(magnitude);
+    if (count == 4) {
+      count = 5;
+      break;
+    }
+    glyphData[3 - count] = nibble[magnitude - quotient*10];
+    if (decimals != 0 && count == decimals) {
+      glyphData[3 - count] &= ~kDecimalPoint;
+    }
+    count++;
+    magnitude = quotient;
+  } while (magnitude != 0 || count <= decimals);
+
+  if (value < 0) {
+    if (count < 4) {
+      glyphData[3 - count] = glyph('-');
+    }
+    count++;
+  }
+
+  if (count > 4) {
+    writeString("----");
+    return;
+  }
+  writeGlyphs(glyphData + 4 - count, count, align);
+}
+
+/*!
+ *  Escreve os 4 dígitos hexadecimais do valor, com zeros à esquerda.
+ */
+void dsf_SerialDisplays::writeHex(uint16_t value) {
+  /*!
+   *  Dígitos de "0123456789AbCdEF", o A, C, E e F maiúsculos e o b e o d
+   *  minúsculos, para não confundir com o 8 e o 0.
+   */
+  static const char digits[] = "0123456789AbCdEF";
+  uint8_t glyphData[4];
+
+  for (int i = 3; i >= 0; i--) {
+    glyphData[i] = glyph(digits[value & 0xF]);
+    value >>= 4;
+  }
+  writeGlyphs(glyphData, 4, dsf_alignRight);
+}
+
+/*!
+ *  Acende ou apaga o ponto decimal do display "number", sem alterar o
+ *  caractere mostrado.
+ */
+void dsf_SerialDisplays::setDecimalPoint(uint8_t number, bool on) {
+  if (on) {
+    storeData[number] &= ~kDecimalPoint;
+  } else {
+    storeData[number] |= kDecimalPoint;
+  }
+  storeFrames();
+}
+
+/*!
+ *  Copia "count" glifos, da esquerda para a direita, para os displays,
+ *  apagando os que sobram do lado oposto ao alinhamento.
+ */
+void dsf_SerialDisplays::writeGlyphs(const uint8_t *text, uint8_t count,
+                                     dsf_Align align) {
+  /*!
+   *  Display do primeiro glifo: o 3 (esquerda) ou o que deixa o último
+   *  glifo no display 0 (direita).
+   */
+  int first = (align == dsf_alignLeft) ? 3 : count - 1;
+
+  for (int i = 0; i <= 3; i++) {
+    storeData[i] = 0xFF;
+  }
+  for (int i = 0; i < count; i++) {
+    storeData[first - i] = text[i];
+  }
+  storeFrames();
+}
+
+/*!
+ *  Liga o PWM do OE que faz o ajuste de brilho, já com o brilho do
+ *  display 0.
+ */
+void dsf_SerialDisplays::attachDimmer(dsf_DisplayDimmer *dimmer) {
+  this->dimmer = dimmer;
+  dimmer->setBrightness(brightness[0]);
+}
+
+/*!
+ *  Ajusta o brilho de todos os displays.
+ */
+void dsf_SerialDisplays::setBrightness(uint8_t level) {
+  for (int i = 0; i <= 3; i++) {
+    brightness[i] = level;
+  }
+  if (dimmer) {
+    dimmer->setBrightness(level);
+  }
+  storeFrames();
+}
+
+/*!
+ *  Ajusta o brilho do display "number"; fora do modo dsf_scanOneDigit, só
+ *  distingue o display apagado (0) do aceso.
+ */
+void dsf_SerialDisplays::setDigitBrightness(uint8_t number, uint8_t level) {
+  brightness[number] = level;
+  storeFrames();
+}
+
+/*!
+ *  Copia os segmentos de storeData para o bloco de trás, com os displays de
+ *  brilho 0 apagados, e o marca para a troca. O dirty é limpo antes da
+ *  cópia para que a interrupção não troque os blocos com a cópia pela
+ *  metade.
+ */
+void dsf_SerialDisplays::storeFrames() {
+  dirty = false;
+  __asm volatile("" ::: "memory");
+  uint8_t *back = frames[front ^ 1];
+  for (int i = 0; i <= 3; i++) {
+    back[2*i] = brightness[i] ? storeData[i] : 0xFF;
+  }
+  __asm volatile("" ::: "memory");
+  dirty = true;
+}
+
+/*!
+ *  Quociente da divisão por 10: (value * 52429) >> 19, exato para todo o
+ *  intervalo do uint16_t (o produto cabe em 32 bits até value = 81919).
+ *  O Cortex-M0+ da KL25 multiplica em 1 ciclo.
+ */
+uint32_t dsf_SerialDisplays::divideBy10(uint32_t value) {
+  return (value * 52429u) >> 19;
+}
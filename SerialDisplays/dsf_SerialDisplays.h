@@ -1,92 +1,228 @@
-/*!
- * @copyright    2017 UFAM - Universidade Federal do Amazonas.
- *
- * @brief       Interface de programao de aplicaes em C++ para Display Multiplexado - Mdulo 74HC595.
- *
- * @file        dsf_SerialDisplays.h
- * @version     1.0
- * @date        2 Agosto 2017
- *
- * @section     HARDWARES & SOFTWARES
- *              +board        FRDM-KL25Z da NXP.
- *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+
- *              +peripherals  GPIO, PIT e Mdulo 74HC595 com Display 4 Dgitos.
- *              +manual       L25P80M48SF0RM, Rev.3, September 2012
- *              +revisions    Verso (data): Descrio breve.
- *                             ++ 0.9 (17 Julho 2017): Verso inicial.
- *                             ++ 1.0 (2 Agosto 2017): Generalizao dos perifricos
- *
- * @section     AUTHORS & DEVELOPERS
- *              +institution  Universidade Federal do Amazonas
- *              +courses      Engenharia Eltrica / Engenharia da Computao.
- *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
- *              +student      Verso inicial:
- *                             ++ Magno Aguiar de Carvalho <carvalhodemagno@gmail.com>
- *                             ++ Phillipp de Souza Gama Lavor <lavorphillipp@gmail.com>
- *                             ++ Jadir Campos Barbosa Junior <jadirjr96@gmail.com>
- *              +student      Revises - Nome revisor <e-mail do revisor>
- *                             ++v1.0 - Jose Luis da Silva e Silva <joseluis70123@gmail.com>
- *
- * @section     LICENSE
- *
- *              GNU General Public License (GNU GPL).
- *
- *              Este programa  um software livre; Voc pode redistribu-lo
- *              e/ou modific-lo de acordo com os termos do "GNU General Public
- *              License" como publicado pela Free Software Foundation; Seja a
- *              verso 3 da licena, ou qualquer verso posterior.
- *
- *              Este programa  distribudo na esperana de que seja til,
- *              mas SEM QUALQUER GARANTIA; Sem a garantia implcita de
- *              COMERCIALIZAO OU USO PARA UM DETERMINADO PROPSITO.
- *              Veja o site da "GNU General Public License" para mais detalhes.
- *
- * @htmlonly    http://www.gnu.org/copyleft/gpl.html
- */
-
-#ifndef DSF_SERIALDISPLAYS_H
-#define DSF_SERIALDISPLAYS_H
-
-#include <mkl_GPIOPort/mkl_GPIOPort.h>
-#include <mkl_GPIO/mkl_GPIO.h>
-#include <stdint.h>
-
-/*!
- *  @class    dsf_MuxDisplays
- *
- *  @brief    A classe dsf_SerialDisplays representa o perifrico Off-Chip do Display Multiplexado.
- *
- *  @details  Esta classe  usada para escrita de dados no Display Multiplexado Serial.
- *
- *  @section  EXAMPLES USAGE
- *
- *
- *      Uso dos mtodos para escrita
- *        +fn dsf_SerialDisplays(OCP_t gpio, int dio, int sclk, int rclk);
- *	      +fn writeNibble(uint8_t bin, uint8_t number);
- *        +fn writeWord(uint16_t bcd)
- *	      +fn clearDisplays();
- *	      +fn showZerosLeft();
- *	      +fn hideZerosLeft();
- */
-
-class dsf_SerialDisplays {
- public:
-  dsf_SerialDisplays(gpio_Pin Pin_DIO, gpio_Pin Pin_SCLK, gpio_Pin Pin_RCLK);
-  void updateDisplays();
-  void setupPeripheral();
-  void writeNibble(uint8_t bin, uint8_t number);
-  void writeWord(uint16_t bcd);
-  void clearDisplays();
-  void showZerosLeft();
-  void hideZerosLeft();
-
- private:
-  uint8_t storeData[4];
-  uint8_t nibble[10];
-  mkl_GPIOPort DIO,SCLK, RCLK;
-  void setNibble();
-  void sendNibble(char digit);
-};
-
-#endif
+/*!
+ * @copyright   © 2017 UFAM - Universidade Federal do Amazonas.
+ *
+ * @brief       Interface de programação de aplicações em C++ para Display Multiplexado - Módulo 74HC595.
+ *
+ * @file        dsf_SerialDisplays.h
+ * @version     1.11
+ * @date        17 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+
+ *              +peripherals  GPIO, PIT e Módulo 74HC595 com Display 4 Dígitos.
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão (data): Descrição breve.
+ *                             ++ 0.9 (17 Julho 2017): Versão inicial.
+ *                             ++ 1.0 (2 Agosto 2017): Generalização dos periféricos
+ *                             ++ 1.1 (17 Outubro 2026): Escrita dos pinos com mkl_GPIOBus.
+ *                             ++ 1.2 (17 Outubro 2026): Transporte por GPIO ou SPI.
+ *                             ++ 1.3 (17 Outubro 2026): Bloco de quadros pré-calculado (frames).
+ *                             ++ 1.4 (17 Outubro 2026): Bloco de quadros duplo, trocado apenas após uma escrita.
+ *                             ++ 1.5 (17 Outubro 2026): writeWord sem divisões e tabela de segmentos constexpr.
+ *                             ++ 1.6 (17 Outubro 2026): Formatação: texto, sinal, ponto fixo, hexadecimal e alinhamento.
+ *                             ++ 1.7 (17 Outubro 2026): Brilho global e por dígito com sub-slots da varredura.
+ *                             ++ 1.8 (17 Outubro 2026): Varredura de um dígito por chamada (dsf_scanOneDigit) e scanFrequency.
+ *                             ++ 1.9 (17 Outubro 2026): Brilho pelo OE (dsf_DisplayDimmer), sem sub-slots na varredura.
+ *                             ++ 1.10 (17 Outubro 2026): O dsf_DMATransport pulsa o RCLK na interrupção do DMA.
+ *                             ++ 1.11 (17 Outubro 2026): writeWord acima de 9999 mostra "----" e writeNibble ignora valores e displays fora da faixa.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas
+ *              +courses      Engenharia Elétrica / Engenharia da Computação.
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Versão inicial:
+ *                             ++ Magno Aguiar de Carvalho <carvalhodemagno@gmail.com>
+ *                             ++ Phillipp de Souza Gama Lavor <lavorphillipp@gmail.com>
+ *                             ++ Jadir Campos Barbosa Junior <jadirjr96@gmail.com>
+ *              +student      Revisões - Nome revisor <e-mail do revisor>
+ *                             ++v1.0 - Jose Luis da Silva e Silva <joseluis70123@gmail.com>
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ *              Este programa é um software livre; Você pode redistribuí-lo
+ *              e/ou modificá-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              versão 3 da licença, ou qualquer versão posterior.
+ *
+ *              Este programa é distribuído na esperança de que seja útil,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implícita de
+ *              COMERCIALIZAÇÃO OU USO PARA UM DETERMINADO PROPÓSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#ifndef DSF_SERIALDISPLAYS_H
+#define DSF_SERIALDISPLAYS_H
+
+#include <dsf_DisplayTransport.h>
+#include <dsf_DisplayDimmer.h>
+#include <stdint.h>
+
+/*!
+ *  Alinhamento do valor nos 4 displays quando ele ocupa menos dígitos.
+ */
+typedef enum {
+  dsf_alignRight = 0,
+  dsf_alignLeft = 1
+} dsf_Align;
+
+/*!
+ *  Quadros entregues ao transporte a cada chamada de updateDisplays().
+ */
+typedef enum {
+  dsf_scanAllDigits = 0,  /*!< Os quatro dígitos. */
+  dsf_scanOneDigit = 1    /*!< Um dígito, em rodízio. */
+} dsf_ScanMode;
+
+/*!
+ *  @class    dsf_MuxDisplays
+ *
+ *  @brief    A classe dsf_SerialDisplays representa o periférico Off-Chip do Display Multiplexado.
+ *
+ *  @details  Esta classe é usada para escrita de dados no Display Multiplexado Serial.
+ *
+ *            Os quadros são enviados aos 74HC595 por um transporte
+ *            (dsf_DisplayTransport): por software, com dsf_BitBangTransport,
+ *            ou pelo periférico SPI, com dsf_SPITransport.
+ *
+ *            Os quatro quadros (segmentos e seleção de cada dígito) ficam
+ *            pré-calculados em dois blocos: os métodos de escrita reescrevem
+ *            o bloco de trás e marcam a mudança (dirty); updateDisplays() troca
+ *            os blocos apenas se houve mudança e entrega o bloco da frente ao
+ *            transporte, sem recalcular nada na interrupção. Com o
+ *            dsf_DMATransport, o DMA lê o bloco diretamente, a interrupção
+ *            só arma o envio e o RCLK é pulsado na interrupção do DMA.
+ *
+ *            O brilho, de 0 (apagado) a 255, é feito pelo PWM no OE dos
+ *            74HC595 (dsf_DisplayDimmer, ligado com attachDimmer): a
+ *            varredura não muda de frequência e o nível 0 apenas apaga o
+ *            quadro do dígito, já na escrita. Sem o dimmer, qualquer nível
+ *            diferente de 0 é o brilho máximo. O brilho por dígito é
+ *            aplicado no modo dsf_scanOneDigit, com a escrita do CnV do
+ *            dígito enviado na mesma chamada (um acesso, qualquer que seja o
+ *            brilho); o CnV é trocado no fim do período do PWM, 12 us, o que
+ *            mostra o início do dígito com o nível do anterior. No modo
+ *            dsf_scanAllDigits, só o brilho global (setBrightness) vale.
+ *
+ *            No modo dsf_scanOneDigit, cada chamada envia um único quadro e
+ *            avança para o dígito seguinte: a interrupção fica cerca de 4
+ *            vezes mais curta e cada dígito fica aceso 1/4 do tempo, em
+ *            intervalos iguais. A frequência das chamadas para uma taxa de
+ *            atualização desejada é dada por scanFrequency(), e pode ser
+ *            passada direto ao mkl_PIT::setFrequency().
+ *
+ *            A formatação (writeString, writeInteger, writeFixed e writeHex)
+ *            usa a tabela constexpr de glifos em flash, sem heap, sem printf
+ *            e sem divisões. O display 3 é o mais à esquerda. O '.' de um
+ *            texto acende o ponto decimal do caractere anterior e não ocupa
+ *            um display. Valores que não cabem nos 4 displays mostram "----".
+ *
+ *  @section  EXAMPLES USAGE
+ *
+ *
+ *      Uso dos métodos para escrita
+ *        +fn dsf_SerialDisplays(dsf_DisplayTransport *transport);
+ *	      +fn writeNibble(uint8_t bin, uint8_t number);
+ *        +fn writeWord(uint16_t bcd)
+ *	      +fn clearDisplays();
+ *	      +fn showZerosLeft();
+ *	      +fn hideZerosLeft();
+ *
+ *      Uso dos métodos de formatação
+ *        +fn writeString("OFF");
+ *        +fn writeString("E-03");
+ *        +fn writeFixed(235, 1);            // "23.5"
+ *        +fn writeInteger(-12, dsf_alignLeft);
+ *        +fn writeHex(0x1F);                // "001F"
+ *        +fn setDecimalPoint(2, true);
+ *
+ *      Uso dos métodos de brilho
+ *        +fn attachDimmer(&dimmer);         // dsf_DisplayDimmer no OE
+ *        +fn setBrightness(128);            // 50% em todos os dígitos
+ *        +fn setDigitBrightness(0, 255);    // dígito 0 com 100%
+ *
+ *      Uso da varredura de um dígito por interrupção
+ *        +fn setScanMode(dsf_scanOneDigit);
+ *        +fn pit.setFrequency(disp.scanFrequency(100));
+ */
+
+class dsf_SerialDisplays {
+ public:
+  explicit dsf_SerialDisplays(dsf_DisplayTransport *transport);
+  void updateDisplays();
+  void setupPeripheral();
+  void writeNibble(uint8_t bin, uint8_t number);
+  void writeWord(uint16_t bcd);
+  void clearDisplays();
+  void showZerosLeft();
+  void hideZerosLeft();
+
+  /*!
+   * Métodos de formatação.
+   */
+  void writeString(const char *text, dsf_Align align = dsf_alignRight);
+  void writeInteger(int16_t value, dsf_Align align = dsf_alignRight);
+  void writeFixed(int16_t value, uint8_t decimals,
+                  dsf_Align align = dsf_alignRight);
+  void writeHex(uint16_t value);
+  void setDecimalPoint(uint8_t number, bool on);
+
+  /*!
+   * Métodos de brilho, de 0 (apagado) a 255 (100%).
+   */
+  void attachDimmer(dsf_DisplayDimmer *dimmer);
+  void setBrightness(uint8_t level);
+  void setDigitBrightness(uint8_t number, uint8_t level);
+
+  /*!
+   * Métodos da varredura.
+   */
+  void setScanMode(dsf_ScanMode mode);
+  uint32_t scanFrequency(uint32_t refreshHz);
+
+  /*!
+   * Segmentos (catodo em '0', bit 7 = ponto decimal) do caractere ASCII.
+   * Os caracteres sem representação ficam apagados (0xFF).
+   */
+  static constexpr uint8_t glyph(char c) {
+    return (c >= 0x20 && c < 0x7F) ? glyphs[c - 0x20] : 0xFF;
+  }
+
+ private:
+  uint8_t storeData[4];
+  uint8_t frames[2][8] __attribute__((aligned(4)));
+  uint8_t brightness[4];
+  uint8_t position;
+  uint8_t framesPerCall;
+  volatile uint8_t front;
+  volatile bool dirty;
+  static constexpr uint8_t nibble[10] = {
+    0xC0, 0xF9, 0xA4, 0xB0, 0x99, 0x92, 0x82, 0xF8, 0x80, 0x90
+  };
+  static constexpr uint8_t glyphs[95] = {
+    0xFF, 0xFF, 0xDD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD,  //  !"#$%&'
+    0xFF, 0xFF, 0x9C, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,  // ()*+,-./
+    0xC0, 0xF9, 0xA4, 0xB0, 0x99, 0x92, 0x82, 0xF8,  // 01234567
+    0x80, 0x90, 0xFF, 0xFF, 0xFF, 0xB7, 0xFF, 0xFF,  // 89:;<=>?
+    0xFF, 0x88, 0x83, 0xC6, 0xA1, 0x86, 0x8E, 0xC2,  // @ABCDEFG
+    0x89, 0xCF, 0xE1, 0xFF, 0xC7, 0xFF, 0xC8, 0xC0,  // HIJKLMNO
+    0x8C, 0x98, 0xAF, 0x92, 0x87, 0xC1, 0xFF, 0xFF,  // PQRSTUVW
+    0xFF, 0x91, 0xA4, 0xC6, 0xFF, 0xF0, 0xFF, 0xF7,  // XYZ[ ]^_
+    0xFF, 0x88, 0x83, 0xA7, 0xA1, 0x86, 0x8E, 0xC2,  // `abcdefg
+    0x8B, 0xEF, 0xE1, 0xFF, 0xC7, 0xFF, 0xAB, 0xA3,  // hijklmno
+    0x8C, 0x98, 0xAF, 0x92, 0x87, 0xE3, 0xFF, 0xFF,  // pqrstuvw
+    0xFF, 0x91, 0xA4, 0xFF, 0xFF, 0xFF, 0xFF         // xyz{|}~
+  };
+  static const uint8_t kDecimalPoint = 0x80;
+  dsf_DisplayTransport *transport;
+  dsf_DisplayDimmer *dimmer;
+  static uint32_t divideBy10(uint32_t value);
+  void writeGlyphs(const uint8_t *text, uint8_t count, dsf_Align align);
+  void storeFrames();
+};
+
+#endif
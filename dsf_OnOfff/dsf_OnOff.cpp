@@ -1,5 +1,10 @@
 #include "dsf_OnOff.h"
 
+dsf_OnOff::dsf_OnOff()
+{
+  bit = 0;
+}
+
 void dsf_OnOff::inicializa()
 {
   bit = 0;
@@ -7,24 +12,15 @@ void dsf_OnOff::inicializa()
 
 int dsf_OnOff::consulta()
 {
-  if(onoffKey.readBit()==0)
-    bit = 1;
-  else
-    bit = 0;
-
   return bit;
 }
 
-void dsf_OnOff::onoff()
+int dsf_OnOff::onoff(bool keyPressed)
 {
-  if(onoffKey.readBit()==0)
-  {
+  if(keyPressed)
     bit = 1;
-    greenLed.writeBit(0);
-  }
   else
-  {
     bit = 0;
-    greenLed.writeBit(1);
-  }
+
+  return bit;
 }
\ No newline at end of file
@@ -1,7 +1,9 @@
-#include "mkl_GPIO/mkl_GPIO.h"
+#include <stdint.h>
 
 
 //sistema ligado para bit = 1
+//o estado segue a tecla ja filtrada (mkl_GPIOBusDebouncer), amostrada na
+//tarefa de teclado: a classe so guarda o estado
 
 class dsf_OnOff
 {
@@ -10,7 +12,7 @@ class dsf_OnOff
   public:
     void inicializa ();
     int consulta ();
-    void onoff();
+    int onoff(bool keyPressed);
     dsf_OnOff();  
 
 };
@@ -10,7 +10,7 @@
  * @section     HARDWARES & SOFTWARES
  *              +board        FRDM-KL25Z da NXP.
  *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+
- *              +Peripheral   TPM, GPIO e Led RGB.
+ *              +Peripheral   PIT, TPM, GPIO, Displays e Led RGB.
  *              +compiler     KinetisÂ® Design Studio IDE
  *              +manual       L25P80M48SF0RM, Rev.3, September 2012
  *
@@ -40,12 +40,13 @@
  * @htmlonly    http://www.gnu.org/copyleft/gpl.html
  */
 
-#include <mkl_TPMDelay/mkl_TPMDelay.h>
-#include <mkl_PIT/mkl_PIT.h>
-#include <mkl_PITDelay/mkl_PITDelay.h>
-#include <mkl_PITPeriodicInterrupt/mkl_PITPeriodicInterrupt.h>
-#include <mkl_GPIOPort/mkl_GPIOPort.h>
+#include <mkl_TimerService/mkl_TimerService.h>
+#include <mkl_Scheduler/mkl_Scheduler.h>
+#include <mkl_GPIOPin/mkl_GPIOPin.h>
+#include <mkl_GPIOBusDebouncer/mkl_GPIOBusDebouncer.h>
 #include <SerialDisplays/dsf_SerialDisplays.h>
+#include <SerialDisplays/dsf_BitBangTransport.h>
+#include <mkl_Profiler/mkl_Profiler.h>
 
 #include <stdint.h>
 
@@ -55,43 +56,85 @@
 
 
 
+/*! Sondas de tempo de execucao (mkl_Profiler::dump para ver). */
+enum {
+  probe_timerIsr = 0,
+  probe_keyTask = 1,
+  probe_displayTask = 2
+};
+
+/*! Taxa de atualizacao completa dos displays, em Hz. */
+const uint32_t kDisplayRefreshHz = 100;
+
 /*!
- *  ConfiguraÃ§Ã£o do PIT para gerar interrupÃ§Ãµes periÃ³dicas.
+ *  Resolucao da varredura dos displays: um TPM ou o canal livre do PIT.
  */
-  int setupPIT()
-  {
-	   pit.enablePeripheralModule();
-	   pit.setPeriod(0x4e20);
-	   pit.resetCounter();
-	   pit.enableTimer();
-	   pit.enableInterruptRequests();
-}
+const uint32_t kScanResolutionNs = 1000;
 
 /*!
- *  Rotina de ServiÃ§o de InterrupÃ§Ã£o (ISR) do PIT.
- *  Atualiza as informaÃ§Ãµes dos displays
+ *  Tick compartilhado (1 ms) e periodo de amostragem das teclas: o debounce
+ *  confirma uma tecla apos 4 amostras iguais (30 a 40 ms).
  */
-extern "C"
-{
-  void PIT_IRQHandler(void)
-  {
-    disp.updateDisplays();
-  }
-}
+const uint32_t kTickHz = 1000;
+constexpr std::chrono::milliseconds kKeyPoll(10);
 
 // SETUP dos pinos em uso no projeto
 
-mkl_GPIOPort blueLed(gpio_PTD1);
-mkl_GPIOPort greenLed(gpio_PTB19);
+constexpr mkl_GPIOPin<gpio_PTD1> blueLed;
+constexpr mkl_GPIOPin<gpio_PTB19> greenLed;
+
+// Grupo das quatro teclas, amostradas com um unico load do PDIR e filtradas
+// juntas por contadores verticais.
+// O PORTB nao gera interrupcao no KL25: as teclas sao amostradas pela tarefa
+// scanKeys. Teclas no PORTA ou no PORTD podem usar mkl_GPIODebouncer, que
+// so acorda a CPU nas bordas.
+
+mkl_GPIOBusDebouncer keys(gpio_GPIOB, mkl_GPIOBus::pinMask(gpio_PTB8) |
+                                      mkl_GPIOBus::pinMask(gpio_PTB9) |
+                                      mkl_GPIOBus::pinMask(gpio_PTB10) |
+                                      mkl_GPIOBus::pinMask(gpio_PTB11));
 
-mkl_GPIOPort onoffKey(gpio_PTB8);
-mkl_GPIOPort sleepKey(gpio_PTB9);
-mkl_GPIOPort decKey(gpio_PTB10);
-mkl_GPIOPort rstKey(gpio_PTB11);
+// display: DIO, SCLK e RCLK deslocados por software. Com o SCLK ligado ao
+// PTC5 (SPI0_SCK), use dsf_SPITransport(spi_MOSI_PTC7, spi_SCK_PTC5, gpio_PTC3)
+// e chame displayPins.handleInterrupt() na SPI0_IRQHandler: o SPI interrompe
+// ao fim de cada byte, sem espera ativa.
+// Com o DMA, use dsf_DMATransport(spi_MOSI_PTC7, spi_SCK_PTC5, gpio_PTC3,
+// dma_ch0, dma_ch1) e chame displayPins.handleInterrupt() na DMA1_IRQHandler:
+// o DMA escreve e descarta cada byte do digito, e a CPU so arma o quadro em
+// refreshDisplays e pulsa o RCLK ao fim do quadro.
+dsf_BitBangTransport displayPins(gpio_PTC7, gpio_PTC0, gpio_PTC3);
+dsf_SerialDisplays disp(&displayPins);
+
+// Servico de temporizadores: o PIT canal 1 e o tick compartilhado, sem tick,
+// que acorda a CPU so nos estouros; o PIT canal 0 e os TPM0 a TPM2 sao
+// entregues aos temporizadores que pedem resolucao menor que um tick.
+mkl_TimerService timers(PIT_Ch1);
+
+//Estado ligado/desligado do sistema
+dsf_OnOff standby;
+
+/*!
+ *  Tarefas do escalonador. A leitura das teclas e postada pelo temporizador
+ *  keyPollTimer; a atualizacao do display, pela leitura das teclas quando o
+ *  estado muda. Novas logicas (sleep, temperatura) entram como tarefas de
+ *  prioridade task_normal ou task_low, postadas por temporizadores ou pelas
+ *  interrupcoes.
+ */
+void scanKeys(void *context);
+void showState(void *context);
+
+mkl_Task keyTask(scanKeys, 0, task_high);
+mkl_Task displayTask(showState, 0, task_normal);
+mkl_VirtualTimer scanTimer;
+mkl_VirtualTimer keyPollTimer;
 
 void setupGPIO()
 {
- 
+  //Habilita o clock dos PORTs e seleciona o modo GPIO dos pinos.
+
+  blueLed.setupPin();
+  greenLed.setupPin();
+
   //Configura o pino para o modo saÃ­da.
   
   blueLed.setPortMode(gpio_output);
@@ -99,73 +142,126 @@ void setupGPIO()
   
   //Configura o pino para o modo entrada com resistor de pull up.
   
-  onoffKey.setPortMode(gpio_input);
-  onoffKey.setPullResistor(gpio_pullUpResistor);
+  keys.setPortMode(gpio_input);
+  keys.setPullResistor(gpio_pullUpResistor);
+}
 
-  sleepKey.setPortMode(gpio_input);
-  sleepKey.setPullResistor(gpio_pullUpResistor);
+/*!
+ *  Varredura dos displays, chamada na interrupcao do temporizador scanTimer.
+ */
+void refreshDisplays(void *)
+{
+  disp.updateDisplays();
+}
 
-  decKey.setPortMode(gpio_input);
-  decKey.setPullResistor(gpio_pullUpResistor);
+/*!
+ *  Temporizadores do sistema. O servico escolhe o periferico de cada um: a
+ *  varredura (um digito por interrupcao, 4 digitos kDisplayRefreshHz vezes
+ *  por segundo) fica em um TPM; a leitura das teclas, no tick
+ *  compartilhado.
+ */
+void setupTimers()
+{
+  timers.start(kTickHz);
 
-  rstKey.setPortMode(gpio_input);
-  rstKey.setPullResistor(gpio_pullUpResistor);
-}
+  timers.openTimer(scanTimer,
+                   1000000000ull/disp.scanFrequency(kDisplayRefreshHz),
+                   kScanResolutionNs);
+  scanTimer.setCallback(refreshDisplays, 0);
+  timers.startTimer(scanTimer);
 
-void setupTPM() {
-  tpm.setFrequency(tpm_div128);
+  timers.openTimer(keyPollTimer, kKeyPoll, std::chrono::milliseconds(1));
+  keyPollTimer.setCallback(mkl_Scheduler::postTask, &keyTask);
+  timers.startTimer(keyPollTimer);
 }
 
+/*!
+ *  Rotinas de ServiÃ§o de InterrupÃ§Ã£o (ISR) do PIT e dos TPM, todas do
+ *  servico de temporizadores: chamam as rotinas dos temporizadores que
+ *  estouraram, que atualizam os displays e postam as tarefas.
+ */
+extern "C"
+{
+  void PIT_IRQHandler(void)
+  {
+    mkl_ProfilerScope probe(probe_timerIsr);
+    timers.handlePITInterrupt();
+  }
 
-  //Inicializa a classe OnOff
-  dsf_OnOff standby;
-
-  //standby.inicializa();
+  void TPM0_IRQHandler(void)
+  {
+    mkl_ProfilerScope probe(probe_timerIsr);
+    timers.handleTPMInterrupt(tpm_TPM0);
+  }
 
+  void TPM1_IRQHandler(void)
+  {
+    mkl_ProfilerScope probe(probe_timerIsr);
+    timers.handleTPMInterrupt(tpm_TPM1);
+  }
 
-/*! . */
+  void TPM2_IRQHandler(void)
+  {
+    mkl_ProfilerScope probe(probe_timerIsr);
+    timers.handleTPMInterrupt(tpm_TPM2);
+  }
+}
 
-/*! Objeto da classe delay. */
-dsf_Delay_ocp tpm(TPM_t::dsf_TPM2);
+/*!
+ *  Tarefa de amostragem das teclas, a cada kKeyPoll (10 ms). O estado
+ *  filtrado de todas as teclas sai de uma leitura do PDIR; readPressed,
+ *  readReleased, readLongPressed e readRepeated dao os eventos.
+ */
+void scanKeys(void *)
+{
+  mkl_ProfilerScope probe(probe_keyTask);
+  keys.sample();
+  int old = standby.consulta();
+  int bit = standby.onoff((keys.readState() &
+                           mkl_GPIOBus::pinMask(gpio_PTB8)) != 0);
 
-mkl_PITInterruptInterrupt pit(PIT_Ch0);
+  //Led verde aceso (ativo em '0') com o sistema ligado.
+  greenLed.writeBit(!bit);
 
-// display
-dsf_SerialDisplays disp(gpio_PTC7, gpio_PTC0,gpio_PTC3);
+  if (bit != old) {
+    displayTask.post();
+  }
+}
 
-void setup()
+/*!
+ *  Tarefa de atualizacao do conteudo do display.
+ */
+void showState(void *)
 {
-  tpm.setFrequency(TPMDiv_t::Div128);
+  mkl_ProfilerScope probe(probe_displayTask);
+  if (standby.consulta()) {
+    //Escreve no display.
+    disp.writeWord(2222);
+  } else {
+    disp.clearDisplays();
+  }
 }
 
 int main() {
- 
-  //variaveis
-  //int bit=0;
 
   //setup do GPIO
   setupGPIO();
 
-  //setup do PIT
-  setupPIT();
-  
-  //setup do TPM
-  setupTPM();
+  //sondas de tempo de execucao
+  mkl_Profiler::start();
+  mkl_Profiler::setName(probe_timerIsr, "timer IRQHandlers");
+  mkl_Profiler::setName(probe_keyTask, "scanKeys");
+  mkl_Profiler::setName(probe_displayTask, "showState");
 
-  while (true){
-    disp.clearDisplays();
-    
-    //Debounce  - Aguarda 30 ms. 4915 ciclos
-    tpm.waitDelay(0x1333);
-    if (standby.onoff())
-    {
+  //tarefas
+  mkl_Scheduler::addTask(keyTask);
+  mkl_Scheduler::addTask(displayTask);
 
-    //Escreve no display.
-    
-    disp.writeWord(2222);
-    
-    else
-    
-  }
+  //varredura dos displays e temporizadores
+  disp.setScanMode(dsf_scanOneDigit);
+  setupTimers();
+
+  //executa as tarefas e dorme (WFI) sem trabalho
+  mkl_Scheduler::run();
   return 0;
 }
@@ -0,0 +1,247 @@
+/*!
+ * @copyright   © 2017 UFAM - Universidade Federal do Amazonas.
+ *
+ * @brief       Interface de programação de aplicações em C++ para o DMA.
+ *
+ * @file        mkl_DMA.cpp
+ * @version     1.0
+ * @date        17 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   DMA e DMAMUX.
+ *              +compiler     Kinetis® Design Studio IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão (data): Descrição breve.
+ *                             ++ 1.0 (17 Outubro 2026): Versão inicial.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas
+ *              +courses      Engenharia da Computação
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Versão inicial:
+ *                             ++ Patrick Chagas dos Santos <patrick.chagas@gmail.com>
+ *                             ++ Gabriel Montenegro Villacrez <gvmontenegro19@gmail.com>
+ *                             ++ Andrezza Bonfim <andrezzabonfiiim@gmail.com>
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ *              Este programa é um software livre; Você pode redistribuí-lo
+ *              e/ou modificá-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              versão 3 da licença, ou qualquer versão posterior.
+ *
+ *              Este programa é distribuído na esperança de que seja útil,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implícita de
+ *              COMERCIALIZAÇÃO OU USO PARA UM DETERMINADO PROPÓSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+#include "mkl_DMA.h"
+
+/*!
+ *   @fn         mkl_DMA
+ *
+ *   @brief      Construtor padrão da classe.
+ *
+ *   O construtor associa o objeto ao canal, habilita o clock do DMA e do
+ *   DMAMUX e deixa o canal parado, sem fonte de requisição e sem status.
+ *
+ *   @param[in]  channel - canal do DMA e do DMAMUX.
+ *
+ *   @remarks    Siglas e páginas do Manual de Referência KL25:
+ *               - DMA_DCRn: DMA Control Register. Pág. 358.
+ *               - DMAMUX0_CHCFGn: Channel Configuration Register. Pág. 330.
+ */
+mkl_DMA::mkl_DMA(dma_Channel channel) {
+  enablePeripheralClock();
+  bindChannel(channel);
+
+  *addressDMAMUXCHCFGn = 0;
+  *addressDMADCRn = 0;
+  *addressDMADSR_BCRn = DMA_DSR_BCR_DONE_MASK;
+}
+
+/*!
+ *   @fn         setSource
+ *
+ *   @brief      Seleciona a fonte de requisição no DMAMUX e habilita o canal.
+ *
+ *   @param[in]  source - fonte das requisições.
+ *               periodicTrigger - libera uma requisição por período do canal
+ *               de mesmo número do PIT (apenas nos canais 0 e 1).
+ *
+ *   @remarks    Siglas e páginas do Manual de Referência KL25:
+ *               - DMAMUX0_CHCFGn: Channel Configuration Register. Pág. 330.
+ */
+void mkl_DMA::setSource(dma_Source source, bool periodicTrigger) {
+  *addressDMAMUXCHCFGn = 0;
+  *addressDMAMUXCHCFGn = DMAMUX_CHCFG_ENBL_MASK |
+                         (periodicTrigger ? DMAMUX_CHCFG_TRIG_MASK : 0) |
+                         DMAMUX_CHCFG_SOURCE(source);
+}
+
+/*!
+ *   @fn         setSourceAddress
+ *
+ *   @brief      Ajusta o endereço, o tamanho e o incremento das leituras.
+ *
+ *   @remarks    Siglas e páginas do Manual de Referência KL25:
+ *               - DMA_SARn: Source Address Register. Pág. 355.
+ *               - DMA_DCRn: DMA Control Register. Pág. 358.
+ */
+void mkl_DMA::setSourceAddress(const volatile void *address, dma_Size size,
+                               bool increment) {
+  *addressDMASARn = (uint32_t)(uintptr_t)address;
+  *addressDMADCRn = (*addressDMADCRn &
+                     ~(DMA_DCR_SSIZE_MASK | DMA_DCR_SINC_MASK)) |
+                    DMA_DCR_SSIZE(size) | (increment ? DMA_DCR_SINC_MASK : 0);
+}
+
+/*!
+ *   @fn         setDestinationAddress
+ *
+ *   @brief      Ajusta o endereço, o tamanho e o incremento das escritas.
+ *
+ *   @remarks    Siglas e páginas do Manual de Referência KL25:
+ *               - DMA_DARn: Destination Address Register. Pág. 356.
+ *               - DMA_DCRn: DMA Control Register. Pág. 358.
+ */
+void mkl_DMA::setDestinationAddress(volatile void *address, dma_Size size,
+                                    bool increment) {
+  *addressDMADARn = (uint32_t)(uintptr_t)address;
+  *addressDMADCRn = (*addressDMADCRn &
+                     ~(DMA_DCR_DSIZE_MASK | DMA_DCR_DINC_MASK)) |
+                    DMA_DCR_DSIZE(size) | (increment ? DMA_DCR_DINC_MASK : 0);
+}
+
+/*!
+ *   @fn         setByteCount
+ *
+ *   @brief      Ajusta o número de bytes do bloco (BCR).
+ *
+ *   @remarks    Siglas e páginas do Manual de Referência KL25:
+ *               - DMA_DSR_BCRn: DMA Status Register / Byte Count Register.
+ *                 Pág. 356.
+ */
+void mkl_DMA::setByteCount(uint32_t bytes) {
+  *addressDMADSR_BCRn = DMA_DSR_BCR_BCR(bytes);
+}
+
+/*!
+ *   @fn         enableRequests
+ *
+ *   @brief      Habilita o atendimento das requisições do periférico (ERQ).
+ *
+ *   @param[in]  cycleSteal - uma transferência por requisição; se falso,
+ *               cada requisição transfere o bloco inteiro.
+ */
+void mkl_DMA::enableRequests(bool cycleSteal) {
+  *addressDMADCRn = (*addressDMADCRn & ~DMA_DCR_CS_MASK) | DMA_DCR_ERQ_MASK |
+                    (cycleSteal ? DMA_DCR_CS_MASK : 0);
+}
+
+/*!
+ *   @fn         disableRequests
+ *
+ *   @brief      Desabilita o atendimento das requisições do periférico.
+ */
+void mkl_DMA::disableRequests() {
+  *addressDMADCRn &= ~DMA_DCR_ERQ_MASK;
+}
+
+/*!
+ *   @fn         enableInterruptRequests
+ *
+ *   @brief      Habilita a interrupção ao fim do bloco (DONE) e no NVIC.
+ */
+void mkl_DMA::enableInterruptRequests() {
+  *addressDMADCRn |= DMA_DCR_EINT_MASK;
+  NVIC_EnableIRQ((IRQn_Type)(DMA0_IRQn + channelNumber));
+}
+
+/*!
+ *   @fn         disableInterruptRequests
+ *
+ *   @brief      Desabilita a interrupção ao fim do bloco.
+ */
+void mkl_DMA::disableInterruptRequests() {
+  *addressDMADCRn &= ~DMA_DCR_EINT_MASK;
+}
+
+/*!
+ *   @fn         startTransfer
+ *
+ *   @brief      Inicia uma transferência por software (START).
+ */
+void mkl_DMA::startTransfer() {
+  *addressDMADCRn |= DMA_DCR_START_MASK;
+}
+
+/*!
+ *   @fn         isDone
+ *
+ *   @brief      Verifica se o bloco terminou (BCR = 0) ou foi abortado por
+ *               erro.
+ */
+bool mkl_DMA::isDone() {
+  return (*addressDMADSR_BCRn & DMA_DSR_BCR_DONE_MASK) != 0;
+}
+
+/*!
+ *   @fn         clearDone
+ *
+ *   @brief      Limpa o DONE e os bits de erro do canal.
+ *
+ *   Escrever '1' no DONE limpa todo o status do canal, o que também remove a
+ *   requisição de interrupção.
+ */
+void mkl_DMA::clearDone() {
+  *addressDMADSR_BCRn = DMA_DSR_BCR_DONE_MASK;
+}
+
+/*!
+ *   @fn         readByteCount
+ *
+ *   @brief      Lê o número de bytes restantes do bloco.
+ */
+uint32_t mkl_DMA::readByteCount() {
+  return *addressDMADSR_BCRn & DMA_DSR_BCR_BCR_MASK;
+}
+
+/*!
+ *   @fn         bindChannel
+ *
+ *   @brief      Associa o objeto de software ao canal do DMA e do DMAMUX.
+ *
+ *   SAR0 = 0x40008100 + 0x10*channel e CHCFG0 = 0x40021000 + channel.
+ */
+void mkl_DMA::bindChannel(dma_Channel channel) {
+  uint32_t baseAddress = DMA_BASE + 0x100 + 0x10*channel;
+
+  channelNumber = channel;
+
+  addressDMASARn = (volatile uint32_t *)(baseAddress + 0x0);
+  addressDMADARn = (volatile uint32_t *)(baseAddress + 0x4);
+  addressDMADSR_BCRn = (volatile uint32_t *)(baseAddress + 0x8);
+  addressDMADCRn = (volatile uint32_t *)(baseAddress + 0xC);
+  addressDMAMUXCHCFGn = (volatile uint8_t *)(DMAMUX0_BASE + channel);
+}
+
+/*!
+ *   @fn         enablePeripheralClock
+ *
+ *   @brief      Habilita o clock do DMA e do DMAMUX.
+ *
+ *   @remarks    Siglas e páginas do Manual de Referência KL25:
+ *               - SIM_SCGC6: System Clock Gating Control Register 6. Pág. 207.
+ *               - SIM_SCGC7: System Clock Gating Control Register 7. Pág. 209.
+ */
+void mkl_DMA::enablePeripheralClock() {
+  SIM_SCGC6 |= SIM_SCGC6_DMAMUX_MASK;
+  SIM_SCGC7 |= SIM_SCGC7_DMA_MASK;
+}
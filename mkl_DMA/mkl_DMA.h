@@ -0,0 +1,164 @@
+/*!
+ * @copyright   © 2017 UFAM - Universidade Federal do Amazonas.
+ *
+ * @brief       Interface de programação de aplicações em C++ para o DMA.
+ *
+ * @file        mkl_DMA.h
+ * @version     1.0
+ * @date        17 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   DMA e DMAMUX.
+ *              +compiler     Kinetis® Design Studio IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão (data): Descrição breve.
+ *                             ++ 1.0 (17 Outubro 2026): Versão inicial.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas
+ *              +courses      Engenharia da Computação
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Versão inicial:
+ *                             ++ Patrick Chagas dos Santos <patrick.chagas@gmail.com>
+ *                             ++ Gabriel Montenegro Villacrez <gvmontenegro19@gmail.com>
+ *                             ++ Andrezza Bonfim <andrezzabonfiiim@gmail.com>
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ *              Este programa é um software livre; Você pode redistribuí-lo
+ *              e/ou modificá-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              versão 3 da licença, ou qualquer versão posterior.
+ *
+ *              Este programa é distribuído na esperança de que seja útil,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implícita de
+ *              COMERCIALIZAÇÃO OU USO PARA UM DETERMINADO PROPÓSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+#ifndef MKL_DMA_H_
+#define MKL_DMA_H_
+
+#include <MKL25Z4.h>
+#include <stdint.h>
+
+/*!
+ * Enum associado aos canais do DMA.
+ */
+typedef enum {
+  dma_ch0 = 0,
+  dma_ch1 = 1,
+  dma_ch2 = 2,
+  dma_ch3 = 3
+}dma_Channel;
+
+/*!
+ * Enum associado às fontes de requisição do DMAMUX.
+ */
+typedef enum {
+  dma_spi0Rx = 16,
+  dma_spi0Tx = 17,
+  dma_spi1Rx = 18,
+  dma_spi1Tx = 19,
+  dma_tpm0Overflow = 54,
+  dma_tpm1Overflow = 55,
+  dma_tpm2Overflow = 56,
+  dma_alwaysEnabled0 = 60,
+  dma_alwaysEnabled1 = 61,
+  dma_alwaysEnabled2 = 62,
+  dma_alwaysEnabled3 = 63
+}dma_Source;
+
+/*!
+ * Enum associado ao tamanho de cada acesso (SSIZE e DSIZE).
+ */
+typedef enum {
+  dma_32bits = 0,
+  dma_8bits = 1,
+  dma_16bits = 2
+}dma_Size;
+
+/*!
+ *  @class    mkl_DMA
+ *
+ *  @brief    A classe implementa um canal do controlador de DMA.
+ *
+ *  @details  Esta classe usa um dos 4 canais do DMA e o canal de mesmo número
+ *            do DMAMUX, que seleciona a fonte das requisições. Cada
+ *            requisição atendida faz uma transferência (cycle steal) ou todas
+ *            até o contador de bytes (BCR) chegar a zero. Ao fim, o bit DONE
+ *            é setado e, se habilitada, gera a interrupção DMAn.
+ *
+ *            Nos canais 0 e 1, o modo de disparo periódico do DMAMUX libera
+ *            uma requisição a cada período do canal de mesmo número do PIT.
+ *
+ *  @section  EXAMPLES USAGE
+ *
+ *            Declaração e configuração.
+ *             +fn mkl_DMA dma(dma_ch0);
+ *             +fn dma.setSource(dma_alwaysEnabled0, true);
+ *             +fn dma.setSourceAddress(buffer, dma_16bits, true);
+ *             +fn dma.setDestinationAddress(&SPI0->D, dma_8bits, false);
+ *             +fn dma.setByteCount(8);
+ *             +fn dma.enableRequests(true);
+ *
+ *            Reinício ao fim do bloco.
+ *             +fn if (dma.isDone()) { dma.clearDone(); dma.setByteCount(8); }
+ */
+class mkl_DMA {
+ public:
+  /*!
+   * Construtor padrão da classe.
+   */
+  explicit mkl_DMA(dma_Channel channel);
+
+  /*!
+   * Métodos de configuração do canal.
+   */
+  void setSource(dma_Source source, bool periodicTrigger);
+  void setSourceAddress(const volatile void *address, dma_Size size,
+                        bool increment);
+  void setDestinationAddress(volatile void *address, dma_Size size,
+                             bool increment);
+  void setByteCount(uint32_t bytes);
+
+  /*!
+   * Métodos de controle das requisições e da interrupção.
+   */
+  void enableRequests(bool cycleSteal);
+  void disableRequests();
+  void enableInterruptRequests();
+  void disableInterruptRequests();
+  void startTransfer();
+
+  /*!
+   * Métodos de estado.
+   */
+  bool isDone();
+  void clearDone();
+  uint32_t readByteCount();
+
+ protected:
+  /*!
+   * Endereços dos registradores associados ao canal.
+   */
+  volatile uint32_t *addressDMASARn;
+  volatile uint32_t *addressDMADARn;
+  volatile uint32_t *addressDMADSR_BCRn;
+  volatile uint32_t *addressDMADCRn;
+  volatile uint8_t *addressDMAMUXCHCFGn;
+  uint8_t channelNumber;
+
+  /*!
+   * Métodos de inicialização do periférico.
+   */
+  void bindChannel(dma_Channel channel);
+  void enablePeripheralClock();
+};
+
+#endif  //  MKL_DMA_H_
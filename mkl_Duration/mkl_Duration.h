@@ -0,0 +1,110 @@
+/*!
+ * @copyright   © 2017 UFAM - Universidade Federal do Amazonas.
+ *
+ * @brief       Conversão, em tempo de compilação, de durações do std::chrono em contagens de relógio.
+ *
+ * @file        mkl_Duration.h
+ * @version     1.0
+ * @date        17 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   Nenhum (cálculo para o PIT e o TPM).
+ *              +compiler     Kinetis® Design Studio IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão (data): Descrição breve.
+ *                             ++ 1.0 (17 Outubro 2026): Versão inicial.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas
+ *              +courses      Engenharia da Computação
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Versão inicial:
+ *                             ++ Patrick Chagas dos Santos <patrick.chagas@gmail.com>
+ *                             ++ Gabriel Montenegro Villacrez <gvmontenegro19@gmail.com>
+ *                             ++ Andrezza Bonfim <andrezzabonfiiim@gmail.com>
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ *              Este programa é um software livre; Você pode redistribuí-lo
+ *              e/ou modificá-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              versão 3 da licença, ou qualquer versão posterior.
+ *
+ *              Este programa é distribuído na esperança de que seja útil,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implícita de
+ *              COMERCIALIZAÇÃO OU USO PARA UM DETERMINADO PROPÓSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#ifndef MKL_DURATION_H_
+#define MKL_DURATION_H_
+
+#include <stdint.h>
+#include <chrono>
+
+/*!
+ *  @class    mkl_Duration
+ *
+ *  @brief    Funções constexpr que convertem uma duração do std::chrono no
+ *            número de contagens de um relógio, e de volta em nanossegundos.
+ *
+ *  @details  É a base de mkl_TPMTiming e mkl_PITTiming. As contas usam a
+ *            razão da própria duração (Period::num/Period::den), sem passar
+ *            por nanossegundos: std::chrono::milliseconds(30) a 20,97 MHz é
+ *            30*20971520/1000, arredondado para o inteiro mais próximo.
+ *
+ *            Com o resultado guardado em uma variável constexpr, as divisões
+ *            são feitas pelo compilador; no código executado ficam só as
+ *            escritas nos registradores.
+ *
+ *            fits() limita a contagem da duração para que o produto
+ *            count*num*clock caiba em 64 bits; durações maiores são tratadas
+ *            como fora do alcance pelas classes que usam estas funções.
+ */
+class mkl_Duration {
+ public:
+  template <class Rep, class Period>
+  static constexpr bool fits(std::chrono::duration<Rep, Period> d,
+                             uint32_t clockHz) {
+    return d.count() >= 0 &&
+           (uint64_t)d.count() <= UINT64_MAX/((uint64_t)Period::num*clockHz);
+  }
+
+  /*!
+   *  Contagens do relógio clockHz/2^shift na duração d, arredondadas.
+   */
+  template <class Rep, class Period>
+  static constexpr uint64_t ticks(std::chrono::duration<Rep, Period> d,
+                                  uint32_t clockHz, uint8_t shift) {
+    return roundDiv((uint64_t)d.count()*(uint64_t)Period::num*clockHz,
+                    (uint64_t)Period::den << shift);
+  }
+
+  template <class Rep, class Period>
+  static constexpr int64_t nanoseconds(std::chrono::duration<Rep, Period> d) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(d).count();
+  }
+
+  /*!
+   *  Duração, em nanossegundos, de "ticks" contagens do relógio
+   *  clockHz/2^shift.
+   */
+  static constexpr int64_t ticksToNanoseconds(uint64_t ticks,
+                                              uint32_t clockHz,
+                                              uint8_t shift) {
+    return (int64_t)roundDiv((ticks << shift)*1000000000ull, clockHz);
+  }
+
+  static constexpr uint64_t roundDiv(uint64_t numerator,
+                                     uint64_t denominator) {
+    return (numerator + denominator/2)/denominator;
+  }
+};
+
+#endif  //  MKL_DURATION_H_
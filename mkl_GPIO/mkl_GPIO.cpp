@@ -1,255 +1,471 @@
-/*!
- * @copyright    2017 UFAM - Universidade Federal do Amazonas.
- *
- * @brief       Implementao da API em C++ da classe me GPIO.
- *
- * @file        mkl_GPIO.cpp
- * @version     1.0
- * @date        6 Julho 2017
- *
- * @section     HARDWARES & SOFTWARES
- *              +board        FRDM-KL25Z da NXP.
- *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+
- *              +compiler     Kinetis Design Studio IDE
- *              +manual       L25P80M48SF0RM, Rev.3, September 2012
- *              +revisions    Verso (data): Descrio breve.
- *                             ++ 1.0 (30 Julho 2017): Verso inicial.
- *
- * @section     AUTHORS & DEVELOPERS
- *              +institution  Universidade Federal do Amazonas
- *              +courses      Engenharia da Computao / Engenharia Eltrica
- *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
- *              +student      Verso inicial:
- *                             ++ Hamilton Nascimento <hdan_neto@hotmail.com>
- *
- * @section     LICENSE
- *
- *              GNU General Public License (GNU GPL)
- *
- *              Este programa  um software livre; Voc pode redistribu-lo
- *              e/ou modific-lo de acordo com os termos do "GNU General Public
- *              License" como publicado pela Free Software Foundation; Seja a
- *              verso 3 da licena, ou qualquer verso posterior.
- *
- *              Este programa  distribudo na esperana de que seja til,
- *              mas SEM QUALQUER GARANTIA; Sem a garantia implcita de
- *              COMERCIALIZAO OU USO PARA UM DETERMINADO PROPSITO.
- *              Veja o site da "GNU General Public License" para mais detalhes.
- *
- * @htmlonly    http://www.gnu.org/copyleft/gpl.html
- */
-
-/*!
- *   @fn         setPortMode
- *
- *   @brief      Seleciona o modo de operao de um pino.
- *
- *   Este seleciona o modo de operao (entrada ou sada) ao pino
- *   escolhido no construtor.
- *
- *   @param[in]  mode - modo de operao.
- *                      Os modos de operao disponveis so:
- *                      PortMode_t::Input para modo entrada e
- *                      PortMode_t::Output para modo sada.
- *
- *   @remarks    Sigla e pagina do Manual de Referencia KL25:
- *               - PDDR: Port Direct Input Register. Pg. 778.
- */
-
-#include "mkl_GPIO.h"
-
-void mkl_GPIO::setPortMode(gpio_PortMode mode) {
-  if (mode == gpio_input) {
-    *addressPDDR &= ~pinPort;
-  } else {
-    *addressPDDR |= pinPort;
-  }
-}
-
-/*!
- *   @fn         setPullResistor
- *
- *   @brief      Ajusta resistor de pull.
- *
- *   Este mtodo define se o pino de entrada possui resistor de pull up
- *   ou nenhum resistor ligado internamente.
- *
- *   @param[in]  pullResistor - resistor de pull up ou nenhum.
- *               pullResistor pode ser ajustado como:
- *               PullResistor_t::PullUpResistor,para resistor de pull up.
- *               PullResistor_t::PullNoneResistor,para nenhum resistor de pull.
- *
- *   @remarks    Sigla e pagina do Manual de Referencia KL25:
- *               - PortxPCRn: Pin Control Register. Pg. 183 (Mux) and 185 (Pull).
- */
-void mkl_GPIO::setPullResistor(gpio_PullResistor pull) {
-  *addressPortxPCRn &= ~(PORT_PCR_PS_MASK | PORT_PCR_PE_MASK);
-  *addressPortxPCRn |= pull;
-}
-
-/*!
- *   @fn         writeBit
- *
- *   @brief      Escreve no pino de sada.
- *
- *   Este mtodo escreve o valor do bit do parmetro "bit" no pino da
- *   porta de sada.
- *
- *   @param[in]  bit - O valor do bit a ser escrito no pino da porta de sada.
- *
- *   @remarks    Siglas e pginas do Manual de Referncia KL25:
- *               - PDOR: Port Data Output Register. Pg. 775.
- */
-void mkl_GPIO::writeBit(int bit) {
-  if (bit) {
-    *addressPDOR |= pinPort;
-  } else {
-    *addressPDOR &= ~pinPort;
-  }
-}
-
-/*!
- *   @fn       readBit
- *
- *   @brief    L o pino de entrada.
- *
- *   Este mtodo l o valor do bit presente no pino da porta de entrada.
- *
- *	 @return   O valor do bit presente no pino da porta de entrada.
- *
- *   @remarks  Siglas e pginas do Manual de Referncia KL25:
- *             - PDIR: Port Data Input Register. Pg. 777.
- */
-int mkl_GPIO::readBit() {
-  if (*addressPDIR & pinPort) {
-    return 1;
-  }
-  return 0;
-}
-
-/*!
- *   @fn       toogleBit
- *
- *   @brief    Altera o bit de sada para o seu complemento.
- *
- *   Este mtodo altera o bit de sada para o seu complemento, i.e.,
- *   se o bit atual  '0', muda para '1' e vice-versa.
- *
- *   @remarks  Siglas e pginas do Manual de Referncia KL25:
- *             - PTOR: Port Toogle Output Register.Pg.777.
- */
-void mkl_GPIO::toogleBit() {
-  *addressPTOR |= pinPort;
-}
-
-/*!
- *   @fn       bindPeripheral
- *
- *   @brief    Associa o objeto de software ao perifrico de hardware.
- *
- *   Este mtodo associa os ponteiros aos seus respectivos registradores.
- *
- *   @remarks  Siglas e pginas do Manual de Referncia KL25:
- *             - PDOR: Port Data Output Register.Pg. 775.
- *             - PDIR: Port Data Input Register.Pg. 777.
- *             - PDDR: Port Direct Input Register. Pg. 778.
- *             - PTOR: Port Toogle Output Register.Pg.777.
- *             - PortxPCRn: Pin Control Register.Pg. 183 (Mux) and 185 (Pull).
- */
-void mkl_GPIO::bindPeripheral(uint8_t GPIONumber, uint8_t pinNumber) {
-  uint32_t baseAddress;
-
-  /*!
-   * Clculo do endereo base do GPIO do parmetro "GPIOBaseAddress".
-   * Address(hexa): GPIOA=400FF014 B=400FF054 C=400FF094 D=400FF0D4 E=400FF114.
-   * GPIOBaseAddress = 0x400FF000 (Base GPIOA) + 0x40*(0,1,2,3 ou 4) (Offset).
-   *
-   */
-  baseAddress = GPIOA_BASE + (uint32_t)(0x40*GPIONumber);
-
-  /*!
-   * Clculo do endereo absoluto do PDOR para o GPIO.
-   * Address(hexa): GPIOA=400FF014 B=400FF054 C=400FF094 D=400FF0D4 E=400FF114.
-   * addressPDOR = address base (Base) + 0x00 (Offset).
-   */
-  addressPDOR = (volatile uint32_t *)(baseAddress + 0x0);
-
-  /*!
-   * Clculo do endereo absoluto do PDIR para o GPIO.
-    * Address(hexa): GPIOA=400FF014 B=400FF054 C=400FF094 D=400FF0D4 E=400FF114.
-   * addressPDIR = address base (Base) + 0x10 (Offset).
-   */
-  addressPDIR = (volatile uint32_t *)(baseAddress + 0x10);
-
-  /*!
-   * Clculo do endereo absoluto do PDDR para o GPIO.
-    * Address(hexa): GPIOA=400FF014 B=400FF054 C=400FF094 D=400FF0D4 E=400FF114.
-   * addressPDDR = address base (Base) + 0x14 (Offset).
-   */
-  addressPDDR = (volatile uint32_t *)(baseAddress + 0x14);
-
-  /*!
-   * Clculo do endereo absoluto do PTOR para o GPIO.
-   * Address(hexa): GPIOA=400FF014 B=400FF054 C=400FF094 D=400FF0D4 E=400FF114.
-   * addressPTOR = address base (Base) + 0xC (Offset).
-   */
-  addressPTOR = (volatile uint32_t *)(baseAddress + 0xC);
-
-  /*!
-   * Clculo do endereo absoluto do PCR para o GPIO.
-   * Address(hexa): GPIOA=400FF014 B=400FF054 C=400FF094 D=400FF0D4 E=400FF114.
-   * addressPortxPCRn = 0x40049000 (Base) + 0x1000*(0,1,2,3,4 ou 5)
-   *                    + 4*(0,1,2,3,4,...,30) (Offset).
-   */
-  addressPortxPCRn = (volatile uint32_t *)(0x40049000
-                       + 0x1000*GPIONumber
-                       + 4*pinNumber);
-}
-
-/*!
- *   @fn       enablePeripheralClock
- *
- *   @brief    Habilita o clock do GPIO do perifrico.
- *
- *   Este mtodo habilita o clock do GPIO selecionado atravs do registrador
- *   SIM_SCGC5.
- *
- *   @remarks  Siglas e pginas do Manual de Referncia KL25:
- *             - SIM_SCGC5:System Clock Gating Control Register.Pg. 206.
- */
-void mkl_GPIO::enableModuleClock(uint8_t GPIONumber) {
-  SIM_SCGC5 |= SIM_SCGC5_PORTA_MASK << GPIONumber;
-}
-
-/*!
- *   @fn       selectMuxAlternative
- *
- *   @brief    Seleciona o modo GPIO de operao do pino.
- *
- *   Este mtodo seleciona o modo de operao do pino atravs do registrador
- *   Portx_PCRn, utilizando a macro de configurao PORT_PCR_MUX(x), disponvel
- *   no arquivo MKL25Z4.h
- *
- *   @remarks  Siglas e pginas do Manual de Referncia KL25:
- *             - PortxPCRn: Pin Control Register.Pg. 183 (Mux) and 185 (Pull).
- */
-void mkl_GPIO::selectMuxAlternative() {
-  *addressPortxPCRn = PORT_PCR_MUX(1);
-}
-
-/*!
- *   @fn       setGPIOParameters
- *
- *   @brief    Configura os parmetros do GPIO conforme o pino.
- *
- *   Este mtodo configura os parmetros de nmero do GPIO e nmero do pino
- *   passados no construtor, permitindo as suas devidas identificaes para uso
- *   nos mtodos de bind, de configurao e de leitura/escrita da porta.
- *
- */
-void mkl_GPIO::setGPIOParameters(gpio_Pin pin, uint32_t &gpio,
-                                     uint32_t &pinNumber) {
-  pinNumber = pin & 0xFF;
-  gpio = pin >> 8;
-  pinPort = 1 << pin;
-}
+/*!
+ * @copyright   © 2017 UFAM - Universidade Federal do Amazonas.
+ *
+ * @brief       Implementação da API em C++ da classe mãe GPIO.
+ *
+ * @file        mkl_GPIO.cpp
+ * @version     1.3
+ * @date        6 Julho 2017
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+
+ *              +compiler     Kinetis® Design Studio IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão (data): Descrição breve.
+ *                             ++ 1.0 (30 Julho 2017): Versão inicial.
+ *                             ++ 1.1 (17 Outubro 2026): Escrita por PSOR/PCOR/PTOR.
+ *                             ++ 1.2 (17 Outubro 2026): Interrupção do pino (IRQC) e tabela de rotinas por pino.
+ *                             ++ 1.3 (17 Outubro 2026): writeInterruptMode e writeHandler recebem o PCR do pino.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas
+ *              +courses      Engenharia da Computação / Engenharia Elétrica
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Versão inicial:
+ *                             ++ Hamilton Nascimento <hdan_neto@hotmail.com>
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL)
+ *
+ *              Este programa é um software livre; Você pode redistribuí-lo
+ *              e/ou modificá-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              versão 3 da licença, ou qualquer versão posterior.
+ *
+ *              Este programa é distribuído na esperança de que seja útil,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implícita de
+ *              COMERCIALIZAÇÃO OU USO PARA UM DETERMINADO PROPÓSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+/*!
+ *   @fn         setPortMode
+ *
+ *   @brief      Seleciona o modo de operação de um pino.
+ *
+ *   Este seleciona o modo de operação (entrada ou saída) ao pino
+ *   escolhido no construtor.
+ *
+ *   @param[in]  mode - modo de operação.
+ *                      Os modos de operação disponíveis são:
+ *                      PortMode_t::Input para modo entrada e
+ *                      PortMode_t::Output para modo saída.
+ *
+ *   @remarks    Sigla e pagina do Manual de Referencia KL25:
+ *               - PDDR: Port Direct Input Register. Pág. 778.
+ */
+
+#include "mkl_GPIO.h"
+
+mkl_GPIOHandler mkl_GPIO::handlers[2][32];
+
+void mkl_GPIO::setPortMode(gpio_PortMode mode) {
+  if (mode == gpio_input) {
+    *addressPDDR &= ~pinPort;
+  } else {
+    *addressPDDR |= pinPort;
+  }
+}
+
+/*!
+ *   @fn         setPullResistor
+ *
+ *   @brief      Ajusta resistor de pull.
+ *
+ *   Este método define se o pino de entrada possui resistor de pull up
+ *   ou nenhum resistor ligado internamente.
+ *
+ *   @param[in]  pullResistor - resistor de pull up ou nenhum.
+ *               pullResistor pode ser ajustado como:
+ *               PullResistor_t::PullUpResistor,para resistor de pull up.
+ *               PullResistor_t::PullNoneResistor,para nenhum resistor de pull.
+ *
+ *   @remarks    Sigla e pagina do Manual de Referencia KL25:
+ *               - PortxPCRn: Pin Control Register. Pág. 183 (Mux) and 185 (Pull).
+ */
+void mkl_GPIO::setPullResistor(gpio_PullResistor pull) {
+  *addressPortxPCRn &= ~(PORT_PCR_PS_MASK | PORT_PCR_PE_MASK);
+  *addressPortxPCRn |= pull;
+}
+
+/*!
+ *   @fn         writeBit
+ *
+ *   @brief      Escreve no pino de saída.
+ *
+ *   Este método escreve o valor do bit do parâmetro "bit" no pino da
+ *   porta de saída, com um único store no PSOR ou no PCOR.
+ *
+ *   @param[in]  bit - O valor do bit a ser escrito no pino da porta de saída.
+ *
+ *   @remarks    Siglas e páginas do Manual de Referência KL25:
+ *               - PSOR: Port Set Output Register. Pág. 776.
+ *               - PCOR: Port Clear Output Register. Pág. 776.
+ */
+void mkl_GPIO::writeBit(int bit) {
+  if (bit) {
+    *addressPSOR = pinPort;
+  } else {
+    *addressPCOR = pinPort;
+  }
+}
+
+/*!
+ *   @fn         setBit
+ *
+ *   @brief      Coloca o pino de saída em '1'.
+ *
+ *   Este método escreve a máscara do pino no PSOR. Os demais pinos da porta
+ *   não são afetados, e a escrita é atômica em relação às interrupções.
+ *
+ *   @remarks    Siglas e páginas do Manual de Referência KL25:
+ *               - PSOR: Port Set Output Register. Pág. 776.
+ */
+void mkl_GPIO::setBit() {
+  *addressPSOR = pinPort;
+}
+
+/*!
+ *   @fn         clearBit
+ *
+ *   @brief      Coloca o pino de saída em '0'.
+ *
+ *   Este método escreve a máscara do pino no PCOR. Os demais pinos da porta
+ *   não são afetados, e a escrita é atômica em relação às interrupções.
+ *
+ *   @remarks    Siglas e páginas do Manual de Referência KL25:
+ *               - PCOR: Port Clear Output Register. Pág. 776.
+ */
+void mkl_GPIO::clearBit() {
+  *addressPCOR = pinPort;
+}
+
+/*!
+ *   @fn       readBit
+ *
+ *   @brief    Lê o pino de entrada.
+ *
+ *   Este método lê o valor do bit presente no pino da porta de entrada.
+ *
+ *	 @return   O valor do bit presente no pino da porta de entrada.
+ *
+ *   @remarks  Siglas e páginas do Manual de Referência KL25:
+ *             - PDIR: Port Data Input Register. Pág. 777.
+ */
+int mkl_GPIO::readBit() {
+  if (*addressPDIR & pinPort) {
+    return 1;
+  }
+  return 0;
+}
+
+/*!
+ *   @fn       toogleBit
+ *
+ *   @brief    Altera o bit de saída para o seu complemento.
+ *
+ *   Este método altera o bit de saída para o seu complemento, i.e.,
+ *   se o bit atual é '0', muda para '1' e vice-versa.
+ *
+ *   @remarks  Siglas e páginas do Manual de Referência KL25:
+ *             - PTOR: Port Toogle Output Register.Pág.777.
+ */
+void mkl_GPIO::toogleBit() {
+  *addressPTOR = pinPort;
+}
+
+/*!
+ *   @fn       setInterruptMode
+ *
+ *   @brief    Seleciona a condição de interrupção do pino.
+ *
+ *   Este método ajusta o campo IRQC do PCR do pino e, para os pinos do
+ *   PORTA e do PORTD, habilita a interrupção da porta no NVIC. Os PORTB,
+ *   PORTC e PORTE do KL25 não geram interrupção: neles o método não tem
+ *   efeito. O ISF é escrito com '0', para não apagar uma flag pendente.
+ *
+ *   @param[in]  mode - gpio_interruptDisabled, gpio_interruptRisingEdge,
+ *                      gpio_interruptFallingEdge ou gpio_interruptBothEdges.
+ *
+ *   @remarks  Siglas e páginas do Manual de Referência KL25:
+ *             - PortxPCRn: Pin Control Register. Pág. 183 (IRQC e ISF).
+ *             - NVIC: Nested Vectored Interrupt Controller. Pág. 51.
+ */
+void mkl_GPIO::setInterruptMode(gpio_InterruptMode mode) {
+  writeInterruptMode(addressPortxPCRn, mode);
+}
+
+/*!
+ *   @fn       attachInterrupt
+ *
+ *   @brief    Registra a rotina chamada na interrupção do pino.
+ *
+ *   A rotina é chamada por handleInterrupt, na rotina de serviço de
+ *   interrupção da porta. Sem efeito nos pinos que não geram interrupção.
+ */
+void mkl_GPIO::attachInterrupt(mkl_GPIOCallback callback, void *context) {
+  writeHandler(addressPortxPCRn, callback, context);
+}
+
+/*!
+ *   @fn       writeInterruptMode
+ *
+ *   @brief    Ajusta o IRQC do pino cujo PCR está em "pcr".
+ *
+ *   Usado por setInterruptMode e pelas classes filhas que configuram
+ *   outros pinos da porta, sem alterar o PCR guardado no objeto.
+ *
+ *   @param[in]  pcr  - endereço do PortxPCRn do pino.
+ *   @param[in]  mode - condição de interrupção.
+ */
+void mkl_GPIO::writeInterruptMode(volatile uint32_t *pcr,
+                                  gpio_InterruptMode mode) {
+  mkl_GPIOHandler *entry = handler(pcr);
+  if (!entry) {
+    return;
+  }
+  *pcr = (*pcr & ~(PORT_PCR_IRQC_MASK | PORT_PCR_ISF_MASK))
+         | PORT_PCR_IRQC(mode);
+  if (mode != gpio_interruptDisabled) {
+    NVIC_EnableIRQ(entry < handlers[1] ? PORTA_IRQn : PORTD_IRQn);
+  }
+}
+
+/*!
+ *   @fn       writeHandler
+ *
+ *   @brief    Registra a rotina do pino cujo PCR está em "pcr".
+ */
+void mkl_GPIO::writeHandler(volatile uint32_t *pcr, mkl_GPIOCallback callback,
+                            void *context) {
+  mkl_GPIOHandler *entry = handler(pcr);
+  if (entry) {
+    entry->callback = callback;
+    entry->context = context;
+  }
+}
+
+/*!
+ *   @fn       isInterruptFlagSet
+ *
+ *   @brief    Informa se a condição de interrupção do pino ocorreu.
+ *
+ *   @remarks  Siglas e páginas do Manual de Referência KL25:
+ *             - ISFR: Interrupt Status Flag Register. Pág. 185.
+ */
+bool mkl_GPIO::isInterruptFlagSet() {
+  return (*addressISFR() & pinPort) != 0;
+}
+
+/*!
+ *   @fn       clearInterruptFlag
+ *
+ *   @brief    Apaga a flag de interrupção do pino (w1c, um store no ISFR).
+ *
+ *   @remarks  Siglas e páginas do Manual de Referência KL25:
+ *             - ISFR: Interrupt Status Flag Register. Pág. 185.
+ */
+void mkl_GPIO::clearInterruptFlag() {
+  *addressISFR() = pinPort;
+}
+
+/*!
+ *   @fn       handleInterrupt
+ *
+ *   @brief    Despacha a interrupção da porta para as rotinas dos pinos.
+ *
+ *   Chamado em PORTA_IRQHandler ou PORTD_IRQHandler. As flags são lidas e
+ *   apagadas com um load e um store no ISFR antes das rotinas: uma nova
+ *   borda durante uma rotina volta a pendurar a interrupção.
+ *
+ *   @param[in]  gpio - gpio_GPIOA ou gpio_GPIOD.
+ *
+ *   @remarks  Siglas e páginas do Manual de Referência KL25:
+ *             - ISFR: Interrupt Status Flag Register. Pág. 185.
+ */
+void mkl_GPIO::handleInterrupt(gpio_Name gpio) {
+  uint8_t GPIONumber = gpio >> 8;
+  mkl_GPIOHandler *table;
+
+  if (GPIONumber == 0) {
+    table = handlers[0];
+  } else if (GPIONumber == 3) {
+    table = handlers[1];
+  } else {
+    return;
+  }
+  volatile uint32_t *isfr = (volatile uint32_t *)(0x40049000
+                              + 0x1000*GPIONumber + 0xA0);
+  uint32_t flags = *isfr;
+  *isfr = flags;
+  for (uint8_t pin = 0; flags; pin++, flags >>= 1) {
+    if ((flags & 1) && table[pin].callback) {
+      table[pin].callback(table[pin].context);
+    }
+  }
+}
+
+/*!
+ *   @fn       addressISFR
+ *
+ *   @brief    Endereço do ISFR da porta do pino, a partir do PCR.
+ *
+ *   Address(hexa): PORTA=400490A0 B=4004A0A0 C=4004B0A0 D=4004C0A0
+ *                  E=4004D0A0.
+ */
+volatile uint32_t *mkl_GPIO::addressISFR() {
+  return (volatile uint32_t *)(((uintptr_t)addressPortxPCRn & ~0xFFFu)
+                               + 0xA0);
+}
+
+/*!
+ *   @fn       handler
+ *
+ *   @brief    Entrada na tabela de rotinas do pino cujo PCR está em
+ *             "pcr", ou 0 se a porta do pino não gera interrupção.
+ */
+mkl_GPIOHandler *mkl_GPIO::handler(volatile uint32_t *pcr) {
+  uintptr_t address = (uintptr_t)pcr;
+  uint32_t GPIONumber = (address - 0x40049000) >> 12;
+  uint32_t pinNumber = (address & 0xFFF) >> 2;
+
+  if (GPIONumber == 0) {
+    return &handlers[0][pinNumber];
+  }
+  if (GPIONumber == 3) {
+    return &handlers[1][pinNumber];
+  }
+  return 0;
+}
+
+/*!
+ *   @fn       bindPeripheral
+ *
+ *   @brief    Associa o objeto de software ao periférico de hardware.
+ *
+ *   Este método associa os ponteiros aos seus respectivos registradores.
+ *
+ *   @remarks  Siglas e páginas do Manual de Referência KL25:
+ *             - PDOR: Port Data Output Register.Pág. 775.
+ *             - PDIR: Port Data Input Register.Pág. 777.
+ *             - PDDR: Port Direct Input Register. Pág. 778.
+ *             - PSOR: Port Set Output Register.Pág. 776.
+ *             - PCOR: Port Clear Output Register.Pág. 776.
+ *             - PTOR: Port Toogle Output Register.Pág.777.
+ *             - PortxPCRn: Pin Control Register.Pág. 183 (Mux) and 185 (Pull).
+ */
+void mkl_GPIO::bindPeripheral(uint8_t GPIONumber, uint8_t pinNumber) {
+  uint32_t baseAddress;
+
+  /*!
+   * Cálculo do endereço base do GPIO do parâmetro "GPIOBaseAddress".
+   * Address(hexa): GPIOA=400FF014 B=400FF054 C=400FF094 D=400FF0D4 E=400FF114.
+   * GPIOBaseAddress = 0x400FF000 (Base GPIOA) + 0x40*(0,1,2,3 ou 4) (Offset).
+   *
+   */
+  baseAddress = GPIOA_BASE + (uint32_t)(0x40*GPIONumber);
+
+  /*!
+   * Cálculo do endereço absoluto do PDOR para o GPIO.
+   * Address(hexa): GPIOA=400FF014 B=400FF054 C=400FF094 D=400FF0D4 E=400FF114.
+   * addressPDOR = address base (Base) + 0x00 (Offset).
+   */
+  addressPDOR = (volatile uint32_t *)(baseAddress + 0x0);
+
+  /*!
+   * Cálculo do endereço absoluto do PSOR para o GPIO.
+   * Address(hexa): GPIOA=400FF004 B=400FF044 C=400FF084 D=400FF0C4 E=400FF104.
+   * addressPSOR = address base (Base) + 0x4 (Offset).
+   */
+  addressPSOR = (volatile uint32_t *)(baseAddress + 0x4);
+
+  /*!
+   * Cálculo do endereço absoluto do PCOR para o GPIO.
+   * Address(hexa): GPIOA=400FF008 B=400FF048 C=400FF088 D=400FF0C8 E=400FF108.
+   * addressPCOR = address base (Base) + 0x8 (Offset).
+   */
+  addressPCOR = (volatile uint32_t *)(baseAddress + 0x8);
+
+  /*!
+   * Cálculo do endereço absoluto do PDIR para o GPIO.
+    * Address(hexa): GPIOA=400FF014 B=400FF054 C=400FF094 D=400FF0D4 E=400FF114.
+   * addressPDIR = address base (Base) + 0x10 (Offset).
+   */
+  addressPDIR = (volatile uint32_t *)(baseAddress + 0x10);
+
+  /*!
+   * Cálculo do endereço absoluto do PDDR para o GPIO.
+    * Address(hexa): GPIOA=400FF014 B=400FF054 C=400FF094 D=400FF0D4 E=400FF114.
+   * addressPDDR = address base (Base) + 0x14 (Offset).
+   */
+  addressPDDR = (volatile uint32_t *)(baseAddress + 0x14);
+
+  /*!
+   * Cálculo do endereço absoluto do PTOR para o GPIO.
+   * Address(hexa): GPIOA=400FF014 B=400FF054 C=400FF094 D=400FF0D4 E=400FF114.
+   * addressPTOR = address base (Base) + 0xC (Offset).
+   */
+  addressPTOR = (volatile uint32_t *)(baseAddress + 0xC);
+
+  /*!
+   * Cálculo do endereço absoluto do PCR para o GPIO.
+   * Address(hexa): GPIOA=400FF014 B=400FF054 C=400FF094 D=400FF0D4 E=400FF114.
+   * addressPortxPCRn = 0x40049000 (Base) + 0x1000*(0,1,2,3,4 ou 5)
+   *                    + 4*(0,1,2,3,4,...,30) (Offset).
+   */
+  addressPortxPCRn = (volatile uint32_t *)(0x40049000
+                       + 0x1000*GPIONumber
+                       + 4*pinNumber);
+}
+
+/*!
+ *   @fn       enablePeripheralClock
+ *
+ *   @brief    Habilita o clock do GPIO do periférico.
+ *
+ *   Este método habilita o clock do GPIO selecionado através do registrador
+ *   SIM_SCGC5.
+ *
+ *   @remarks  Siglas e páginas do Manual de Referência KL25:
+ *             - SIM_SCGC5:System Clock Gating Control Register.Pág. 206.
+ */
+void mkl_GPIO::enableModuleClock(uint8_t GPIONumber) {
+  SIM_SCGC5 |= SIM_SCGC5_PORTA_MASK << GPIONumber;
+}
+
+/*!
+ *   @fn       selectMuxAlternative
+ *
+ *   @brief    Seleciona o modo GPIO de operação do pino.
+ *
+ *   Este método seleciona o modo de operação do pino através do registrador
+ *   Portx_PCRn, utilizando a macro de configuração PORT_PCR_MUX(x), disponível
+ *   no arquivo MKL25Z4.h
+ *
+ *   @remarks  Siglas e páginas do Manual de Referência KL25:
+ *             - PortxPCRn: Pin Control Register.Pág. 183 (Mux) and 185 (Pull).
+ */
+void mkl_GPIO::selectMuxAlternative() {
+  *addressPortxPCRn = PORT_PCR_MUX(1);
+}
+
+/*!
+ *   @fn       setGPIOParameters
+ *
+ *   @brief    Configura os parâmetros do GPIO conforme o pino.
+ *
+ *   Este método configura os parâmetros de número do GPIO e número do pino
+ *   passados no construtor, permitindo as suas devidas identificações para uso
+ *   nos métodos de bind, de configuração e de leitura/escrita da porta.
+ *
+ */
+void mkl_GPIO::setGPIOParameters(gpio_Pin pin, uint32_t &gpio,
+                                     uint32_t &pinNumber) {
+  pinNumber = pin & 0xFF;
+  gpio = pin >> 8;
+  pinPort = 1 << pinNumber;
+}
@@ -1,203 +1,277 @@
-/*!
- * @copyright    2017 UFAM - Universidade Federal do Amazonas.
- *
- * @brief       Interface da API em C++ da classe me GPIO.
- *
- * @file        mkl_GPIO.h
- * @version     1.0
- * @date        6 Julho 2017
- *
- * @section     HARDWARES & SOFTWARES
- *              +board        FRDM-KL25Z da NXP.
- *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+
- *              +compiler     Kinetis Design Studio IDE
- *              +manual       L25P80M48SF0RM, Rev.3, September 2012
- *              +revisions    Verso (data): Descrio breve.
- *                             ++ 1.0 (30 Julho 2017): Verso inicial.
- *
- * @section     AUTHORS & DEVELOPERS
- *              +institution  Universidade Federal do Amazonas
- *              +courses      Engenharia da Computao / Engenharia Eltrica
- *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
- *              +student      Verso inicial:
- *                             ++ Hamilton Nascimento <hdan_neto@hotmail.com>
- *
- * @section     LICENSE
- *
- *              GNU General Public License (GNU GPL)
- *
- *              Este programa  um software livre; Voc pode redistribu-lo
- *              e/ou modific-lo de acordo com os termos do "GNU General Public
- *              License" como publicado pela Free Software Foundation; Seja a
- *              verso 3 da licena, ou qualquer verso posterior.
- *
- *              Este programa  distribudo na esperana de que seja til,
- *              mas SEM QUALQUER GARANTIA; Sem a garantia implcita de
- *              COMERCIALIZAO OU USO PARA UM DETERMINADO PROPSITO.
- *              Veja o site da "GNU General Public License" para mais detalhes.
- *
- * @htmlonly    http://www.gnu.org/copyleft/gpl.html
- */
-
-#ifndef MKL_GPIO_H_
-#define MKL_GPIO_H_
-
-#include <stdint.h>
-#include <MKL25Z4.h>
-
-/*!
- * Namespace de definio dos GPIOs e pinos implementados.
- */
-typedef enum {
-  gpio_GPIOA = 0 << 8,
-  gpio_GPIOB = 1 << 8,
-  gpio_GPIOC = 2 << 8,
-  gpio_GPIOD = 3 << 8,
-  gpio_GPIOE = 4 << 8
-}gpio_Name;
-
-typedef enum {
-  gpio_PTA1 = 1 | gpio_GPIOA,
-  gpio_PTA2 = 2 | gpio_GPIOA,
-  gpio_PTA4 = 4 | gpio_GPIOA,
-  gpio_PTA5 = 5 | gpio_GPIOA,
-  gpio_PTA12 = 12 | gpio_GPIOA,
-  gpio_PTA13 = 13 | gpio_GPIOA,
-  gpio_PTA17 = 17 | gpio_GPIOA,
-  gpio_PTB0 = 0 | gpio_GPIOB,
-  gpio_PTB1 = 1 | gpio_GPIOB,
-  gpio_PTB2 = 2 | gpio_GPIOB,
-  gpio_PTB3 = 3 | gpio_GPIOB,
-  gpio_PTB8 = 8 | gpio_GPIOB,
-  gpio_PTB9 = 9 | gpio_GPIOB,
-  gpio_PTB10 = 10 | gpio_GPIOB,
-  gpio_PTB11 = 11 | gpio_GPIOB,
-  gpio_PTB18 = 18 | gpio_GPIOB,
-  gpio_PTB19 = 19 | gpio_GPIOB,
-  gpio_PTC0 = 0 | gpio_GPIOC,
-  gpio_PTC1 = 1 | gpio_GPIOC,
-  gpio_PTC2 = 2 | gpio_GPIOC,
-  gpio_PTC3 = 3 | gpio_GPIOC,
-  gpio_PTC4 = 4 | gpio_GPIOC,
-  gpio_PTC5 = 5 | gpio_GPIOC,
-  gpio_PTC6 = 6 | gpio_GPIOC,
-  gpio_PTC7 = 7 | gpio_GPIOC,
-  gpio_PTC8 = 8 | gpio_GPIOC,
-  gpio_PTC9 = 9 | gpio_GPIOC,
-  gpio_PTC10 = 10 | gpio_GPIOC,
-  gpio_PTC11 = 11 | gpio_GPIOC,
-  gpio_PTC12 = 12 | gpio_GPIOC,
-  gpio_PTC13 = 13 | gpio_GPIOC,
-  gpio_PTC14 = 14 | gpio_GPIOC,
-  gpio_PTC15 = 15 | gpio_GPIOC,
-  gpio_PTC16 = 16 | gpio_GPIOC,
-  gpio_PTC17 = 17 | gpio_GPIOC,
-  gpio_PTD0 = 0 | gpio_GPIOD,
-  gpio_PTD1 = 1 | gpio_GPIOD,
-  gpio_PTD2 = 2 | gpio_GPIOD,
-  gpio_PTD3 = 3 | gpio_GPIOD,
-  gpio_PTD4 = 4 | gpio_GPIOD,
-  gpio_PTD5 = 5 | gpio_GPIOD,
-  gpio_PTD6 = 6 | gpio_GPIOD,
-  gpio_PTD7 = 7 | gpio_GPIOD,
-  gpio_PTE0 = 0 | gpio_GPIOE,
-  gpio_PTE1 = 1 | gpio_GPIOE,
-  gpio_PTE3 = 3 | gpio_GPIOE,
-  gpio_PTE4 = 4 | gpio_GPIOE,
-  gpio_PTE5 = 5 | gpio_GPIOE,
-  gpio_PTE20 = 20 | gpio_GPIOE,
-  gpio_PTE21 = 21 | gpio_GPIOE,
-  gpio_PTE22 = 22 | gpio_GPIOE,
-  gpio_PTE23 = 23 | gpio_GPIOE,
-  gpio_PTE29 = 29 | gpio_GPIOE
-}gpio_Pin;
-
-/*!
- * Namespace de definio dos tipos de pull resistor.
- */
-typedef enum {
-  gpio_pullNoneResistor = 0,
-  gpio_pullUpResistor = 3
-}gpio_PullResistor;
-
-/*!
- * Namespace de definio dos modos de operao do pino.
- */
-typedef enum {
-  gpio_input  = 0,
-  gpio_output = 1
-}gpio_PortMode;
-
-/*!
- *  @class    mkl_GPIO_ocp
- *
- *  @brief    Classe de implementao do perifrico GPIO para a placa KL25Z128.
- *
- *  @details  Esta classe  usada para leitura ou escrita de dados binrios
- *            e usa o perifrico on-chip GPIOA a GPIOE.
- *
- *  @section  EXAMPLES USAGE
- *
- *            Uso dos mtodos como porta de entrada.
- *	           +fn setPortMode(PortMode_t::Input);
- *	           +fn setPullResistor(PullResistor_t::PullNoneResistor);
- *             +fn setPullResistor(mkl_PullUp);
- *             +fn data = readBit();
- *
- *            Uso dos mtodos como porta de sada.
- *	           +fn setPortMode(PortMode_t::Output);
- *             +fn writeBit(data);
- */
-class mkl_GPIO {
- public:
-  /*!
-   * Mtodos de configurao do pino.
-   */
-  void setPortMode(gpio_PortMode mode);
-  void setPullResistor(gpio_PullResistor pull);
-  /*!
-   * Mtodos de escrita no pino.
-   */
-  void writeBit(int bit);
-  void toogleBit();
-  /*!
-   * Mtodo de leitura do pino.
-   */
-  int readBit();
-
- protected:
-  /*!
-   * Endereo do registrador PDDR no mapa de memria.
-   */
-  volatile uint32_t *addressPDDR;
-  /*!
-   * Endereo do registrador PDOR no mapa de memria.
-   */
-  volatile uint32_t *addressPDOR;
-  /*!
-   * Endereo do registrador PDIR no mapa de memria.
-   */
-  volatile uint32_t *addressPDIR;
-  /*!
-   * Endereo do registrador PTOR no mapa de memria.
-   */
-  volatile uint32_t *addressPTOR;
-  /*!
-   * Endereo do registrador Port PCR no mapa de memria.
-   */
-  volatile uint32_t *addressPortxPCRn;
-  /*!
-   * Mscara do pino correspondente para uso nas operaes de
-   * configurao, leitura e escrita.
-   */
-  volatile uint32_t pinPort;
-  /*!
-   * Mtodos privados de inicializao do perifrico.
-   */
-  void bindPeripheral(uint8_t GPIONumber, uint8_t pinNumber);
-  void enableModuleClock(uint8_t GPIONumber);
-  void selectMuxAlternative();
-  void setGPIOParameters(gpio_Pin pin, uint32_t &gpio, uint32_t &pinNumber);
-};
-
-#endif  //  MKL_GPIO_H_
+/*!
+ * @copyright   © 2017 UFAM - Universidade Federal do Amazonas.
+ *
+ * @brief       Interface da API em C++ da classe mãe GPIO.
+ *
+ * @file        mkl_GPIO.h
+ * @version     1.3
+ * @date        6 Julho 2017
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+
+ *              +compiler     Kinetis® Design Studio IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão (data): Descrição breve.
+ *                             ++ 1.0 (30 Julho 2017): Versão inicial.
+ *                             ++ 1.1 (17 Outubro 2026): Escrita por PSOR/PCOR/PTOR.
+ *                             ++ 1.2 (17 Outubro 2026): Interrupção do pino (IRQC) e tabela de rotinas por pino.
+ *                             ++ 1.3 (17 Outubro 2026): writeInterruptMode e writeHandler recebem o PCR do pino.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas
+ *              +courses      Engenharia da Computação / Engenharia Elétrica
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Versão inicial:
+ *                             ++ Hamilton Nascimento <hdan_neto@hotmail.com>
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL)
+ *
+ *              Este programa é um software livre; Você pode redistribuí-lo
+ *              e/ou modificá-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              versão 3 da licença, ou qualquer versão posterior.
+ *
+ *              Este programa é distribuído na esperança de que seja útil,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implícita de
+ *              COMERCIALIZAÇÃO OU USO PARA UM DETERMINADO PROPÓSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#ifndef MKL_GPIO_H_
+#define MKL_GPIO_H_
+
+#include <stdint.h>
+#include <MKL25Z4.h>
+
+/*!
+ * Namespace de definição dos GPIOs e pinos implementados.
+ */
+typedef enum {
+  gpio_GPIOA = 0 << 8,
+  gpio_GPIOB = 1 << 8,
+  gpio_GPIOC = 2 << 8,
+  gpio_GPIOD = 3 << 8,
+  gpio_GPIOE = 4 << 8
+}gpio_Name;
+
+typedef enum {
+  gpio_PTA1 = 1 | gpio_GPIOA,
+  gpio_PTA2 = 2 | gpio_GPIOA,
+  gpio_PTA4 = 4 | gpio_GPIOA,
+  gpio_PTA5 = 5 | gpio_GPIOA,
+  gpio_PTA12 = 12 | gpio_GPIOA,
+  gpio_PTA13 = 13 | gpio_GPIOA,
+  gpio_PTA17 = 17 | gpio_GPIOA,
+  gpio_PTB0 = 0 | gpio_GPIOB,
+  gpio_PTB1 = 1 | gpio_GPIOB,
+  gpio_PTB2 = 2 | gpio_GPIOB,
+  gpio_PTB3 = 3 | gpio_GPIOB,
+  gpio_PTB8 = 8 | gpio_GPIOB,
+  gpio_PTB9 = 9 | gpio_GPIOB,
+  gpio_PTB10 = 10 | gpio_GPIOB,
+  gpio_PTB11 = 11 | gpio_GPIOB,
+  gpio_PTB18 = 18 | gpio_GPIOB,
+  gpio_PTB19 = 19 | gpio_GPIOB,
+  gpio_PTC0 = 0 | gpio_GPIOC,
+  gpio_PTC1 = 1 | gpio_GPIOC,
+  gpio_PTC2 = 2 | gpio_GPIOC,
+  gpio_PTC3 = 3 | gpio_GPIOC,
+  gpio_PTC4 = 4 | gpio_GPIOC,
+  gpio_PTC5 = 5 | gpio_GPIOC,
+  gpio_PTC6 = 6 | gpio_GPIOC,
+  gpio_PTC7 = 7 | gpio_GPIOC,
+  gpio_PTC8 = 8 | gpio_GPIOC,
+  gpio_PTC9 = 9 | gpio_GPIOC,
+  gpio_PTC10 = 10 | gpio_GPIOC,
+  gpio_PTC11 = 11 | gpio_GPIOC,
+  gpio_PTC12 = 12 | gpio_GPIOC,
+  gpio_PTC13 = 13 | gpio_GPIOC,
+  gpio_PTC14 = 14 | gpio_GPIOC,
+  gpio_PTC15 = 15 | gpio_GPIOC,
+  gpio_PTC16 = 16 | gpio_GPIOC,
+  gpio_PTC17 = 17 | gpio_GPIOC,
+  gpio_PTD0 = 0 | gpio_GPIOD,
+  gpio_PTD1 = 1 | gpio_GPIOD,
+  gpio_PTD2 = 2 | gpio_GPIOD,
+  gpio_PTD3 = 3 | gpio_GPIOD,
+  gpio_PTD4 = 4 | gpio_GPIOD,
+  gpio_PTD5 = 5 | gpio_GPIOD,
+  gpio_PTD6 = 6 | gpio_GPIOD,
+  gpio_PTD7 = 7 | gpio_GPIOD,
+  gpio_PTE0 = 0 | gpio_GPIOE,
+  gpio_PTE1 = 1 | gpio_GPIOE,
+  gpio_PTE3 = 3 | gpio_GPIOE,
+  gpio_PTE4 = 4 | gpio_GPIOE,
+  gpio_PTE5 = 5 | gpio_GPIOE,
+  gpio_PTE20 = 20 | gpio_GPIOE,
+  gpio_PTE21 = 21 | gpio_GPIOE,
+  gpio_PTE22 = 22 | gpio_GPIOE,
+  gpio_PTE23 = 23 | gpio_GPIOE,
+  gpio_PTE29 = 29 | gpio_GPIOE
+}gpio_Pin;
+
+/*!
+ * Namespace de definição dos tipos de pull resistor.
+ */
+typedef enum {
+  gpio_pullNoneResistor = 0,
+  gpio_pullUpResistor = 3
+}gpio_PullResistor;
+
+/*!
+ * Namespace de definição dos modos de operação do pino.
+ */
+typedef enum {
+  gpio_input  = 0,
+  gpio_output = 1
+}gpio_PortMode;
+
+/*!
+ * Namespace de definição das condições de interrupção do pino (IRQC).
+ */
+typedef enum {
+  gpio_interruptDisabled = 0,
+  gpio_interruptRisingEdge = 9,
+  gpio_interruptFallingEdge = 10,
+  gpio_interruptBothEdges = 11
+}gpio_InterruptMode;
+
+/*!
+ *  Rotina chamada na interrupção do pino, com o contexto registrado.
+ */
+typedef void (*mkl_GPIOCallback)(void *context);
+
+/*!
+ *  Entrada da tabela de rotinas de interrupção por pino.
+ */
+typedef struct {
+  mkl_GPIOCallback callback;
+  void *context;
+} mkl_GPIOHandler;
+
+/*!
+ *  @class    mkl_GPIO_ocp
+ *
+ *  @brief    Classe de implementação do periférico GPIO para a placa KL25Z128.
+ *
+ *  @details  Esta classe é usada para leitura ou escrita de dados binários
+ *            e usa o periférico on-chip GPIOA a GPIOE.
+ *
+ *  @section  EXAMPLES USAGE
+ *
+ *            Uso dos métodos como porta de entrada.
+ *	           +fn setPortMode(PortMode_t::Input);
+ *	           +fn setPullResistor(PullResistor_t::PullNoneResistor);
+ *             +fn setPullResistor(mkl_PullUp);
+ *             +fn data = readBit();
+ *
+ *            Uso dos métodos como porta de saída.
+ *	           +fn setPortMode(PortMode_t::Output);
+ *             +fn writeBit(data);
+ *             +fn setBit();
+ *             +fn clearBit();
+ *             +fn toogleBit();
+ *
+ *            As escritas são feitas com um único store nos registradores
+ *            PSOR, PCOR ou PTOR, sem leitura-modificação-escrita do PDOR,
+ *            e por isso são atômicas em relação às interrupções.
+ *
+ *            Uso da interrupção do pino. No KL25 só os pinos do PORTA e do
+ *            PORTD geram interrupção; a rotina de serviço da porta chama
+ *            handleInterrupt, que consulta a tabela de rotinas por pino.
+ *             +fn attachInterrupt(onKey, &keyTask);
+ *             +fn setInterruptMode(gpio_interruptFallingEdge);
+ *             +fn void PORTA_IRQHandler() {
+ *                   mkl_GPIO::handleInterrupt(gpio_GPIOA); }
+ */
+class mkl_GPIO {
+ public:
+  /*!
+   * Métodos de configuração do pino.
+   */
+  void setPortMode(gpio_PortMode mode);
+  void setPullResistor(gpio_PullResistor pull);
+  /*!
+   * Métodos de escrita no pino.
+   */
+  void writeBit(int bit);
+  void setBit();
+  void clearBit();
+  void toogleBit();
+  /*!
+   * Método de leitura do pino.
+   */
+  int readBit();
+  /*!
+   * Métodos de interrupção do pino.
+   */
+  void setInterruptMode(gpio_InterruptMode mode);
+  void attachInterrupt(mkl_GPIOCallback callback, void *context);
+  bool isInterruptFlagSet();
+  void clearInterruptFlag();
+  static void handleInterrupt(gpio_Name gpio);
+
+ protected:
+  /*!
+   * Endereço do registrador PDDR no mapa de memória.
+   */
+  volatile uint32_t *addressPDDR;
+  /*!
+   * Endereço do registrador PDOR no mapa de memória.
+   */
+  volatile uint32_t *addressPDOR;
+  /*!
+   * Endereço do registrador PDIR no mapa de memória.
+   */
+  volatile uint32_t *addressPDIR;
+  /*!
+   * Endereço do registrador PSOR no mapa de memória.
+   */
+  volatile uint32_t *addressPSOR;
+  /*!
+   * Endereço do registrador PCOR no mapa de memória.
+   */
+  volatile uint32_t *addressPCOR;
+  /*!
+   * Endereço do registrador PTOR no mapa de memória.
+   */
+  volatile uint32_t *addressPTOR;
+  /*!
+   * Endereço do registrador Port PCR no mapa de memória.
+   */
+  volatile uint32_t *addressPortxPCRn;
+  /*!
+   * Máscara do pino correspondente para uso nas operações de
+   * configuração, leitura e escrita.
+   */
+  volatile uint32_t pinPort;
+  /*!
+   * Métodos privados de inicialização do periférico.
+   */
+  void bindPeripheral(uint8_t GPIONumber, uint8_t pinNumber);
+  void enableModuleClock(uint8_t GPIONumber);
+  void selectMuxAlternative();
+  void setGPIOParameters(gpio_Pin pin, uint32_t &gpio, uint32_t &pinNumber);
+  /*!
+   * Métodos de interrupção de um pino dado pelo endereço do seu PCR.
+   */
+  static void writeInterruptMode(volatile uint32_t *pcr,
+                                 gpio_InterruptMode mode);
+  static void writeHandler(volatile uint32_t *pcr,
+                           mkl_GPIOCallback callback, void *context);
+
+ private:
+  /*!
+   * Tabela de rotinas de interrupção dos pinos do PORTA e do PORTD.
+   */
+  static mkl_GPIOHandler handlers[2][32];
+  volatile uint32_t *addressISFR();
+  static mkl_GPIOHandler *handler(volatile uint32_t *pcr);
+};
+
+#endif  //  MKL_GPIO_H_
@@ -0,0 +1,228 @@
+/*!
+ * @copyright   © 2017 UFAM - Universidade Federal do Amazonas.
+ *
+ * @brief       Implementação da API em C++ para grupos de pinos de um mesmo GPIO.
+ *
+ * @file        mkl_GPIOBus.cpp
+ * @version     1.2
+ * @date        17 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   GPIO e PORT.
+ *              +compiler     Kinetis® Design Studio IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão (data): Descrição breve.
+ *                             ++ 1.0 (17 Outubro 2026): Versão inicial.
+ *                             ++ 1.1 (17 Outubro 2026): setInterruptMode e attachInterrupt para todos os pinos do grupo.
+ *                             ++ 1.2 (17 Outubro 2026): setInterruptMode e attachInterrupt não alteram o PCR do objeto.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas
+ *              +courses      Engenharia da Computação
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Versão inicial:
+ *                             ++ Patrick Chagas dos Santos <patrick.chagas@gmail.com>
+ *                             ++ Gabriel Montenegro Villacrez <gvmontenegro19@gmail.com>
+ *                             ++ Andrezza Bonfim <andrezzabonfiiim@gmail.com>
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ *              Este programa é um software livre; Você pode redistribuí-lo
+ *              e/ou modificá-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              versão 3 da licença, ou qualquer versão posterior.
+ *
+ *              Este programa é distribuído na esperança de que seja útil,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implícita de
+ *              COMERCIALIZAÇÃO OU USO PARA UM DETERMINADO PROPÓSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include "mkl_GPIOBus.h"
+
+/*!
+ *   @fn         mkl_GPIOBus
+ *
+ *   @brief      Construtor padrão da classe.
+ *
+ *   O construtor associa o objeto de software ao GPIO do grupo, habilita o
+ *   clock do GPIO e seleciona o modo GPIO de operação de cada pino da máscara.
+ *
+ *   @param[in]  gpio - GPIO dos pinos do grupo (gpio_GPIOA a gpio_GPIOE).
+ *   @param[in]  mask - máscara dos pinos do grupo, montada com pinMask().
+ *
+ *   @remarks    Siglas e páginas do Manual de Referência KL25:
+ *               - PortxPCRn: Pin Control Register. Pág. 183 (Mux).
+ */
+mkl_GPIOBus::mkl_GPIOBus(gpio_Name gpio, uint32_t mask) {
+  uint8_t GPIONumber = gpio >> 8;
+
+  bindPeripheral(GPIONumber, 0);
+  enableModuleClock(GPIONumber);
+  addressPortxPCR0 = addressPortxPCRn;
+  pinPort = mask;
+
+  for (uint8_t pin = 0; mask != 0; pin++, mask >>= 1) {
+    if (mask & 1) {
+      addressPortxPCR0[pin] = PORT_PCR_MUX(1);
+    }
+  }
+}
+
+/*!
+ *   @fn         setPullResistor
+ *
+ *   @brief      Ajusta o resistor de pull de todos os pinos do grupo.
+ *
+ *   @param[in]  pull - resistor de pull up ou nenhum.
+ *
+ *   @remarks    Siglas e páginas do Manual de Referência KL25:
+ *               - PortxPCRn: Pin Control Register. Pág. 185 (Pull).
+ */
+void mkl_GPIOBus::setPullResistor(gpio_PullResistor pull) {
+  uint32_t mask = pinPort;
+
+  for (uint8_t pin = 0; mask != 0; pin++, mask >>= 1) {
+    if (mask & 1) {
+      addressPortxPCR0[pin] = (addressPortxPCR0[pin]
+                               & ~(PORT_PCR_PS_MASK | PORT_PCR_PE_MASK)) | pull;
+    }
+  }
+}
+
+/*!
+ *   @fn         setInterruptMode
+ *
+ *   @brief      Seleciona a condição de interrupção de todos os pinos do
+ *               grupo.
+ *
+ *   Ajusta o PCR de cada pino da máscara com mkl_GPIO::writeInterruptMode;
+ *   sem efeito fora do PORTA e do PORTD.
+ *
+ *   @param[in]  mode - gpio_interruptDisabled, gpio_interruptRisingEdge,
+ *                      gpio_interruptFallingEdge ou gpio_interruptBothEdges.
+ *
+ *   @remarks    Siglas e páginas do Manual de Referência KL25:
+ *               - PortxPCRn: Pin Control Register. Pág. 183 (IRQC).
+ */
+void mkl_GPIOBus::setInterruptMode(gpio_InterruptMode mode) {
+  uint32_t mask = pinPort;
+
+  for (uint8_t pin = 0; mask != 0; pin++, mask >>= 1) {
+    if (mask & 1) {
+      writeInterruptMode(&addressPortxPCR0[pin], mode);
+    }
+  }
+}
+
+/*!
+ *   @fn         attachInterrupt
+ *
+ *   @brief      Registra a rotina chamada na interrupção de cada pino do
+ *               grupo.
+ */
+void mkl_GPIOBus::attachInterrupt(mkl_GPIOCallback callback, void *context) {
+  uint32_t mask = pinPort;
+
+  for (uint8_t pin = 0; mask != 0; pin++, mask >>= 1) {
+    if (mask & 1) {
+      writeHandler(&addressPortxPCR0[pin], callback, context);
+    }
+  }
+}
+
+/*!
+ *   @fn         setBits
+ *
+ *   @brief      Coloca em '1' os pinos da máscara, com um único store no PSOR.
+ *
+ *   @param[in]  mask - máscara dos pinos, obtida com pinMask().
+ *
+ *   @remarks    Siglas e páginas do Manual de Referência KL25:
+ *               - PSOR: Port Set Output Register. Pág. 776.
+ */
+void mkl_GPIOBus::setBits(uint32_t mask) {
+  *addressPSOR = mask;
+}
+
+/*!
+ *   @fn         clearBits
+ *
+ *   @brief      Coloca em '0' os pinos da máscara, com um único store no PCOR.
+ *
+ *   @param[in]  mask - máscara dos pinos, obtida com pinMask().
+ *
+ *   @remarks    Siglas e páginas do Manual de Referência KL25:
+ *               - PCOR: Port Clear Output Register. Pág. 776.
+ */
+void mkl_GPIOBus::clearBits(uint32_t mask) {
+  *addressPCOR = mask;
+}
+
+/*!
+ *   @fn         toogleBits
+ *
+ *   @brief      Inverte os pinos da máscara, com um único store no PTOR.
+ *
+ *   Permite, por exemplo, mudar o dado e a borda do clock de uma interface
+ *   serial na mesma escrita.
+ *
+ *   @param[in]  mask - máscara dos pinos, obtida com pinMask().
+ *
+ *   @remarks    Siglas e páginas do Manual de Referência KL25:
+ *               - PTOR: Port Toogle Output Register. Pág. 777.
+ */
+void mkl_GPIOBus::toogleBits(uint32_t mask) {
+  *addressPTOR = mask;
+}
+
+/*!
+ *   @fn         writeBus
+ *
+ *   @brief      Escreve "value" nos pinos do grupo.
+ *
+ *   Os bits de "value" na posição dos pinos do grupo são escritos com um store
+ *   no PSOR e outro no PCOR, sem leitura do PDOR. Os demais pinos da porta não
+ *   são afetados.
+ *
+ *   @param[in]  value - valor na posição dos pinos na porta.
+ *
+ *   @remarks    Siglas e páginas do Manual de Referência KL25:
+ *               - PSOR: Port Set Output Register. Pág. 776.
+ *               - PCOR: Port Clear Output Register. Pág. 776.
+ */
+void mkl_GPIOBus::writeBus(uint32_t value) {
+  uint32_t mask = pinPort;
+
+  *addressPSOR = value & mask;
+  *addressPCOR = ~value & mask;
+}
+
+/*!
+ *   @fn         readBus
+ *
+ *   @brief      Lê os pinos do grupo com um único load do PDIR.
+ *
+ *   @return     O nível dos pinos do grupo, na posição dos pinos na porta.
+ *
+ *   @remarks    Siglas e páginas do Manual de Referência KL25:
+ *               - PDIR: Port Data Input Register. Pág. 777.
+ */
+uint32_t mkl_GPIOBus::readBus() {
+  return *addressPDIR & pinPort;
+}
+
+/*!
+ *   @fn         busMask
+ *
+ *   @brief      Retorna a máscara dos pinos do grupo.
+ */
+uint32_t mkl_GPIOBus::busMask() {
+  return pinPort;
+}
@@ -0,0 +1,133 @@
+/*!
+ * @copyright   © 2017 UFAM - Universidade Federal do Amazonas.
+ *
+ * @brief       Interface de programação de aplicações em C++ para grupos de pinos de um mesmo GPIO.
+ *
+ * @file        mkl_GPIOBus.h
+ * @version     1.2
+ * @date        17 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   GPIO e PORT.
+ *              +compiler     Kinetis® Design Studio IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão (data): Descrição breve.
+ *                             ++ 1.0 (17 Outubro 2026): Versão inicial.
+ *                             ++ 1.1 (17 Outubro 2026): setInterruptMode e attachInterrupt para todos os pinos do grupo.
+ *                             ++ 1.2 (17 Outubro 2026): setInterruptMode e attachInterrupt não alteram o PCR do objeto.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas
+ *              +courses      Engenharia da Computação
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Versão inicial:
+ *                             ++ Patrick Chagas dos Santos <patrick.chagas@gmail.com>
+ *                             ++ Gabriel Montenegro Villacrez <gvmontenegro19@gmail.com>
+ *                             ++ Andrezza Bonfim <andrezzabonfiiim@gmail.com>
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ *              Este programa é um software livre; Você pode redistribuí-lo
+ *              e/ou modificá-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              versão 3 da licença, ou qualquer versão posterior.
+ *
+ *              Este programa é distribuído na esperança de que seja útil,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implícita de
+ *              COMERCIALIZAÇÃO OU USO PARA UM DETERMINADO PROPÓSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#ifndef MKL_GPIOBUS_H_
+#define MKL_GPIOBUS_H_
+
+#include "mkl_GPIO/mkl_GPIO.h"
+
+/*!
+ *  @class    mkl_GPIOBus
+ *
+ *  @brief    A classe implementa um grupo de pinos de um mesmo GPIO.
+ *
+ *  @details  Esta classe é derivada da classe mãe "mkl_GPIO" e usa a máscara
+ *            "pinPort" com um bit para cada pino do grupo. Assim, vários pinos
+ *            da porta são escritos com um único store no PSOR, PCOR ou PTOR e
+ *            lidos com um único load do PDIR.
+ *
+ *            As máscaras passadas aos métodos de escrita estão na posição dos
+ *            pinos na porta e são obtidas com pinMask().
+ *
+ *            setInterruptMode e attachInterrupt valem para todos os pinos
+ *            do grupo (e não só para o pino 0 da porta, como os de
+ *            mkl_GPIO): a rotina é chamada uma vez por pino sinalizado, com
+ *            o mesmo contexto. isInterruptFlagSet e clearInterruptFlag já
+ *            usam a máscara do grupo.
+ *
+ *  @section  EXAMPLES USAGE
+ *
+ *            Declaração do grupo de pinos.
+ *             +fn mkl_GPIOBus keys(gpio_GPIOB,
+ *                                  mkl_GPIOBus::pinMask(gpio_PTB8) |
+ *                                  mkl_GPIOBus::pinMask(gpio_PTB9));
+ *
+ *            Uso dos métodos como porta de entrada.
+ *             +fn keys.setPortMode(gpio_input);
+ *             +fn keys.setPullResistor(gpio_pullUpResistor);
+ *             +fn levels = keys.readBus();
+ *
+ *            Uso dos métodos como porta de saída.
+ *             +fn bus.setBits(mkl_GPIOBus::pinMask(gpio_PTC0));
+ *             +fn bus.toogleBits(mkl_GPIOBus::pinMask(gpio_PTC0) |
+ *                                mkl_GPIOBus::pinMask(gpio_PTC7));
+ *             +fn bus.writeBus(value);
+ */
+class mkl_GPIOBus : public mkl_GPIO {
+ public:
+  /*!
+   * Construtor padrão da classe.
+   */
+  mkl_GPIOBus(gpio_Name gpio, uint32_t mask);
+  /*!
+   * Método de configuração dos pinos.
+   */
+  void setPullResistor(gpio_PullResistor pull);
+  /*!
+   * Métodos de interrupção dos pinos.
+   */
+  void setInterruptMode(gpio_InterruptMode mode);
+  void attachInterrupt(mkl_GPIOCallback callback, void *context);
+  /*!
+   * Métodos de escrita nos pinos.
+   */
+  void setBits(uint32_t mask);
+  void clearBits(uint32_t mask);
+  void toogleBits(uint32_t mask);
+  void writeBus(uint32_t value);
+  /*!
+   * Métodos de leitura dos pinos.
+   */
+  uint32_t readBus();
+  uint32_t busMask();
+  /*!
+   * Máscara do pino na porta e GPIO do pino, para montagem dos grupos.
+   */
+  static constexpr uint32_t pinMask(gpio_Pin pin) {
+    return 1u << (pin & 0xFF);
+  }
+  static constexpr gpio_Name gpioName(gpio_Pin pin) {
+    return static_cast<gpio_Name>(pin & 0xFF00);
+  }
+
+ private:
+  /*!
+   * Endereço do registrador PCR do pino 0 da porta no mapa de memória.
+   */
+  volatile uint32_t *addressPortxPCR0;
+};
+
+#endif  //  MKL_GPIOBUS_H_
@@ -0,0 +1,145 @@
+/*!
+ * @copyright   © 2017 UFAM - Universidade Federal do Amazonas.
+ *
+ * @brief       Debounce paralelo, por contadores verticais, de um grupo de teclas de um GPIO.
+ *
+ * @file        mkl_GPIOBusDebouncer.cpp
+ * @version     1.2
+ * @date        17 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   GPIO.
+ *              +compiler     Kinetis® Design Studio IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão (data): Descrição breve.
+ *                             ++ 1.0 (17 Outubro 2026): Versão inicial.
+ *                             ++ 1.1 (17 Outubro 2026): Contador de pressão longa e de repetição por tecla.
+ *                             ++ 1.2 (17 Outubro 2026): Pressão longa e repetição por um contador vertical de amostras, sem laço por tecla.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas
+ *              +courses      Engenharia da Computação
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Versão inicial:
+ *                             ++ Patrick Chagas dos Santos <patrick.chagas@gmail.com>
+ *                             ++ Gabriel Montenegro Villacrez <gvmontenegro19@gmail.com>
+ *                             ++ Andrezza Bonfim <andrezzabonfiiim@gmail.com>
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ *              Este programa é um software livre; Você pode redistribuí-lo
+ *              e/ou modificá-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              versão 3 da licença, ou qualquer versão posterior.
+ *
+ *              Este programa é distribuído na esperança de que seja útil,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implícita de
+ *              COMERCIALIZAÇÃO OU USO PARA UM DETERMINADO PROPÓSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include "mkl_GPIOBusDebouncer.h"
+
+/*!
+ *   @fn         mkl_GPIOBusDebouncer
+ *
+ *   @brief      Associa o grupo de pinos, com todas as teclas soltas.
+ */
+mkl_GPIOBusDebouncer::mkl_GPIOBusDebouncer(gpio_Name gpio, uint32_t mask)
+    : mkl_GPIOBus(gpio, mask), state(0), count0(0), count1(0), pressed(0),
+      released(0), longPressed(0), repeated(0), hold(), holdBits(0),
+      longSamples(0), wrapSamples(0), repeatEnabled(false) {
+}
+
+/*!
+ *   @fn         setHoldTimes
+ *
+ *   @brief      Ajusta, em amostras, a pressão longa e o período da
+ *               repetição automática.
+ *
+ *   A contagem volta a longSamples ao chegar a wrapSamples =
+ *   longSamples + repeatSamples (ou + 1, sem repetição): holdBits é o
+ *   número de bits de wrapSamples.
+ *
+ *   @param[in]  longSamples - amostras até a pressão longa (0 desliga).
+ *               repeatSamples - amostras entre repetições (0 desliga).
+ */
+void mkl_GPIOBusDebouncer::setHoldTimes(uint16_t longSamples,
+                                        uint16_t repeatSamples) {
+  this->longSamples = longSamples;
+  repeatEnabled = repeatSamples != 0;
+  wrapSamples = longSamples + (repeatEnabled ? repeatSamples : 1u);
+  holdBits = 0;
+  if (longSamples) {
+    while (holdBits < kHoldBits && (wrapSamples >> holdBits)) {
+      holdBits++;
+    }
+  }
+  for (uint8_t k = 0; k < kHoldBits; k++) {
+    hold[k] = 0;
+  }
+}
+
+/*!
+ *   @fn         sample
+ *
+ *   @brief      Lê o PDIR uma vez e avança o debounce de todas as teclas.
+ *
+ *   Nas teclas com amostra diferente do estado (delta), o contador vertical
+ *   avança 0, 1, 2, 3 e 0; a volta a zero (toggle) inverte o estado. Nas
+ *   demais, o contador é zerado.
+ *
+ *   @remarks    Siglas e páginas do Manual de Referência KL25:
+ *               - PDIR: Port Data Input Register. Pág. 777.
+ */
+void mkl_GPIOBusDebouncer::sample() {
+  uint32_t keys = ~*addressPDIR & pinPort;
+  uint32_t delta = keys ^ state;
+  count1 = (count1 ^ count0) & delta;
+  count0 = ~count0 & delta;
+  uint32_t toggle = delta & ~(count0 | count1);
+
+  state ^= toggle;
+  pressed = toggle & state;
+  released = toggle & ~state;
+  longPressed = 0;
+  repeated = 0;
+
+  /*!
+   *  Pressão longa e repetição: o contador vertical soma 1 (carry = held)
+   *  nas teclas que seguem pressionadas e zera as demais, inclusive as
+   *  recém-pressionadas. atLong e atWrap acumulam, bit a bit, a igualdade
+   *  das contagens com longSamples e com wrapSamples. Sem tecla
+   *  pressionada, os contadores já estão zerados.
+   */
+  uint32_t held = state & ~pressed;
+  if (!holdBits || !(held | released)) {
+    return;
+  }
+  uint32_t carry = held;
+  uint32_t atLong = held;
+  uint32_t atWrap = held;
+  for (uint8_t k = 0; k < holdBits; k++) {
+    uint32_t bit = hold[k];
+    hold[k] = (bit ^ carry) & held;
+    carry &= bit;
+    atLong &= ~(hold[k] ^ (0u - ((longSamples >> k) & 1u)));
+    atWrap &= ~(hold[k] ^ (0u - ((wrapSamples >> k) & 1u)));
+  }
+  longPressed = atLong;
+  if (!atWrap) {
+    return;
+  }
+  if (repeatEnabled) {
+    repeated = atWrap;
+  }
+  for (uint8_t k = 0; k < holdBits; k++) {
+    hold[k] = (hold[k] & ~atWrap) | (atWrap & (0u - ((longSamples >> k) & 1u)));
+  }
+}
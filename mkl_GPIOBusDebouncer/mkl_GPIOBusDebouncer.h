@@ -0,0 +1,141 @@
+/*!
+ * @copyright   © 2017 UFAM - Universidade Federal do Amazonas.
+ *
+ * @brief       Debounce paralelo, por contadores verticais, de um grupo de teclas de um GPIO.
+ *
+ * @file        mkl_GPIOBusDebouncer.h
+ * @version     1.2
+ * @date        17 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   GPIO.
+ *              +compiler     Kinetis® Design Studio IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão (data): Descrição breve.
+ *                             ++ 1.0 (17 Outubro 2026): Versão inicial.
+ *                             ++ 1.1 (17 Outubro 2026): Contador de pressão longa e de repetição por tecla.
+ *                             ++ 1.2 (17 Outubro 2026): Pressão longa e repetição por um contador vertical de amostras, sem laço por tecla.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas
+ *              +courses      Engenharia da Computação
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Versão inicial:
+ *                             ++ Patrick Chagas dos Santos <patrick.chagas@gmail.com>
+ *                             ++ Gabriel Montenegro Villacrez <gvmontenegro19@gmail.com>
+ *                             ++ Andrezza Bonfim <andrezzabonfiiim@gmail.com>
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ *              Este programa é um software livre; Você pode redistribuí-lo
+ *              e/ou modificá-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              versão 3 da licença, ou qualquer versão posterior.
+ *
+ *              Este programa é distribuído na esperança de que seja útil,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implícita de
+ *              COMERCIALIZAÇÃO OU USO PARA UM DETERMINADO PROPÓSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#ifndef MKL_GPIOBUSDEBOUNCER_H_
+#define MKL_GPIOBUSDEBOUNCER_H_
+
+#include <stdint.h>
+#include <mkl_GPIOBus/mkl_GPIOBus.h>
+
+/*!
+ *  @class    mkl_GPIOBusDebouncer
+ *
+ *  @brief    Debounce simultâneo de todas as teclas de um mkl_GPIOBus, com
+ *            uma leitura do PDIR por amostra.
+ *
+ *  @details  Cada tecla tem um contador de 2 bits, guardado "na vertical":
+ *            o bit 0 dos contadores de todas as teclas fica em count0 e o
+ *            bit 1 em count1, na posição do pino. Uma amostra atualiza os 32
+ *            contadores com meia dúzia de operações lógicas, sem laço por
+ *            tecla e sem desvios. O contador de uma tecla volta a zero
+ *            quando a amostra é igual ao estado confirmado, e o estado muda
+ *            após 4 amostras seguidas diferentes dele.
+ *
+ *            As teclas são ativas em '0' (pull-up). Os métodos read*
+ *            retornam máscaras na posição dos pinos na porta: o estado
+ *            confirmado (1 = pressionada) e os eventos da última amostra
+ *            (pressionadas, soltas, pressão longa e repetição automática).
+ *
+ *            A pressão longa e a repetição usam um contador de amostras
+ *            por tecla, zerado quando a própria tecla é pressionada: após
+ *            longSamples amostras pressionada, readLongPressed retorna a
+ *            tecla; depois, a cada repeatSamples amostras, readRepeated a
+ *            retorna de novo. Teclas pressionadas juntas têm tempos
+ *            independentes: pressionar ou soltar uma não reinicia a outra.
+ *            Esse contador também é vertical (hold[k] guarda o bit k das
+ *            contagens de todas as teclas): a amostra avança e compara os
+ *            32 contadores com algumas operações lógicas por bit, só nos
+ *            bits necessários para longSamples + repeatSamples (7 bits
+ *            para 100 e 20), sem laço por tecla. Com longSamples = 0
+ *            (padrão), esses eventos ficam desligados.
+ *
+ *            sample() e as leituras dos eventos devem ser feitas no mesmo
+ *            contexto (na mesma tarefa, por exemplo): os eventos valem até
+ *            a próxima amostra.
+ *
+ *  @section  EXAMPLES USAGE
+ *
+ *             +fn mkl_GPIOBusDebouncer keys(gpio_GPIOB,
+ *                                           mkl_GPIOBus::pinMask(gpio_PTB8) |
+ *                                           mkl_GPIOBus::pinMask(gpio_PTB10));
+ *             +fn keys.setPortMode(gpio_input);
+ *             +fn keys.setPullResistor(gpio_pullUpResistor);
+ *             +fn keys.setHoldTimes(100, 20);     // 1 s e 200 ms com 10 ms
+ *             +fn keys.sample();                  // a cada 10 ms
+ *             +fn if (keys.readPressed() & mkl_GPIOBus::pinMask(gpio_PTB8))
+ */
+class mkl_GPIOBusDebouncer : public mkl_GPIOBus {
+ public:
+  mkl_GPIOBusDebouncer(gpio_Name gpio, uint32_t mask);
+  void setHoldTimes(uint16_t longSamples, uint16_t repeatSamples);
+  void sample();
+  uint32_t readState() const { return state; }
+  uint32_t readPressed() const { return pressed; }
+  uint32_t readReleased() const { return released; }
+  uint32_t readLongPressed() const { return longPressed; }
+  uint32_t readRepeated() const { return repeated; }
+
+ private:
+  /*!
+   * Estado confirmado e contadores verticais (bits 0 e 1).
+   */
+  uint32_t state;
+  uint32_t count0;
+  uint32_t count1;
+  /*!
+   * Eventos da última amostra.
+   */
+  uint32_t pressed;
+  uint32_t released;
+  uint32_t longPressed;
+  uint32_t repeated;
+  /*!
+   * Bits do contador vertical de amostras pressionada, suficientes para
+   * 65535 + 65535.
+   */
+  static const uint8_t kHoldBits = 17;
+  /*!
+   * Contador vertical de amostras pressionada (bit k em hold[k]), número
+   * de bits em uso e limites da pressão longa e da repetição.
+   */
+  uint32_t hold[kHoldBits];
+  uint8_t holdBits;
+  uint32_t longSamples;
+  uint32_t wrapSamples;
+  bool repeatEnabled;
+};
+
+#endif  //  MKL_GPIOBUSDEBOUNCER_H_
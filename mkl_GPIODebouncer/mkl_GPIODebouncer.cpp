@@ -0,0 +1,112 @@
+/*!
+ * @copyright   © 2017 UFAM - Universidade Federal do Amazonas.
+ *
+ * @brief       Tecla com interrupção por borda e confirmação por temporizador (debounce).
+ *
+ * @file        mkl_GPIODebouncer.cpp
+ * @version     1.0
+ * @date        17 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   GPIO, PORT (IRQC) e PIT.
+ *              +compiler     Kinetis® Design Studio IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão (data): Descrição breve.
+ *                             ++ 1.0 (17 Outubro 2026): Versão inicial.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas
+ *              +courses      Engenharia da Computação
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Versão inicial:
+ *                             ++ Patrick Chagas dos Santos <patrick.chagas@gmail.com>
+ *                             ++ Gabriel Montenegro Villacrez <gvmontenegro19@gmail.com>
+ *                             ++ Andrezza Bonfim <andrezzabonfiiim@gmail.com>
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ *              Este programa é um software livre; Você pode redistribuí-lo
+ *              e/ou modificá-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              versão 3 da licença, ou qualquer versão posterior.
+ *
+ *              Este programa é distribuído na esperança de que seja útil,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implícita de
+ *              COMERCIALIZAÇÃO OU USO PARA UM DETERMINADO PROPÓSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include "mkl_GPIODebouncer.h"
+
+/*!
+ *   @fn         mkl_GPIODebouncer
+ *
+ *   @brief      Associa o pino e a roda dos temporizadores de confirmação.
+ */
+mkl_GPIODebouncer::mkl_GPIODebouncer(gpio_Pin pin, mkl_PITTimerWheel *wheel)
+    : mkl_GPIOPort(pin), wheel(wheel), debounceTicks(1), callback(0),
+      context(0), level(1) {
+}
+
+/*!
+ *   @fn         setCallback
+ *
+ *   @brief      Associa a rotina chamada a cada mudança confirmada do nível.
+ */
+void mkl_GPIODebouncer::setCallback(mkl_TimerCallback callback,
+                                    void *context) {
+  this->callback = callback;
+  this->context = context;
+}
+
+/*!
+ *   @fn         start
+ *
+ *   @brief      Configura o pino como entrada com pull-up e habilita a
+ *               interrupção nas duas bordas.
+ *
+ *   @param[in]  debounceTicks - janela de confirmação, em ticks da roda.
+ */
+void mkl_GPIODebouncer::start(uint32_t debounceTicks) {
+  this->debounceTicks = debounceTicks;
+  timer.setCallback(onTimeout, this);
+  setPortMode(gpio_input);
+  setPullResistor(gpio_pullUpResistor);
+  level = readBit();
+  attachInterrupt(onEdge, this);
+  setInterruptMode(gpio_interruptBothEdges);
+}
+
+/*!
+ *   @fn         onEdge
+ *
+ *   @brief      Primeira borda: mascara as demais e agenda a confirmação.
+ */
+void mkl_GPIODebouncer::onEdge(void *debouncer) {
+  mkl_GPIODebouncer *self = static_cast<mkl_GPIODebouncer *>(debouncer);
+  self->setInterruptMode(gpio_interruptDisabled);
+  self->wheel->startTimer(self->timer, self->debounceTicks);
+}
+
+/*!
+ *   @fn         onTimeout
+ *
+ *   @brief      Confirmação: reabilita as bordas e compara o nível.
+ */
+void mkl_GPIODebouncer::onTimeout(void *debouncer) {
+  mkl_GPIODebouncer *self = static_cast<mkl_GPIODebouncer *>(debouncer);
+  self->setInterruptMode(gpio_interruptBothEdges);
+  uint8_t now = self->readBit();
+  if (now != self->level) {
+    self->level = now;
+    if (self->callback) {
+      self->callback(self->context);
+    }
+  }
+}
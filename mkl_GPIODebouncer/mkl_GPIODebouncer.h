@@ -0,0 +1,110 @@
+/*!
+ * @copyright   © 2017 UFAM - Universidade Federal do Amazonas.
+ *
+ * @brief       Tecla com interrupção por borda e confirmação por temporizador (debounce).
+ *
+ * @file        mkl_GPIODebouncer.h
+ * @version     1.1
+ * @date        17 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   GPIO, PORT (IRQC) e PIT.
+ *              +compiler     Kinetis® Design Studio IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão (data): Descrição breve.
+ *                             ++ 1.0 (17 Outubro 2026): Versão inicial.
+ *                             ++ 1.1 (17 Outubro 2026): Documenta o startTimer na interrupção da porta.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas
+ *              +courses      Engenharia da Computação
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Versão inicial:
+ *                             ++ Patrick Chagas dos Santos <patrick.chagas@gmail.com>
+ *                             ++ Gabriel Montenegro Villacrez <gvmontenegro19@gmail.com>
+ *                             ++ Andrezza Bonfim <andrezzabonfiiim@gmail.com>
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ *              Este programa é um software livre; Você pode redistribuí-lo
+ *              e/ou modificá-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              versão 3 da licença, ou qualquer versão posterior.
+ *
+ *              Este programa é distribuído na esperança de que seja útil,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implícita de
+ *              COMERCIALIZAÇÃO OU USO PARA UM DETERMINADO PROPÓSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#ifndef MKL_GPIODEBOUNCER_H_
+#define MKL_GPIODEBOUNCER_H_
+
+#include <stdint.h>
+#include <mkl_GPIOPort/mkl_GPIOPort.h>
+#include <mkl_PITTimerWheel/mkl_PITTimerWheel.h>
+
+/*!
+ *  @class    mkl_GPIODebouncer
+ *
+ *  @brief    Entrada digital com debounce disparado pela interrupção do pino.
+ *
+ *  @details  Não há amostragem periódica: a primeira borda do repique
+ *            desabilita a interrupção do pino e inicia um temporizador de
+ *            debounceTicks na roda. No estouro, a interrupção é reabilitada
+ *            e o pino é lido uma única vez; se o nível difere do último
+ *            confirmado, ele é atualizado e a rotina registrada é chamada,
+ *            na interrupção do PIT. Entre os eventos a CPU não executa nada,
+ *            e a latência é de debounceTicks.
+ *
+ *            A interrupção é reabilitada antes da leitura: uma mudança
+ *            durante a janela é vista na leitura, e uma mudança após a
+ *            reabilitação gera nova borda e nova confirmação.
+ *
+ *            Entrada com pull-up: a tecla ligada ao terra é lida em '0'
+ *            quando pressionada (isPressed). Só os pinos do PORTA e do PORTD
+ *            geram interrupção no KL25; a rotina de serviço da porta deve
+ *            chamar mkl_GPIO::handleInterrupt.
+ *
+ *            A borda chama wheel->startTimer na interrupção da porta,
+ *            enquanto a roda mexe nas suas listas na interrupção do PIT. As
+ *            duas podem ter prioridades diferentes: a roda mascara as
+ *            interrupções (PRIMASK) em startTimer e nos trechos de
+ *            tick/handleInterrupt que mexem nas listas.
+ *
+ *  @section  EXAMPLES USAGE
+ *
+ *             +fn mkl_GPIODebouncer key(gpio_PTA12, &wheel);
+ *             +fn key.setCallback(mkl_Scheduler::postTask, &keyTask);
+ *             +fn key.start(20);                          // 20 ticks
+ *             +fn void PORTA_IRQHandler() {
+ *                   mkl_GPIO::handleInterrupt(gpio_GPIOA); }
+ *             +fn if (key.isPressed()) { ... }
+ */
+class mkl_GPIODebouncer : public mkl_GPIOPort {
+ public:
+  mkl_GPIODebouncer(gpio_Pin pin, mkl_PITTimerWheel *wheel);
+  void setCallback(mkl_TimerCallback callback, void *context);
+  void start(uint32_t debounceTicks);
+  int readLevel() const { return level; }
+  bool isPressed() const { return level == 0; }
+
+ private:
+  mkl_PITTimerWheel *wheel;
+  mkl_SoftTimer timer;
+  uint32_t debounceTicks;
+  mkl_TimerCallback callback;
+  void *context;
+  volatile uint8_t level;
+
+  static void onEdge(void *debouncer);
+  static void onTimeout(void *debouncer);
+};
+
+#endif  //  MKL_GPIODEBOUNCER_H_
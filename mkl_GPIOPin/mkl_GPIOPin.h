@@ -0,0 +1,223 @@
+/*!
+ * @copyright   © 2017 UFAM - Universidade Federal do Amazonas.
+ *
+ * @brief       Interface de programação de aplicações em C++ para GPIO com pino definido em tempo de compilação.
+ *
+ * @file        mkl_GPIOPin.h
+ * @version     1.0
+ * @date        17 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   GPIO e PORT.
+ *              +compiler     Kinetis® Design Studio IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão (data): Descrição breve.
+ *                             ++ 1.0 (17 Outubro 2026): Versão inicial.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas
+ *              +courses      Engenharia da Computação
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Versão inicial:
+ *                             ++ Patrick Chagas dos Santos <patrick.chagas@gmail.com>
+ *                             ++ Gabriel Montenegro Villacrez <gvmontenegro19@gmail.com>
+ *                             ++ Andrezza Bonfim <andrezzabonfiiim@gmail.com>
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ *              Este programa é um software livre; Você pode redistribuí-lo
+ *              e/ou modificá-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              versão 3 da licença, ou qualquer versão posterior.
+ *
+ *              Este programa é distribuído na esperança de que seja útil,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implícita de
+ *              COMERCIALIZAÇÃO OU USO PARA UM DETERMINADO PROPÓSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#ifndef MKL_GPIOPIN_H_
+#define MKL_GPIOPIN_H_
+
+#include <stdint.h>
+#include <MKL25Z4.h>
+#include "mkl_GPIO/mkl_GPIO.h"
+
+/*!
+ *  @class    mkl_GPIOPin
+ *
+ *  @brief    A classe implementa um pino GPIO fixado em tempo de compilação.
+ *
+ *  @details  Esta classe é a versão estática da classe "mkl_GPIOPort": o pino
+ *            é um parâmetro do template, de modo que os endereços do PDOR,
+ *            PSOR, PCOR, PTOR, PDIR, PDDR e PCR e a máscara do pino são
+ *            constantes. Os objetos não ocupam RAM (podem ser declarados
+ *            constexpr) e cada escrita compila para um único store com
+ *            endereço e máscara imediatos.
+ *
+ *            A classe "mkl_GPIOPort" continua disponível para pinos escolhidos
+ *            em tempo de execução.
+ *
+ *  @section  EXAMPLES USAGE
+ *
+ *            Declaração e inicialização do pino.
+ *             +fn constexpr mkl_GPIOPin<gpio_PTD1> blueLed;
+ *             +fn blueLed.setupPin();
+ *
+ *            Uso dos métodos como porta de saída.
+ *             +fn blueLed.setPortMode(gpio_output);
+ *             +fn blueLed.setBit();
+ *             +fn blueLed.toogleBit();
+ *
+ *            Uso dos métodos como porta de entrada.
+ *             +fn key.setPortMode(gpio_input);
+ *             +fn key.setPullResistor(gpio_pullUpResistor);
+ *             +fn data = key.readBit();
+ */
+template <gpio_Pin pin>
+class mkl_GPIOPin {
+ public:
+  /*!
+   * Construtor padrão da classe, sem acesso ao hardware.
+   */
+  constexpr mkl_GPIOPin() {}
+
+  /*!
+   * Números do GPIO e do pino e máscara do pino.
+   */
+  static const uint32_t GPIONumber = static_cast<uint32_t>(pin) >> 8;
+  static const uint32_t pinNumber = static_cast<uint32_t>(pin) & 0xFF;
+  static const uint32_t pinMask = 1u << pinNumber;
+
+  /*!
+   * Endereços dos registradores do pino no mapa de memória.
+   */
+  static const uint32_t addressPDOR = GPIOA_BASE + 0x40*GPIONumber + 0x0;
+  static const uint32_t addressPSOR = GPIOA_BASE + 0x40*GPIONumber + 0x4;
+  static const uint32_t addressPCOR = GPIOA_BASE + 0x40*GPIONumber + 0x8;
+  static const uint32_t addressPTOR = GPIOA_BASE + 0x40*GPIONumber + 0xC;
+  static const uint32_t addressPDIR = GPIOA_BASE + 0x40*GPIONumber + 0x10;
+  static const uint32_t addressPDDR = GPIOA_BASE + 0x40*GPIONumber + 0x14;
+  static const uint32_t addressPortxPCRn = PORTA_BASE + 0x1000*GPIONumber
+                                           + 4*pinNumber;
+
+  /*!
+   *   @fn       setupPin
+   *
+   *   @brief    Habilita o clock do PORT e seleciona o modo GPIO do pino.
+   *
+   *   @remarks  Siglas e páginas do Manual de Referência KL25:
+   *             - SIM_SCGC5: System Clock Gating Control Register 5. Pág. 206.
+   *             - PortxPCRn: Pin Control Register. Pág. 183 (Mux).
+   */
+  static void setupPin() {
+    SIM_SCGC5 |= SIM_SCGC5_PORTA_MASK << GPIONumber;
+    reg(addressPortxPCRn) = PORT_PCR_MUX(1);
+  }
+
+  /*!
+   *   @fn       setPortMode
+   *
+   *   @brief    Seleciona o modo de operação (entrada ou saída) do pino.
+   *
+   *   @remarks  Siglas e páginas do Manual de Referência KL25:
+   *             - PDDR: Port Data Direction Register. Pág. 778.
+   */
+  static void setPortMode(gpio_PortMode mode) {
+    if (mode == gpio_input) {
+      reg(addressPDDR) &= ~pinMask;
+    } else {
+      reg(addressPDDR) |= pinMask;
+    }
+  }
+
+  /*!
+   *   @fn       setPullResistor
+   *
+   *   @brief    Ajusta o resistor de pull do pino de entrada.
+   *
+   *   @remarks  Siglas e páginas do Manual de Referência KL25:
+   *             - PortxPCRn: Pin Control Register. Pág. 185 (Pull).
+   */
+  static void setPullResistor(gpio_PullResistor pull) {
+    reg(addressPortxPCRn) = (reg(addressPortxPCRn)
+                             & ~(PORT_PCR_PS_MASK | PORT_PCR_PE_MASK)) | pull;
+  }
+
+  /*!
+   *   @fn       writeBit
+   *
+   *   @brief    Escreve o valor de "bit" no pino, com um store no PSOR ou PCOR.
+   */
+  static void writeBit(int bit) {
+    if (bit) {
+      setBit();
+    } else {
+      clearBit();
+    }
+  }
+
+  /*!
+   *   @fn       setBit
+   *
+   *   @brief    Coloca o pino em '1' com um único store no PSOR.
+   *
+   *   @remarks  Siglas e páginas do Manual de Referência KL25:
+   *             - PSOR: Port Set Output Register. Pág. 776.
+   */
+  static void setBit() {
+    reg(addressPSOR) = pinMask;
+  }
+
+  /*!
+   *   @fn       clearBit
+   *
+   *   @brief    Coloca o pino em '0' com um único store no PCOR.
+   *
+   *   @remarks  Siglas e páginas do Manual de Referência KL25:
+   *             - PCOR: Port Clear Output Register. Pág. 776.
+   */
+  static void clearBit() {
+    reg(addressPCOR) = pinMask;
+  }
+
+  /*!
+   *   @fn       toogleBit
+   *
+   *   @brief    Inverte o pino com um único store no PTOR.
+   *
+   *   @remarks  Siglas e páginas do Manual de Referência KL25:
+   *             - PTOR: Port Toogle Output Register. Pág. 777.
+   */
+  static void toogleBit() {
+    reg(addressPTOR) = pinMask;
+  }
+
+  /*!
+   *   @fn       readBit
+   *
+   *   @brief    Lê o pino de entrada.
+   *
+   *   @return   O valor do bit presente no pino.
+   *
+   *   @remarks  Siglas e páginas do Manual de Referência KL25:
+   *             - PDIR: Port Data Input Register. Pág. 777.
+   */
+  static int readBit() {
+    return (reg(addressPDIR) & pinMask) ? 1 : 0;
+  }
+
+ private:
+  static volatile uint32_t &reg(uint32_t address) {
+    return *reinterpret_cast<volatile uint32_t *>(
+        static_cast<uintptr_t>(address));
+  }
+};
+
+#endif  //  MKL_GPIOPIN_H_
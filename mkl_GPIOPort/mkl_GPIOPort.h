@@ -1,64 +1,64 @@
-/*!
- * @copyright    2017 UFAM - Universidade Federal do Amazonas.
- *
- * @brief       Interface de programao de aplicaes em C++ para GPIO.
- *
- * @file        mkl_GPIOPort.h
- * @version     1.0
- * @date        6 Julho 2017
- *
- * @section     HARDWARES & SOFTWARES
- *              +board        FRDM-KL25Z da NXP.
- *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+
- *              +compiler     Kinetis Design Studio IDE
- *              +manual       L25P80M48SF0RM, Rev.3, September 2012
- *              +revisions    Verso (data): Descrio breve.
- *                             ++ 1.0 (30 Julho 2017): Verso inicial.
- *
- * @section     AUTHORS & DEVELOPERS
- *              +institution  Universidade Federal do Amazonas
- *              +courses      Engenharia da Computao / Engenharia Eltrica
- *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
- *              +student      Verso inicial:
- *                             ++ Hamilton Nascimento <hdan_neto@hotmail.com>
- *
- * @section     LICENSE
- *
- *              GNU General Public License (GNU GPL)
- *
- *              Este programa  um software livre; Voc pode redistribu-lo
- *              e/ou modific-lo de acordo com os termos do "GNU General Public
- *              License" como publicado pela Free Software Foundation; Seja a
- *              verso 3 da licena, ou qualquer verso posterior.
- *
- *              Este programa  distribudo na esperana de que seja til,
- *              mas SEM QUALQUER GARANTIA; Sem a garantia implcita de
- *              COMERCIALIZAO OU USO PARA UM DETERMINADO PROPSITO.
- *              Veja o site da "GNU General Public License" para mais detalhes.
- *
- * @htmlonly    http://www.gnu.org/copyleft/gpl.html
- */
-
-#ifndef MKL_GPIOPORT_H_
-#define MKL_GPIOPORT_H_
-
-#include "mkl_GPIO/mkl_GPIO.h"
-
-/*!
- *  @class    mkl_GPIOPort.
- *
- *  @brief    A classe implementa o perifrico GPIO sem interrupo.
- *
- *  @details  Esta classe  derivada da classe me "mkl_GPIO" e implementa
- *            o perifrico GPIO com o modo de operao sem interrupo.
- *
- */
-class mkl_GPIOPort : public mkl_GPIO {
- public:
-  /*!
-   * Construtor padro da classe.
-   */
-  explicit mkl_GPIOPort(gpio_Pin pin = gpio_PTA1);
-};
-
-#endif  //  MKL_GPIOPORT_H_
+/*!
+ * @copyright   © 2017 UFAM - Universidade Federal do Amazonas.
+ *
+ * @brief       Interface de programação de aplicações em C++ para GPIO.
+ *
+ * @file        mkl_GPIOPort.h
+ * @version     1.0
+ * @date        6 Julho 2017
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+
+ *              +compiler     Kinetis® Design Studio IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão (data): Descrição breve.
+ *                             ++ 1.0 (30 Julho 2017): Versão inicial.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas
+ *              +courses      Engenharia da Computação / Engenharia Elétrica
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Versão inicial:
+ *                             ++ Hamilton Nascimento <hdan_neto@hotmail.com>
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL)
+ *
+ *              Este programa é um software livre; Você pode redistribuí-lo
+ *              e/ou modificá-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              versão 3 da licença, ou qualquer versão posterior.
+ *
+ *              Este programa é distribuído na esperança de que seja útil,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implícita de
+ *              COMERCIALIZAÇÃO OU USO PARA UM DETERMINADO PROPÓSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#ifndef MKL_GPIOPORT_H_
+#define MKL_GPIOPORT_H_
+
+#include "mkl_GPIO/mkl_GPIO.h"
+
+/*!
+ *  @class    mkl_GPIOPort.
+ *
+ *  @brief    A classe implementa o periférico GPIO sem interrupção.
+ *
+ *  @details  Esta classe é derivada da classe mãe "mkl_GPIO" e implementa
+ *            o periférico GPIO com o modo de operação sem interrupção.
+ *
+ */
+class mkl_GPIOPort : public mkl_GPIO {
+ public:
+  /*!
+   * Construtor padrão da classe.
+   */
+  explicit mkl_GPIOPort(gpio_Pin pin = gpio_PTA1);
+};
+
+#endif  //  MKL_GPIOPORT_H_
@@ -0,0 +1,476 @@
+/*!
+ * @copyright   © 2017 UFAM - Universidade Federal do Amazonas.
+ *
+ * @brief       Mapa de registradores da MKL25Z4 para compilação no host (Linux).
+ *
+ * @file        MKL25Z4.h
+ * @version     1.3
+ * @date        17 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   SIM, PORT, GPIO, PIT, TPM, SPI, DMA, NVIC e SysTick simulados.
+ *              +compiler     Kinetis® Design Studio IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão (data): Descrição breve.
+ *                             ++ 1.0 (17 Outubro 2026): Versão inicial.
+ *                             ++ 1.1 (17 Outubro 2026): Modelo do SPI.
+ *                             ++ 1.2 (17 Outubro 2026): Modelo do SysTick.
+ *                             ++ 1.3 (17 Outubro 2026): readPrimask, para __get_PRIMASK/__set_PRIMASK.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas
+ *              +courses      Engenharia da Computação
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Versão inicial:
+ *                             ++ Patrick Chagas dos Santos <patrick.chagas@gmail.com>
+ *                             ++ Gabriel Montenegro Villacrez <gvmontenegro19@gmail.com>
+ *                             ++ Andrezza Bonfim <andrezzabonfiiim@gmail.com>
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ *              Este programa é um software livre; Você pode redistribuí-lo
+ *              e/ou modificá-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              versão 3 da licença, ou qualquer versão posterior.
+ *
+ *              Este programa é distribuído na esperança de que seja útil,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implícita de
+ *              COMERCIALIZAÇÃO OU USO PARA UM DETERMINADO PROPÓSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#ifndef MKL25Z4_H_
+#define MKL25Z4_H_
+
+/*!
+ *  Este arquivo substitui o MKL25Z4.h do Kinetis® Design Studio quando os
+ *  drivers mkl_* são compilados no host. Os nomes, endereços e máscaras são
+ *  os mesmos do arquivo original, de modo que os fontes dos drivers compilam
+ *  sem alteração. Os blocos de periféricos ficam mapeados nos seus endereços
+ *  reais pelo simulador mkl_HostSim, que executa a semântica de cada
+ *  registrador a cada acesso.
+ *
+ *  Uso: g++ -I mkl_HostSim -I . <fontes> mkl_HostSim/mkl_HostSim.cpp
+ */
+
+#include <stdint.h>
+#include "mkl_HostSim.h"
+
+/*!
+ *  Números das interrupções da MKL25Z4.
+ */
+typedef enum IRQn {
+  NonMaskableInt_IRQn = -14,
+  HardFault_IRQn      = -13,
+  SVCall_IRQn         = -5,
+  PendSV_IRQn         = -2,
+  SysTick_IRQn        = -1,
+  DMA0_IRQn           = 0,
+  DMA1_IRQn           = 1,
+  DMA2_IRQn           = 2,
+  DMA3_IRQn           = 3,
+  FTFA_IRQn           = 5,
+  LVD_LVW_IRQn        = 6,
+  LLW_IRQn            = 7,
+  I2C0_IRQn           = 8,
+  I2C1_IRQn           = 9,
+  SPI0_IRQn           = 10,
+  SPI1_IRQn           = 11,
+  UART0_IRQn          = 12,
+  UART1_IRQn          = 13,
+  UART2_IRQn          = 14,
+  ADC0_IRQn           = 15,
+  CMP0_IRQn           = 16,
+  TPM0_IRQn           = 17,
+  TPM1_IRQn           = 18,
+  TPM2_IRQn           = 19,
+  RTC_IRQn            = 20,
+  RTC_Seconds_IRQn    = 21,
+  PIT_IRQn            = 22,
+  USB0_IRQn           = 24,
+  DAC0_IRQn           = 25,
+  TSI0_IRQn           = 26,
+  MCG_IRQn            = 27,
+  LPTimer_IRQn        = 28,
+  PORTA_IRQn          = 30,
+  PORTD_IRQn          = 31
+} IRQn_Type;
+
+/*!
+ *  Endereços base dos periféricos.
+ */
+#define DMA_BASE      (0x40008000u)
+#define DMAMUX0_BASE  (0x40021000u)
+#define PIT_BASE      (0x40037000u)
+#define TPM0_BASE     (0x40038000u)
+#define TPM1_BASE     (0x40039000u)
+#define TPM2_BASE     (0x4003A000u)
+#define SIM_BASE      (0x40047000u)
+#define SPI0_BASE     (0x40076000u)
+#define SPI1_BASE     (0x40077000u)
+#define PORTA_BASE    (0x40049000u)
+#define PORTB_BASE    (0x4004A000u)
+#define PORTC_BASE    (0x4004B000u)
+#define PORTD_BASE    (0x4004C000u)
+#define PORTE_BASE    (0x4004D000u)
+#define GPIOA_BASE    (0x400FF000u)
+#define GPIOB_BASE    (0x400FF040u)
+#define GPIOC_BASE    (0x400FF080u)
+#define GPIOD_BASE    (0x400FF0C0u)
+#define GPIOE_BASE    (0x400FF100u)
+#define NVIC_BASE     (0xE000E100u)
+
+/*!
+ *  SIM - System Integration Module.
+ */
+typedef struct {
+  volatile uint32_t SOPT1;
+  volatile uint32_t SOPT1CFG;
+  uint8_t RESERVED_0[4092];
+  volatile uint32_t SOPT2;
+  uint8_t RESERVED_1[4];
+  volatile uint32_t SOPT4;
+  volatile uint32_t SOPT5;
+  uint8_t RESERVED_2[4];
+  volatile uint32_t SOPT7;
+  uint8_t RESERVED_3[8];
+  volatile uint32_t SDID;
+  uint8_t RESERVED_4[12];
+  volatile uint32_t SCGC4;
+  volatile uint32_t SCGC5;
+  volatile uint32_t SCGC6;
+  volatile uint32_t SCGC7;
+  volatile uint32_t CLKDIV1;
+} SIM_Type;
+
+#define SIM                        ((SIM_Type *)SIM_BASE)
+#define SIM_SOPT2                  (SIM->SOPT2)
+#define SIM_SCGC4                  (SIM->SCGC4)
+#define SIM_SCGC5                  (SIM->SCGC5)
+#define SIM_SCGC6                  (SIM->SCGC6)
+#define SIM_SCGC7                  (SIM->SCGC7)
+
+#define SIM_SOPT2_TPMSRC_MASK      0x3000000u
+#define SIM_SOPT2_TPMSRC_SHIFT     24
+#define SIM_SOPT2_TPMSRC(x)        (((uint32_t)(((uint32_t)(x)) << SIM_SOPT2_TPMSRC_SHIFT)) & SIM_SOPT2_TPMSRC_MASK)
+#define SIM_SCGC4_SPI0_MASK        0x400000u
+#define SIM_SCGC4_SPI1_MASK        0x800000u
+#define SIM_SCGC5_PORTA_MASK       0x200u
+#define SIM_SCGC5_PORTB_MASK       0x400u
+#define SIM_SCGC5_PORTC_MASK       0x800u
+#define SIM_SCGC5_PORTD_MASK       0x1000u
+#define SIM_SCGC5_PORTE_MASK       0x2000u
+#define SIM_SCGC6_DMAMUX_MASK      0x2u
+#define SIM_SCGC6_PIT_MASK         0x800000u
+#define SIM_SCGC6_TPM0_MASK        0x1000000u
+#define SIM_SCGC6_TPM1_MASK        0x2000000u
+#define SIM_SCGC6_TPM2_MASK        0x4000000u
+#define SIM_SCGC7_DMA_MASK         0x100u
+
+/*!
+ *  PORT - Pin Control and Interrupts.
+ */
+typedef struct {
+  volatile uint32_t PCR[32];
+  volatile uint32_t GPCLR;
+  volatile uint32_t GPCHR;
+  uint8_t RESERVED_0[24];
+  volatile uint32_t ISFR;
+} PORT_Type;
+
+#define PORTA                      ((PORT_Type *)PORTA_BASE)
+#define PORTB                      ((PORT_Type *)PORTB_BASE)
+#define PORTC                      ((PORT_Type *)PORTC_BASE)
+#define PORTD                      ((PORT_Type *)PORTD_BASE)
+#define PORTE                      ((PORT_Type *)PORTE_BASE)
+
+#define PORT_PCR_PS_MASK           0x1u
+#define PORT_PCR_PE_MASK           0x2u
+#define PORT_PCR_SRE_MASK          0x4u
+#define PORT_PCR_PFE_MASK          0x10u
+#define PORT_PCR_DSE_MASK          0x40u
+#define PORT_PCR_MUX_MASK          0x700u
+#define PORT_PCR_MUX_SHIFT         8
+#define PORT_PCR_MUX(x)            (((uint32_t)(((uint32_t)(x)) << PORT_PCR_MUX_SHIFT)) & PORT_PCR_MUX_MASK)
+#define PORT_PCR_IRQC_MASK         0xF0000u
+#define PORT_PCR_IRQC_SHIFT        16
+#define PORT_PCR_IRQC(x)           (((uint32_t)(((uint32_t)(x)) << PORT_PCR_IRQC_SHIFT)) & PORT_PCR_IRQC_MASK)
+#define PORT_PCR_ISF_MASK          0x1000000u
+
+/*!
+ *  GPIO - General Purpose Input/Output.
+ */
+typedef struct {
+  volatile uint32_t PDOR;
+  volatile uint32_t PSOR;
+  volatile uint32_t PCOR;
+  volatile uint32_t PTOR;
+  volatile uint32_t PDIR;
+  volatile uint32_t PDDR;
+} GPIO_Type;
+
+#define GPIOA                      ((GPIO_Type *)GPIOA_BASE)
+#define GPIOB                      ((GPIO_Type *)GPIOB_BASE)
+#define GPIOC                      ((GPIO_Type *)GPIOC_BASE)
+#define GPIOD                      ((GPIO_Type *)GPIOD_BASE)
+#define GPIOE                      ((GPIO_Type *)GPIOE_BASE)
+
+/*!
+ *  PIT - Periodic Interrupt Timer.
+ */
+typedef struct {
+  volatile uint32_t MCR;
+  uint8_t RESERVED_0[220];
+  volatile uint32_t LTMR64H;
+  volatile uint32_t LTMR64L;
+  uint8_t RESERVED_1[24];
+  struct {
+    volatile uint32_t LDVAL;
+    volatile uint32_t CVAL;
+    volatile uint32_t TCTRL;
+    volatile uint32_t TFLG;
+  } CHANNEL[2];
+} PIT_Type;
+
+#define PIT                        ((PIT_Type *)PIT_BASE)
+#define PIT_MCR                    (PIT->MCR)
+#define PIT_LTMR64H                (PIT->LTMR64H)
+#define PIT_LTMR64L                (PIT->LTMR64L)
+#define PIT_LDVAL0                 (PIT->CHANNEL[0].LDVAL)
+#define PIT_CVAL0                  (PIT->CHANNEL[0].CVAL)
+#define PIT_TCTRL0                 (PIT->CHANNEL[0].TCTRL)
+#define PIT_TFLG0                  (PIT->CHANNEL[0].TFLG)
+#define PIT_LDVAL1                 (PIT->CHANNEL[1].LDVAL)
+#define PIT_CVAL1                  (PIT->CHANNEL[1].CVAL)
+#define PIT_TCTRL1                 (PIT->CHANNEL[1].TCTRL)
+#define PIT_TFLG1                  (PIT->CHANNEL[1].TFLG)
+
+#define PIT_MCR_FRZ_MASK           0x1u
+#define PIT_MCR_MDIS_MASK          0x2u
+#define PIT_TCTRL_TEN_MASK         0x1u
+#define PIT_TCTRL_TIE_MASK         0x2u
+#define PIT_TCTRL_CHN_MASK         0x4u
+#define PIT_TFLG_TIF_MASK          0x1u
+
+/*!
+ *  TPM - Timer/PWM Module.
+ */
+typedef struct {
+  volatile uint32_t SC;
+  volatile uint32_t CNT;
+  volatile uint32_t MOD;
+  struct {
+    volatile uint32_t CnSC;
+    volatile uint32_t CnV;
+  } CONTROLS[6];
+  uint8_t RESERVED_0[20];
+  volatile uint32_t STATUS;
+  uint8_t RESERVED_1[48];
+  volatile uint32_t CONF;
+} TPM_Type;
+
+#define TPM0                       ((TPM_Type *)TPM0_BASE)
+#define TPM1                       ((TPM_Type *)TPM1_BASE)
+#define TPM2                       ((TPM_Type *)TPM2_BASE)
+
+#define TPM_SC_PS_MASK             0x7u
+#define TPM_SC_PS(x)               (((uint32_t)(x)) & TPM_SC_PS_MASK)
+#define TPM_SC_CMOD_MASK           0x18u
+#define TPM_SC_CMOD_SHIFT          3
+#define TPM_SC_CMOD(x)             (((uint32_t)(((uint32_t)(x)) << TPM_SC_CMOD_SHIFT)) & TPM_SC_CMOD_MASK)
+#define TPM_SC_CPWMS_MASK          0x20u
+#define TPM_SC_TOIE_MASK           0x40u
+#define TPM_SC_TOF_MASK            0x80u
+#define TPM_SC_DMA_MASK            0x100u
+#define TPM_CnSC_DMA_MASK          0x1u
+#define TPM_CnSC_ELSA_MASK         0x4u
+#define TPM_CnSC_ELSB_MASK         0x8u
+#define TPM_CnSC_MSA_MASK          0x10u
+#define TPM_CnSC_MSB_MASK          0x20u
+#define TPM_CnSC_CHIE_MASK         0x40u
+#define TPM_CnSC_CHF_MASK          0x80u
+#define TPM_STATUS_TOF_MASK        0x100u
+
+/*!
+ *  SPI - Serial Peripheral Interface (8 bits).
+ */
+typedef struct {
+  volatile uint8_t C1;
+  volatile uint8_t C2;
+  volatile uint8_t BR;
+  volatile uint8_t S;
+  uint8_t RESERVED_0[1];
+  volatile uint8_t D;
+  uint8_t RESERVED_1[1];
+  volatile uint8_t M;
+} SPI_Type;
+
+#define SPI0                       ((SPI_Type *)SPI0_BASE)
+#define SPI1                       ((SPI_Type *)SPI1_BASE)
+
+#define SPI_C1_LSBFE_MASK          0x1u
+#define SPI_C1_SSOE_MASK           0x2u
+#define SPI_C1_CPHA_MASK           0x4u
+#define SPI_C1_CPOL_MASK           0x8u
+#define SPI_C1_MSTR_MASK           0x10u
+#define SPI_C1_SPTIE_MASK          0x20u
+#define SPI_C1_SPE_MASK            0x40u
+#define SPI_C1_SPIE_MASK           0x80u
+#define SPI_C2_SPC0_MASK           0x1u
+#define SPI_C2_SPISWAI_MASK        0x2u
+#define SPI_C2_RXDMAE_MASK         0x4u
+#define SPI_C2_BIDIROE_MASK        0x8u
+#define SPI_C2_MODFEN_MASK         0x10u
+#define SPI_C2_TXDMAE_MASK         0x20u
+#define SPI_C2_SPMIE_MASK          0x80u
+#define SPI_BR_SPR_MASK            0xFu
+#define SPI_BR_SPR(x)              (((uint8_t)(x)) & SPI_BR_SPR_MASK)
+#define SPI_BR_SPPR_MASK           0x70u
+#define SPI_BR_SPPR_SHIFT          4
+#define SPI_BR_SPPR(x)             (((uint8_t)(((uint8_t)(x)) << SPI_BR_SPPR_SHIFT)) & SPI_BR_SPPR_MASK)
+#define SPI_S_MODF_MASK            0x10u
+#define SPI_S_SPTEF_MASK           0x20u
+#define SPI_S_SPMF_MASK            0x40u
+#define SPI_S_SPRF_MASK            0x80u
+
+/*!
+ *  DMA - Direct Memory Access Controller.
+ */
+typedef struct {
+  uint8_t RESERVED_0[256];
+  struct {
+    volatile uint32_t SAR;
+    volatile uint32_t DAR;
+    volatile uint32_t DSR_BCR;
+    volatile uint32_t DCR;
+  } DMA[4];
+} DMA_Type;
+
+#define DMA0                       ((DMA_Type *)DMA_BASE)
+
+#define DMA_DSR_BCR_BCR_MASK       0xFFFFFFu
+#define DMA_DSR_BCR_BCR(x)         (((uint32_t)(x)) & DMA_DSR_BCR_BCR_MASK)
+#define DMA_DSR_BCR_DONE_MASK      0x1000000u
+#define DMA_DSR_BCR_BSY_MASK       0x2000000u
+#define DMA_DSR_BCR_REQ_MASK       0x4000000u
+#define DMA_DSR_BCR_BED_MASK       0x10000000u
+#define DMA_DSR_BCR_BES_MASK       0x20000000u
+#define DMA_DSR_BCR_CE_MASK        0x40000000u
+#define DMA_DCR_LCH2_MASK          0x3u
+#define DMA_DCR_LCH1_MASK          0xCu
+#define DMA_DCR_LINKCC_MASK        0x30u
+#define DMA_DCR_D_REQ_MASK         0x80u
+#define DMA_DCR_DMOD_MASK          0xF00u
+#define DMA_DCR_DMOD_SHIFT         8
+#define DMA_DCR_DMOD(x)            (((uint32_t)(((uint32_t)(x)) << DMA_DCR_DMOD_SHIFT)) & DMA_DCR_DMOD_MASK)
+#define DMA_DCR_SMOD_MASK          0xF000u
+#define DMA_DCR_SMOD_SHIFT         12
+#define DMA_DCR_SMOD(x)            (((uint32_t)(((uint32_t)(x)) << DMA_DCR_SMOD_SHIFT)) & DMA_DCR_SMOD_MASK)
+#define DMA_DCR_START_MASK         0x10000u
+#define DMA_DCR_DSIZE_MASK         0x60000u
+#define DMA_DCR_DSIZE_SHIFT        17
+#define DMA_DCR_DSIZE(x)           (((uint32_t)(((uint32_t)(x)) << DMA_DCR_DSIZE_SHIFT)) & DMA_DCR_DSIZE_MASK)
+#define DMA_DCR_DINC_MASK          0x80000u
+#define DMA_DCR_SSIZE_MASK         0x300000u
+#define DMA_DCR_SSIZE_SHIFT        20
+#define DMA_DCR_SSIZE(x)           (((uint32_t)(((uint32_t)(x)) << DMA_DCR_SSIZE_SHIFT)) & DMA_DCR_SSIZE_MASK)
+#define DMA_DCR_SINC_MASK          0x400000u
+#define DMA_DCR_EADREQ_MASK        0x800000u
+#define DMA_DCR_AA_MASK            0x10000000u
+#define DMA_DCR_CS_MASK            0x20000000u
+#define DMA_DCR_ERQ_MASK           0x40000000u
+#define DMA_DCR_EINT_MASK          0x80000000u
+
+/*!
+ *  DMAMUX - Direct Memory Access Multiplexer.
+ */
+typedef struct {
+  volatile uint8_t CHCFG[4];
+} DMAMUX_Type;
+
+#define DMAMUX0                    ((DMAMUX_Type *)DMAMUX0_BASE)
+
+#define DMAMUX_CHCFG_SOURCE_MASK   0x3Fu
+#define DMAMUX_CHCFG_SOURCE(x)     (((uint8_t)(x)) & DMAMUX_CHCFG_SOURCE_MASK)
+#define DMAMUX_CHCFG_TRIG_MASK     0x40u
+#define DMAMUX_CHCFG_ENBL_MASK     0x80u
+
+/*!
+ *  NVIC - Nested Vectored Interrupt Controller (core_cm0plus.h).
+ */
+typedef struct {
+  volatile uint32_t ISER[1];
+  uint32_t RESERVED0[31];
+  volatile uint32_t ICER[1];
+  uint32_t RSERVED1[31];
+  volatile uint32_t ISPR[1];
+  uint32_t RESERVED2[31];
+  volatile uint32_t ICPR[1];
+  uint32_t RESERVED3[31];
+  uint32_t RESERVED4[64];
+  volatile uint32_t IP[8];
+} NVIC_Type;
+
+#define NVIC                       ((NVIC_Type *)NVIC_BASE)
+
+/*!
+ *  SysTick - System Timer (core_cm0plus.h).
+ */
+typedef struct {
+  volatile uint32_t CTRL;
+  volatile uint32_t LOAD;
+  volatile uint32_t VAL;
+  volatile uint32_t CALIB;
+} SysTick_Type;
+
+#define SysTick_BASE               (0xE000E010u)
+#define SysTick                    ((SysTick_Type *)SysTick_BASE)
+
+#define SysTick_CTRL_ENABLE_Msk    0x1u
+#define SysTick_CTRL_TICKINT_Msk   0x2u
+#define SysTick_CTRL_CLKSOURCE_Msk 0x4u
+#define SysTick_CTRL_COUNTFLAG_Msk 0x10000u
+#define SysTick_LOAD_RELOAD_Msk    0xFFFFFFu
+#define SysTick_VAL_CURRENT_Msk    0xFFFFFFu
+
+static inline void NVIC_EnableIRQ(IRQn_Type IRQn) {
+  NVIC->ISER[0] = (1u << ((uint32_t)(IRQn) & 0x1Fu));
+}
+
+static inline void NVIC_DisableIRQ(IRQn_Type IRQn) {
+  NVIC->ICER[0] = (1u << ((uint32_t)(IRQn) & 0x1Fu));
+}
+
+static inline void NVIC_SetPendingIRQ(IRQn_Type IRQn) {
+  NVIC->ISPR[0] = (1u << ((uint32_t)(IRQn) & 0x1Fu));
+}
+
+static inline void NVIC_ClearPendingIRQ(IRQn_Type IRQn) {
+  NVIC->ICPR[0] = (1u << ((uint32_t)(IRQn) & 0x1Fu));
+}
+
+/*!
+ *  Intrínsecos do núcleo (core_cmInstr.h / core_cmFunc.h).
+ */
+static inline void __enable_irq(void)  { mkl_HostSim::enableIrq(); }
+static inline void __disable_irq(void) { mkl_HostSim::disableIrq(); }
+static inline void __WFI(void)         { mkl_HostSim::waitForInterrupt(); }
+static inline uint32_t __get_PRIMASK(void) { return mkl_HostSim::readPrimask(); }
+static inline void __set_PRIMASK(uint32_t priMask) {
+  if (priMask & 1) {
+    mkl_HostSim::disableIrq();
+  } else {
+    mkl_HostSim::enableIrq();
+  }
+}
+static inline void __NOP(void)         { }
+static inline void __DSB(void)         { }
+static inline void __ISB(void)         { }
+
+#endif  //  MKL25Z4_H_
@@ -0,0 +1,2242 @@
+/*!
+ * @copyright   © 2017 UFAM - Universidade Federal do Amazonas.
+ *
+ * @brief       Implementação do simulador de registradores da MKL25Z4 para o host (Linux).
+ *
+ * @file        mkl_HostSim.cpp
+ * @version     1.10
+ * @date        17 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   SIM, PORT, GPIO, PIT, TPM, SPI, DMA, NVIC e SysTick simulados.
+ *              +compiler     Kinetis® Design Studio IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão (data): Descrição breve.
+ *                             ++ 1.0 (17 Outubro 2026): Versão inicial.
+ *                             ++ 1.1 (17 Outubro 2026): Modelo do SPI.
+ *                             ++ 1.2 (17 Outubro 2026): Modelo do DMA, do DMAMUX e do PCS0 do SPI.
+ *                             ++ 1.3 (17 Outubro 2026): Encadeamento dos canais do PIT (CHN) e LTMR64H/LTMR64L.
+ *                             ++ 1.4 (17 Outubro 2026): Modelo do SysTick.
+ *                             ++ 1.5 (17 Outubro 2026): readPrimask, para __get_PRIMASK/__set_PRIMASK.
+ *                             ++ 1.6 (17 Outubro 2026): Saídas PWM dos canais do TPM nos pinos (ALT3/ALT4).
+ *                             ++ 1.7 (17 Outubro 2026): Captura de entrada do TPM e trens de pulsos nos pinos (startPulseTrain).
+ *                             ++ 1.8 (17 Outubro 2026): Interrupções do SPI (SPIE e SPTIE).
+ *                             ++ 1.9 (17 Outubro 2026): Requisição de DMA do SPI Rx (SPRF com RXDMAE).
+ *                             ++ 1.10 (17 Outubro 2026): Contagem das instruções executadas pela aplicação (countInstructions).
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas
+ *              +courses      Engenharia da Computação
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Versão inicial:
+ *                             ++ Patrick Chagas dos Santos <patrick.chagas@gmail.com>
+ *                             ++ Gabriel Montenegro Villacrez <gvmontenegro19@gmail.com>
+ *                             ++ Andrezza Bonfim <andrezzabonfiiim@gmail.com>
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ *              Este programa é um software livre; Você pode redistribuí-lo
+ *              e/ou modificá-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              versão 3 da licença, ou qualquer versão posterior.
+ *
+ *              Este programa é distribuído na esperança de que seja útil,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implícita de
+ *              COMERCIALIZAÇÃO OU USO PARA UM DETERMINADO PROPÓSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include "mkl_HostSim.h"
+
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <ucontext.h>
+#include <unistd.h>
+
+#include "MKL25Z4.h"
+
+#if !defined(__linux__) || !defined(__x86_64__)
+#error "mkl_HostSim requer Linux x86-64."
+#endif
+
+/*!
+ *  Rotinas de serviço de interrupção da aplicação. As não definidas pela
+ *  aplicação ficam nulas e o seu atendimento aborta a simulação.
+ */
+extern "C" {
+void PIT_IRQHandler(void) __attribute__((weak));
+void TPM0_IRQHandler(void) __attribute__((weak));
+void TPM1_IRQHandler(void) __attribute__((weak));
+void TPM2_IRQHandler(void) __attribute__((weak));
+void PORTA_IRQHandler(void) __attribute__((weak));
+void PORTD_IRQHandler(void) __attribute__((weak));
+void DMA0_IRQHandler(void) __attribute__((weak));
+void DMA1_IRQHandler(void) __attribute__((weak));
+void DMA2_IRQHandler(void) __attribute__((weak));
+void DMA3_IRQHandler(void) __attribute__((weak));
+void SPI0_IRQHandler(void) __attribute__((weak));
+void SPI1_IRQHandler(void) __attribute__((weak));
+void SysTick_Handler(void) __attribute__((weak));
+}
+
+namespace {
+
+/*!
+ *  Janelas de endereços simuladas: ponte de periféricos (AIPS + GPIO) e
+ *  barramento privado do núcleo (NVIC e SysTick).
+ */
+const uintptr_t kPeripheralBase = 0x40000000u;
+const size_t kPeripheralSize = 0x00100000u;
+const uintptr_t kPrivateBase = 0xE000E000u;
+const size_t kPrivateSize = 0x1000u;
+const size_t kPageSize = 0x1000u;
+
+/*!
+ *  Modelo de custo, em ciclos do Cortex-M0+, de cada acesso ao barramento.
+ *  Um LDR/STR custa 2 ciclos; os periféricos atrás da ponte AIPS (inclusive
+ *  o GPIO em 0x400FF000, que não usa a porta IOPORT de ciclo único) somam
+ *  um estado de espera. O barramento privado (NVIC) não tem estados de
+ *  espera. Um "|=" ou "&=" em registrador custa uma leitura e uma escrita.
+ */
+const uint32_t kBridgeAccessCycles = 3;
+const uint32_t kPrivateAccessCycles = 2;
+
+/*!
+ *  Número de leituras idênticas e consecutivas de um mesmo registrador a
+ *  partir do qual o laço de espera é avançado até o próximo evento.
+ */
+const uint32_t kSpinReads = 4;
+
+static_assert(HOSTSIM_BUS_CLOCK == HOSTSIM_CORE_CLOCK &&
+              HOSTSIM_TPM_CLOCK == HOSTSIM_CORE_CLOCK,
+              "O simulador conta o tempo em ciclos do nucleo.");
+
+const uint64_t kNever = ~static_cast<uint64_t>(0);
+
+struct PitChannel {
+  bool running;
+  bool chained;
+  uint64_t cycleStart;
+  uint64_t cyclePeriod;
+  uint32_t frozenValue;
+  uint32_t chainValue;
+};
+
+struct SysTickTimer {
+  bool running;
+  bool pending;
+  uint64_t cycleStart;
+  uint64_t cyclePeriod;
+  uint32_t frozenValue;
+};
+
+struct TpmModule {
+  bool running;
+  uint64_t periodStart;
+  uint32_t frozenCount;
+  uint32_t modActive;
+  bool modPending;
+  uint32_t cnvActive[6];
+  bool cnvPending[6];
+  uint64_t matchedPeriod[6];
+  uint64_t topPeriod;
+};
+
+/*!
+ *  Trem de pulsos injetado em um pino de entrada: a próxima borda e o
+ *  nível que ela aplica.
+ */
+struct PulseTrain {
+  bool active;
+  uint8_t port;
+  uint8_t pin;
+  int level;
+  uint64_t nextEdge;
+  uint64_t period;
+  uint64_t highCycles;
+  uint32_t remaining;
+};
+
+const int kPulseTrains = 4;
+
+struct SpiModule {
+  bool shifting;
+  uint64_t shiftEnd;
+  uint8_t shiftData;
+  bool txFull;
+  uint8_t txData;
+  uint8_t rxData;
+};
+
+struct Simulator {
+  uint64_t now;
+  uint64_t timeLimit;
+  PitChannel pit[2];
+  SysTickTimer sysTick;
+  TpmModule tpm[3];
+  SpiModule spi[2];
+  PulseTrain trains[kPulseTrains];
+  uint32_t externalDriven[5];
+  uint32_t externalLevel[5];
+  uint32_t outputLevels[5];
+  uint32_t pinLevels[5];
+  uint32_t tpmLevels[5];
+  uint32_t nvicEnabled;
+  uint32_t nvicPending;
+  bool primask;
+  bool inHandler;
+  hostsim_PinObserver observer;
+  hostsim_SpiObserver spiObserver;
+  bool trapActive;
+  uintptr_t trapAddress;
+  bool trapWrite;
+  uint32_t trapOld;
+  uint32_t trapOffset;
+  uintptr_t spinAddress;
+  uint32_t spinValue;
+  uint32_t spinCount;
+  hostsim_BusStats stats;
+  bool counting;
+};
+
+Simulator sim;
+uint8_t *peripheralAlias;
+uint8_t *privateAlias;
+
+/*!
+ *  Trap flag (TF) do EFLAGS: com ela em '1', cada instrução executada gera
+ *  um SIGTRAP. O pushfq usa a pilha abaixo do rsp, fora da red zone.
+ */
+inline void setTrapFlag(bool enable) {
+  if (enable) {
+    __asm__ volatile("lea -128(%%rsp), %%rsp\n\tpushfq\n\t"
+                     "orq $0x100, (%%rsp)\n\tpopfq\n\t"
+                     "lea 128(%%rsp), %%rsp" ::: "memory", "cc");
+  } else {
+    __asm__ volatile("lea -128(%%rsp), %%rsp\n\tpushfq\n\t"
+                     "andq $~0x100, (%%rsp)\n\tpopfq\n\t"
+                     "lea 128(%%rsp), %%rsp" ::: "memory", "cc");
+  }
+}
+
+/*!
+ *  Suspende a contagem de instruções durante um método público do
+ *  simulador chamado pela aplicação.
+ */
+class Uncounted {
+ public:
+  Uncounted() : counting(sim.counting) {
+    if (counting) {
+      setTrapFlag(false);
+    }
+  }
+  ~Uncounted() {
+    if (counting && sim.counting) {
+      setTrapFlag(true);
+    }
+  }
+
+ private:
+  bool counting;
+};
+
+/*!
+ *  Chama uma rotina da aplicação (interrupção), contando as suas
+ *  instruções se a contagem está ligada.
+ */
+inline void callApplication(void (*function)(void)) {
+  if (sim.counting) {
+    setTrapFlag(true);
+  }
+  function();
+  if (sim.counting) {
+    setTrapFlag(false);
+  }
+}
+
+typedef void (*IrqHandler)(void);
+
+/*!
+ *  Acesso ao registrador pela janela de escrita do simulador, que não gera
+ *  falha de página.
+ */
+inline uint32_t &R(uintptr_t address) {
+  if (address >= kPrivateBase) {
+    return *reinterpret_cast<uint32_t *>(privateAlias + (address - kPrivateBase));
+  }
+  return *reinterpret_cast<uint32_t *>(peripheralAlias + (address - kPeripheralBase));
+}
+
+void fatal(const char *message) {
+  ssize_t ignored = write(STDERR_FILENO, message, strlen(message));
+  (void)ignored;
+  abort();
+}
+
+/*!
+ *  Endereços dos registradores usados pelo simulador.
+ */
+inline uintptr_t pitChannel(int ch) { return PIT_BASE + 0x100 + 0x10*ch; }
+inline uintptr_t tpmBase(int n) { return TPM0_BASE + 0x1000*n; }
+inline uintptr_t portBase(int n) { return PORTA_BASE + 0x1000*n; }
+inline uintptr_t gpioBase(int n) { return GPIOA_BASE + 0x40*n; }
+inline uintptr_t spiBase(int n) { return SPI0_BASE + 0x1000*n; }
+inline uintptr_t dmaChannel(int ch) { return DMA_BASE + 0x100 + 0x10*ch; }
+const uintptr_t kSimSOPT2 = SIM_BASE + 0x1004;
+const uintptr_t kSimSCGC4 = SIM_BASE + 0x1034;
+const uintptr_t kSimSCGC5 = SIM_BASE + 0x1038;
+const uintptr_t kSimSCGC6 = SIM_BASE + 0x103C;
+const uintptr_t kSimSCGC7 = SIM_BASE + 0x1040;
+
+void dmaPeriodicTrigger(int ch);
+uint32_t spiSlaveSelectPins(int port, uint32_t *levels);
+void gpioUpdateOutputs(int n);
+void portDetectEdges(int n);
+bool isMapped(uintptr_t address);
+void refresh(uintptr_t address);
+void afterRead(uintptr_t address);
+void afterWrite(uintptr_t address, uint32_t old);
+
+/*!
+ *  ---------------------------------------------------------------------------
+ *  PIT
+ *  ---------------------------------------------------------------------------
+ */
+bool pitModuleEnabled() {
+  return (R(kSimSCGC6) & SIM_SCGC6_PIT_MASK) &&
+         !(R(PIT_BASE) & PIT_MCR_MDIS_MASK);
+}
+
+/*!
+ *  Canal 1 encadeado (CHN): decrementa uma vez a cada estouro do canal 0, em
+ *  vez de a cada ciclo, e recarrega o LDVAL1 após o 0.
+ */
+void pitChainStep(uint64_t steps) {
+  PitChannel &c = sim.pit[1];
+  if (!c.running || !c.chained) {
+    return;
+  }
+  if (steps > c.chainValue) {
+    R(pitChannel(1) + 0xC) |= PIT_TFLG_TIF_MASK;
+    steps -= static_cast<uint64_t>(c.chainValue) + 1;
+    c.chainValue = R(pitChannel(1));
+    steps %= static_cast<uint64_t>(c.chainValue) + 1;
+  }
+  c.chainValue -= static_cast<uint32_t>(steps);
+}
+
+void pitSync(int ch) {
+  PitChannel &c = sim.pit[ch];
+  if (!c.running || c.chained || sim.now - c.cycleStart < c.cyclePeriod) {
+    return;
+  }
+  R(pitChannel(ch) + 0xC) |= PIT_TFLG_TIF_MASK;
+  c.cycleStart += c.cyclePeriod;
+  c.cyclePeriod = static_cast<uint64_t>(R(pitChannel(ch))) + 1;
+  uint64_t wraps = 1;
+  uint64_t elapsed = sim.now - c.cycleStart;
+  if (elapsed >= c.cyclePeriod) {
+    wraps += elapsed / c.cyclePeriod;
+    c.cycleStart += (elapsed / c.cyclePeriod) * c.cyclePeriod;
+  }
+  if (ch == 0) {
+    pitChainStep(wraps);
+  }
+  dmaPeriodicTrigger(ch);
+}
+
+uint32_t pitValue(int ch) {
+  PitChannel &c = sim.pit[ch];
+  if (!c.running) {
+    return c.frozenValue;
+  }
+  if (c.chained) {
+    return c.chainValue;
+  }
+  return static_cast<uint32_t>(c.cyclePeriod - 1 - (sim.now - c.cycleStart));
+}
+
+void pitUpdateRunning(int ch) {
+  PitChannel &c = sim.pit[ch];
+  bool enabled = pitModuleEnabled() &&
+                 (R(pitChannel(ch) + 0x8) & PIT_TCTRL_TEN_MASK);
+  if (enabled && !c.running) {
+    c.running = true;
+    c.chained = ch == 1 && (R(pitChannel(ch) + 0x8) & PIT_TCTRL_CHN_MASK);
+    c.cycleStart = sim.now;
+    c.cyclePeriod = static_cast<uint64_t>(R(pitChannel(ch))) + 1;
+    c.chainValue = R(pitChannel(ch));
+  } else if (!enabled && c.running) {
+    pitSync(ch);
+    c.frozenValue = pitValue(ch);
+    c.running = false;
+  }
+}
+
+uint64_t pitNextEvent(int ch) {
+  PitChannel &c = sim.pit[ch];
+  return (c.running && !c.chained) ? c.cycleStart + c.cyclePeriod : kNever;
+}
+
+bool pitIrqLine() {
+  for (int ch = 0; ch < 2; ch++) {
+    if ((R(pitChannel(ch) + 0x8) & PIT_TCTRL_TIE_MASK) &&
+        (R(pitChannel(ch) + 0xC) & PIT_TFLG_TIF_MASK)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void pitWrite(uintptr_t address, uint32_t old) {
+  uint32_t offset = address - PIT_BASE;
+  if (offset == 0x0) {
+    pitUpdateRunning(0);
+    pitUpdateRunning(1);
+    return;
+  }
+  if (offset < 0x100 || offset >= 0x120) {
+    R(address) = old;
+    return;
+  }
+  int ch = (offset - 0x100) >> 4;
+  switch (offset & 0xF) {
+    case 0x4:
+      R(address) = old;
+      break;
+    case 0x8:
+      pitUpdateRunning(ch);
+      break;
+    case 0xC:
+      R(address) = old & ~R(address);
+      break;
+  }
+}
+
+void pitRefresh(uintptr_t address) {
+  uint32_t offset = address - PIT_BASE;
+
+  /*!
+   *  A leitura do LTMR64H captura o CVAL0 no LTMR64L.
+   */
+  if (offset == 0xE0) {
+    R(address) = pitValue(1);
+    R(PIT_BASE + 0xE4) = pitValue(0);
+    return;
+  }
+  if (offset >= 0x100 && offset < 0x120 && (offset & 0xF) == 0x4) {
+    R(address) = pitValue((offset - 0x100) >> 4);
+  }
+}
+
+/*!
+ *  ---------------------------------------------------------------------------
+ *  TPM
+ *  ---------------------------------------------------------------------------
+ */
+inline uint32_t tpmPrescale(int n) {
+  return 1u << (R(tpmBase(n)) & TPM_SC_PS_MASK);
+}
+
+inline bool tpmCenterAligned(int n) {
+  return (R(tpmBase(n)) & TPM_SC_CPWMS_MASK) != 0;
+}
+
+inline uintptr_t tpmCnSC(int n, int ch) { return tpmBase(n) + 0xC + 8*ch; }
+
+inline bool tpmChannelCompares(int n, int ch) {
+  return (R(tpmCnSC(n, ch)) & (TPM_CnSC_MSA_MASK | TPM_CnSC_MSB_MASK)) != 0;
+}
+
+uint64_t tpmPeriodLength(int n) {
+  uint64_t mod = sim.tpm[n].modActive;
+  if (tpmCenterAligned(n)) {
+    return 2*(mod ? mod : 1)*tpmPrescale(n);
+  }
+  return (mod + 1)*tpmPrescale(n);
+}
+
+uint32_t tpmCount(int n) {
+  TpmModule &t = sim.tpm[n];
+  if (!t.running) {
+    return t.frozenCount;
+  }
+  uint32_t ticks = static_cast<uint32_t>((sim.now - t.periodStart)/tpmPrescale(n));
+  if (tpmCenterAligned(n) && ticks > t.modActive) {
+    return 2*t.modActive - ticks;
+  }
+  return ticks;
+}
+
+uint64_t tpmMatchTime(int n, int ch) {
+  TpmModule &t = sim.tpm[n];
+  return t.periodStart + static_cast<uint64_t>(t.cnvActive[ch])*tpmPrescale(n);
+}
+
+/*!
+ *  Transfere o MOD e o CnV escritos para os comparadores. Alinhado no
+ *  centro, o CnV é transferido no topo da contagem (CNT = MOD), e o pulso,
+ *  centrado no início do período, usa um só valor.
+ */
+void tpmApplyBuffers(int n, bool channels) {
+  TpmModule &t = sim.tpm[n];
+  if (t.modPending) {
+    t.modActive = R(tpmBase(n) + 0x8) & 0xFFFF;
+    t.modPending = false;
+  }
+  for (int ch = 0; channels && ch < 6; ch++) {
+    if (t.cnvPending[ch]) {
+      t.cnvActive[ch] = R(tpmCnSC(n, ch) + 4) & 0xFFFF;
+      t.cnvPending[ch] = false;
+    }
+  }
+}
+
+void tpmSync(int n) {
+  TpmModule &t = sim.tpm[n];
+  if (!t.running) {
+    return;
+  }
+  uint64_t length = tpmPeriodLength(n);
+  if (sim.now - t.periodStart >= length) {
+    for (int ch = 0; ch < 6; ch++) {
+      if (tpmChannelCompares(n, ch) && t.cnvActive[ch] <= t.modActive) {
+        R(tpmCnSC(n, ch)) |= TPM_CnSC_CHF_MASK;
+      }
+    }
+    R(tpmBase(n)) |= TPM_SC_TOF_MASK;
+    t.periodStart += length;
+    tpmApplyBuffers(n, !tpmCenterAligned(n));
+    length = tpmPeriodLength(n);
+    uint64_t elapsed = sim.now - t.periodStart;
+    if (elapsed >= length) {
+      t.periodStart += (elapsed / length) * length;
+    }
+  }
+  if (tpmCenterAligned(n) && t.topPeriod != t.periodStart &&
+      sim.now - t.periodStart >=
+          static_cast<uint64_t>(t.modActive)*tpmPrescale(n)) {
+    tpmApplyBuffers(n, true);
+    t.topPeriod = t.periodStart;
+  }
+  for (int ch = 0; ch < 6; ch++) {
+    if (tpmChannelCompares(n, ch) && t.matchedPeriod[ch] != t.periodStart &&
+        t.cnvActive[ch] <= t.modActive &&
+        sim.now - t.periodStart >= tpmMatchTime(n, ch) - t.periodStart) {
+      R(tpmCnSC(n, ch)) |= TPM_CnSC_CHF_MASK;
+      t.matchedPeriod[ch] = t.periodStart;
+    }
+  }
+}
+
+void tpmUpdateRunning(int n) {
+  TpmModule &t = sim.tpm[n];
+  bool enabled = (R(kSimSCGC6) & (SIM_SCGC6_TPM0_MASK << n)) &&
+                 (R(kSimSOPT2) & SIM_SOPT2_TPMSRC_MASK) &&
+                 (R(tpmBase(n)) & TPM_SC_CMOD_MASK) == TPM_SC_CMOD(1);
+  if (enabled && !t.running) {
+    tpmApplyBuffers(n, true);
+    t.running = true;
+    t.periodStart = sim.now - static_cast<uint64_t>(t.frozenCount)*tpmPrescale(n);
+  } else if (!enabled && t.running) {
+    tpmSync(n);
+    t.frozenCount = tpmCount(n);
+    t.running = false;
+  }
+}
+
+/*!
+ *  Canal em modo PWM (MSB) com a saída habilitada (ELSB ou ELSA).
+ */
+inline bool tpmChannelDrivesPin(int n, int ch) {
+  uint32_t cnsc = R(tpmCnSC(n, ch));
+  return (cnsc & TPM_CnSC_MSB_MASK) &&
+         (cnsc & (TPM_CnSC_ELSA_MASK | TPM_CnSC_ELSB_MASK));
+}
+
+/*!
+ *  Nível da saída PWM. Alinhada na borda: '1' enquanto CNT < CnV. Alinhada
+ *  no centro: '1' enquanto CNT < CnV na subida e CNT <= CnV na descida.
+ *  Com o ELSA (low-true) o nível é invertido. Contador parado: '0'.
+ */
+bool tpmOutputLevel(int n, int ch) {
+  TpmModule &t = sim.tpm[n];
+  bool high = false;
+  if (t.running) {
+    uint64_t ticks = (sim.now - t.periodStart)/tpmPrescale(n);
+    uint32_t cnv = t.cnvActive[ch];
+    if (tpmCenterAligned(n) && ticks > t.modActive) {
+      high = 2*t.modActive - ticks <= cnv;
+    } else {
+      high = ticks < cnv;
+    }
+  }
+  if (R(tpmCnSC(n, ch)) & TPM_CnSC_ELSA_MASK) {
+    high = !high;
+  }
+  return high;
+}
+
+uint64_t tpmNextEvent(int n) {
+  TpmModule &t = sim.tpm[n];
+  if (!t.running) {
+    return kNever;
+  }
+  uint64_t next = t.periodStart + tpmPeriodLength(n);
+  uint64_t top = t.periodStart +
+                 static_cast<uint64_t>(t.modActive)*tpmPrescale(n);
+  if (tpmCenterAligned(n) && t.topPeriod != t.periodStart && top < next) {
+    next = top;
+  }
+  for (int ch = 0; ch < 6; ch++) {
+    if (tpmChannelCompares(n, ch) && t.matchedPeriod[ch] != t.periodStart &&
+        t.cnvActive[ch] <= t.modActive && tpmMatchTime(n, ch) < next) {
+      next = tpmMatchTime(n, ch);
+    }
+
+    /*!
+     *  Transições da saída PWM no período em curso: na subida e, alinhado
+     *  no centro, na descida do contador.
+     */
+    if (tpmChannelDrivesPin(n, ch) && t.cnvActive[ch] <= t.modActive) {
+      uint64_t up = tpmMatchTime(n, ch);
+      if (up > sim.now && up < next) {
+        next = up;
+      }
+      if (tpmCenterAligned(n)) {
+        uint64_t down = t.periodStart + static_cast<uint64_t>(
+                            2*t.modActive - t.cnvActive[ch])*tpmPrescale(n);
+        if (down > sim.now && down < next) {
+          next = down;
+        }
+      }
+    }
+  }
+  return next;
+}
+
+/*!
+ *  Pinos dos canais do TPM, os mesmos de tpm_Pin: {TPM, canal, porta,
+ *  pino, ALT}.
+ */
+const struct {
+  uint8_t tpm;
+  uint8_t ch;
+  uint8_t port;
+  uint8_t pin;
+  uint8_t mux;
+} kTpmPins[] = {
+  {0, 5, 0, 0, 3}, {0, 1, 0, 4, 3}, {0, 2, 0, 5, 3}, {0, 0, 2, 1, 4},
+  {0, 1, 2, 2, 4}, {0, 2, 2, 3, 4}, {0, 3, 2, 4, 4}, {0, 4, 2, 8, 3},
+  {0, 5, 2, 9, 3}, {0, 0, 3, 0, 4}, {0, 1, 3, 1, 4}, {0, 2, 3, 2, 4},
+  {0, 3, 3, 3, 4}, {0, 4, 3, 4, 4}, {0, 5, 3, 5, 4}, {0, 2, 4, 29, 3},
+  {0, 3, 4, 30, 3}, {1, 0, 0, 12, 3}, {1, 1, 0, 13, 3}, {1, 0, 1, 0, 3},
+  {1, 1, 1, 1, 3}, {1, 0, 4, 20, 3}, {1, 1, 4, 21, 3}, {2, 0, 0, 1, 3},
+  {2, 1, 0, 2, 3}, {2, 0, 4, 22, 3}, {2, 1, 4, 23, 3}
+};
+
+/*!
+ *  Pinos da porta ligados a uma saída PWM e o nível de cada um.
+ */
+uint32_t tpmOutputPins(int port, uint32_t *levels) {
+  uint32_t pins = 0;
+  for (size_t i = 0; i < sizeof(kTpmPins)/sizeof(kTpmPins[0]); i++) {
+    int n = kTpmPins[i].tpm;
+    int ch = kTpmPins[i].ch;
+    uint32_t pcr = R(portBase(port) + 4*kTpmPins[i].pin);
+    if (kTpmPins[i].port != port || !tpmChannelDrivesPin(n, ch) ||
+        (pcr & PORT_PCR_MUX_MASK) != PORT_PCR_MUX(kTpmPins[i].mux)) {
+      continue;
+    }
+    uint32_t bit = 1u << kTpmPins[i].pin;
+    pins |= bit;
+    if (tpmOutputLevel(n, ch)) {
+      *levels |= bit;
+    }
+  }
+  return pins;
+}
+
+/*!
+ *  Captura de entrada: nos canais com MSB = MSA = 0 e ELSB:ELSA = 01
+ *  (subida), 10 (descida) ou 11 (ambas), a borda no pino copia o contador
+ *  para o CnV e liga o CHF.
+ */
+void tpmCaptureEdges(int port, uint32_t levels, uint32_t changed) {
+  for (size_t i = 0; i < sizeof(kTpmPins)/sizeof(kTpmPins[0]); i++) {
+    int n = kTpmPins[i].tpm;
+    int ch = kTpmPins[i].ch;
+    uint32_t bit = 1u << kTpmPins[i].pin;
+    uint32_t cnsc = R(tpmCnSC(n, ch));
+    uint32_t pcr = R(portBase(port) + 4*kTpmPins[i].pin);
+    if (kTpmPins[i].port != port || !(changed & bit) || !sim.tpm[n].running ||
+        (cnsc & (TPM_CnSC_MSA_MASK | TPM_CnSC_MSB_MASK)) ||
+        (pcr & PORT_PCR_MUX_MASK) != PORT_PCR_MUX(kTpmPins[i].mux)) {
+      continue;
+    }
+    bool rising = (levels & bit) != 0;
+    if ((rising && (cnsc & TPM_CnSC_ELSA_MASK)) ||
+        (!rising && (cnsc & TPM_CnSC_ELSB_MASK))) {
+      tpmSync(n);
+      R(tpmCnSC(n, ch) + 4) = tpmCount(n);
+      R(tpmCnSC(n, ch)) |= TPM_CnSC_CHF_MASK;
+    }
+  }
+}
+
+/*!
+ *  Atualiza os pinos das portas cujas saídas PWM mudaram de nível.
+ */
+void tpmUpdateOutputs() {
+  for (int port = 0; port < 5; port++) {
+    uint32_t levels = 0;
+    uint32_t pins = tpmOutputPins(port, &levels);
+    if ((levels & pins) != sim.tpmLevels[port]) {
+      sim.tpmLevels[port] = levels & pins;
+      gpioUpdateOutputs(port);
+    }
+  }
+}
+
+bool tpmIrqLine(int n) {
+  uint32_t sc = R(tpmBase(n));
+  if ((sc & TPM_SC_TOIE_MASK) && (sc & TPM_SC_TOF_MASK)) {
+    return true;
+  }
+  for (int ch = 0; ch < 6; ch++) {
+    uint32_t cnsc = R(tpmCnSC(n, ch));
+    if ((cnsc & TPM_CnSC_CHIE_MASK) && (cnsc & TPM_CnSC_CHF_MASK)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void tpmWrite(int n, uintptr_t address, uint32_t old) {
+  TpmModule &t = sim.tpm[n];
+  uint32_t offset = address - tpmBase(n);
+  uint32_t value = R(address);
+  if (offset == 0x0) {
+    uint32_t flags = old & TPM_SC_TOF_MASK & ~value;
+    R(address) = (value & ~TPM_SC_TOF_MASK) | flags;
+    tpmUpdateRunning(n);
+  } else if (offset == 0x4) {
+    R(address) = 0;
+    t.frozenCount = 0;
+    t.periodStart = sim.now;
+  } else if (offset == 0x8) {
+    R(address) = value & 0xFFFF;
+    if (t.running) {
+      t.modPending = true;
+    } else {
+      t.modActive = value & 0xFFFF;
+    }
+  } else if (offset >= 0xC && offset < 0x3C) {
+    int ch = (offset - 0xC) >> 3;
+    if ((offset & 0x7) == 0x0) {
+      R(address) = value & 0xFFFF;
+      bool pwm = (R(tpmCnSC(n, ch)) & TPM_CnSC_MSB_MASK) != 0;
+      if (t.running && pwm) {
+        t.cnvPending[ch] = true;
+      } else {
+        t.cnvActive[ch] = value & 0xFFFF;
+      }
+    } else {
+      uint32_t flags = old & TPM_CnSC_CHF_MASK & ~value;
+      R(address) = (value & ~TPM_CnSC_CHF_MASK) | flags;
+    }
+  } else if (offset == 0x50) {
+    for (int ch = 0; ch < 6; ch++) {
+      if (value & (1u << ch)) {
+        R(tpmCnSC(n, ch)) &= ~TPM_CnSC_CHF_MASK;
+      }
+    }
+    if (value & TPM_STATUS_TOF_MASK) {
+      R(tpmBase(n)) &= ~TPM_SC_TOF_MASK;
+    }
+  }
+  tpmUpdateOutputs();
+}
+
+void tpmRefresh(int n, uintptr_t address) {
+  uint32_t offset = address - tpmBase(n);
+  if (offset == 0x4) {
+    R(address) = tpmCount(n);
+  } else if (offset == 0x50) {
+    uint32_t status = (R(tpmBase(n)) & TPM_SC_TOF_MASK) ? TPM_STATUS_TOF_MASK : 0;
+    for (int ch = 0; ch < 6; ch++) {
+      if (R(tpmCnSC(n, ch)) & TPM_CnSC_CHF_MASK) {
+        status |= 1u << ch;
+      }
+    }
+    R(address) = status;
+  }
+}
+
+/*!
+ *  ---------------------------------------------------------------------------
+ *  Trens de pulsos nos pinos de entrada
+ *  ---------------------------------------------------------------------------
+ */
+void trainSync() {
+  for (int i = 0; i < kPulseTrains; i++) {
+    PulseTrain &p = sim.trains[i];
+    while (p.active && p.nextEdge <= sim.now) {
+      uint32_t bit = 1u << p.pin;
+      sim.externalDriven[p.port] |= bit;
+      if (p.level) {
+        sim.externalLevel[p.port] |= bit;
+        p.nextEdge += p.highCycles;
+        p.level = 0;
+      } else {
+        sim.externalLevel[p.port] &= ~bit;
+        p.nextEdge += p.period - p.highCycles;
+        p.level = 1;
+        p.active = --p.remaining != 0;
+      }
+      portDetectEdges(p.port);
+    }
+  }
+}
+
+uint64_t trainNextEvent() {
+  uint64_t next = kNever;
+  for (int i = 0; i < kPulseTrains; i++) {
+    if (sim.trains[i].active && sim.trains[i].nextEdge < next) {
+      next = sim.trains[i].nextEdge;
+    }
+  }
+  return next;
+}
+
+/*!
+ *  ---------------------------------------------------------------------------
+ *  PORT e GPIO
+ *  ---------------------------------------------------------------------------
+ */
+uint32_t portMuxMask(int n, uint32_t mux) {
+  uint32_t mask = 0;
+  for (int pin = 0; pin < 32; pin++) {
+    if ((R(portBase(n) + 4*pin) & PORT_PCR_MUX_MASK) == PORT_PCR_MUX(mux)) {
+      mask |= 1u << pin;
+    }
+  }
+  return mask;
+}
+
+uint32_t portPullUps(int n) {
+  uint32_t mask = 0;
+  for (int pin = 0; pin < 32; pin++) {
+    uint32_t pcr = R(portBase(n) + 4*pin);
+    if ((pcr & PORT_PCR_PE_MASK) && (pcr & PORT_PCR_PS_MASK)) {
+      mask |= 1u << pin;
+    }
+  }
+  return mask;
+}
+
+/*!
+ *  Nível lógico de cada pino: os configurados como saída GPIO seguem o PDOR,
+ *  os demais seguem o estímulo externo ou, na sua ausência, o resistor de pull.
+ */
+uint32_t pinLevels(int n) {
+  uint32_t outputs = R(gpioBase(n) + 0x14) & portMuxMask(n, 1);
+  uint32_t inputs = (sim.externalLevel[n] & sim.externalDriven[n]) |
+                    (portPullUps(n) & ~sim.externalDriven[n]);
+  return (R(gpioBase(n)) & outputs) | (inputs & ~outputs);
+}
+
+void portDetectEdges(int n) {
+  uint32_t levels = pinLevels(n);
+  uint32_t changed = levels ^ sim.pinLevels[n];
+  sim.pinLevels[n] = levels;
+  for (int pin = 0; pin < 32; pin++) {
+    uintptr_t pcr = portBase(n) + 4*pin;
+    uint32_t irqc = (R(pcr) & PORT_PCR_IRQC_MASK) >> PORT_PCR_IRQC_SHIFT;
+    uint32_t bit = 1u << pin;
+    bool level = (levels & bit) != 0;
+    bool edge = (changed & bit) != 0;
+    bool detected = (irqc == 0x8 && !level) ||
+                    (irqc == 0x9 && edge && level) ||
+                    (irqc == 0xA && edge && !level) ||
+                    (irqc == 0xB && edge) ||
+                    (irqc == 0xC && level);
+    if (detected) {
+      R(pcr) |= PORT_PCR_ISF_MASK;
+      R(portBase(n) + 0xA0) |= bit;
+    }
+  }
+  tpmCaptureEdges(n, levels, changed);
+}
+
+/*!
+ *  Níveis dos pinos de saída: os do GPIO, os de slave select do SPI e as
+ *  saídas PWM do TPM.
+ */
+void gpioUpdateOutputs(int n) {
+  uint32_t ssLevels = 0;
+  uint32_t ssPins = spiSlaveSelectPins(n, &ssLevels);
+  uint32_t tpmLevels = 0;
+  uint32_t tpmPins = tpmOutputPins(n, &tpmLevels);
+  uint32_t levels = (R(gpioBase(n)) & R(gpioBase(n) + 0x14) &
+                     portMuxMask(n, 1) & ~ssPins & ~tpmPins) |
+                    (ssLevels & ssPins) | (tpmLevels & tpmPins);
+  uint32_t old = sim.outputLevels[n];
+  sim.outputLevels[n] = levels;
+  portDetectEdges(n);
+  if (levels != old && sim.observer) {
+    sim.observer(n, old, levels, sim.now);
+  }
+}
+
+void portWrite(int n, uintptr_t address, uint32_t old) {
+  uint32_t offset = address - portBase(n);
+  uint32_t value = R(address);
+  if (offset < 0x80) {
+    uint32_t bit = 1u << (offset >> 2);
+    if (value & PORT_PCR_ISF_MASK) {
+      R(address) = value & ~PORT_PCR_ISF_MASK;
+      R(portBase(n) + 0xA0) &= ~bit;
+    } else {
+      R(address) = value | (old & PORT_PCR_ISF_MASK);
+    }
+  } else if (offset == 0x80 || offset == 0x84) {
+    int first = (offset == 0x80) ? 0 : 16;
+    for (int pin = 0; pin < 16; pin++) {
+      if (value & (0x10000u << pin)) {
+        uintptr_t pcr = portBase(n) + 4*(first + pin);
+        R(pcr) = (R(pcr) & 0xFFFF0000u) | (value & 0xFFFFu);
+      }
+    }
+    R(address) = 0;
+  } else if (offset == 0xA0) {
+    uint32_t cleared = value;
+    R(address) = old & ~cleared;
+    for (int pin = 0; pin < 32; pin++) {
+      if (cleared & (1u << pin)) {
+        R(portBase(n) + 4*pin) &= ~PORT_PCR_ISF_MASK;
+      }
+    }
+  }
+  gpioUpdateOutputs(n);
+}
+
+void gpioWrite(int n, uintptr_t address, uint32_t old) {
+  uintptr_t pdor = gpioBase(n);
+  uint32_t value = R(address);
+  switch (address - pdor) {
+    case 0x4:
+      R(pdor) |= value;
+      R(address) = 0;
+      break;
+    case 0x8:
+      R(pdor) &= ~value;
+      R(address) = 0;
+      break;
+    case 0xC:
+      R(pdor) ^= value;
+      R(address) = 0;
+      break;
+    case 0x10:
+      R(address) = old;
+      break;
+  }
+  gpioUpdateOutputs(n);
+}
+
+void gpioRefresh(int n, uintptr_t address) {
+  uintptr_t pdor = gpioBase(n);
+  uint32_t offset = address - pdor;
+  if (offset == 0x10) {
+    R(address) = pinLevels(n) & ~portMuxMask(n, 0);
+  } else if (offset >= 0x4 && offset <= 0xC) {
+    R(address) = 0;
+  }
+}
+
+/*!
+ *  ---------------------------------------------------------------------------
+ *  SPI
+ *  ---------------------------------------------------------------------------
+ *  Apenas o modo mestre é simulado. O pino MISO não está ligado: os bytes
+ *  recebidos são 0x00.
+ */
+inline uint8_t &spiReg(int n, uint32_t offset) {
+  return peripheralAlias[spiBase(n) + offset - kPeripheralBase];
+}
+
+bool spiEnabled(int n) {
+  const uint8_t mask = SPI_C1_SPE_MASK | SPI_C1_MSTR_MASK;
+  return (spiReg(n, 0x0) & mask) == mask;
+}
+
+/*!
+ *  Pinos PCS0 (ALT2) de cada SPI, por porta: SPI0 em PTA14, PTC4 e PTD0;
+ *  SPI1 em PTB10, PTD4 e PTE4.
+ */
+const struct {
+  uint8_t spi;
+  uint8_t port;
+  uint8_t pin;
+} kSlaveSelectPins[] = {
+  {0, 0, 14}, {0, 2, 4}, {0, 3, 0}, {1, 1, 10}, {1, 3, 4}, {1, 4, 4}
+};
+
+/*!
+ *  Com SSOE e MODFEN, o PCS0 fica em '0' durante o deslocamento de cada byte
+ *  e em '1' fora dele.
+ */
+uint32_t spiSlaveSelectPins(int port, uint32_t *levels) {
+  uint32_t pins = 0;
+  for (size_t i = 0; i < sizeof(kSlaveSelectPins)/sizeof(kSlaveSelectPins[0]);
+       i++) {
+    int n = kSlaveSelectPins[i].spi;
+    uint32_t bit = 1u << kSlaveSelectPins[i].pin;
+    if (kSlaveSelectPins[i].port != port || !spiEnabled(n) ||
+        !(spiReg(n, 0x0) & SPI_C1_SSOE_MASK) ||
+        !(spiReg(n, 0x1) & SPI_C2_MODFEN_MASK) ||
+        !(portMuxMask(port, 2) & bit)) {
+      continue;
+    }
+    pins |= bit;
+    if (!sim.spi[n].shifting) {
+      *levels |= bit;
+    }
+  }
+  return pins;
+}
+
+void spiUpdateSlaveSelect(int n) {
+  for (size_t i = 0; i < sizeof(kSlaveSelectPins)/sizeof(kSlaveSelectPins[0]);
+       i++) {
+    if (kSlaveSelectPins[i].spi == n) {
+      gpioUpdateOutputs(kSlaveSelectPins[i].port);
+    }
+  }
+}
+
+/*!
+ *  Ciclos do barramento por bit: (SPPR + 1) * 2^(SPR + 1).
+ */
+uint32_t spiBitCycles(int n) {
+  uint8_t br = spiReg(n, 0x2);
+  return (((br & SPI_BR_SPPR_MASK) >> SPI_BR_SPPR_SHIFT) + 1)
+         << ((br & SPI_BR_SPR_MASK) + 1);
+}
+
+void spiStartShift(int n, uint64_t start) {
+  SpiModule &s = sim.spi[n];
+  s.shifting = true;
+  s.shiftData = s.txData;
+  s.shiftEnd = start + 8*spiBitCycles(n);
+  s.txFull = false;
+  spiReg(n, 0x3) |= SPI_S_SPTEF_MASK;
+  spiUpdateSlaveSelect(n);
+}
+
+void spiSync(int n) {
+  SpiModule &s = sim.spi[n];
+  while (s.shifting && sim.now >= s.shiftEnd) {
+    uint64_t end = s.shiftEnd;
+    s.shifting = false;
+    s.rxData = 0;
+    spiReg(n, 0x3) |= SPI_S_SPRF_MASK;
+    if (sim.spiObserver) {
+      sim.spiObserver(n, s.shiftData, end);
+    }
+    spiUpdateSlaveSelect(n);
+    if (s.txFull) {
+      spiStartShift(n, end);
+    }
+  }
+}
+
+uint64_t spiNextEvent(int n) {
+  return sim.spi[n].shifting ? sim.spi[n].shiftEnd : kNever;
+}
+
+void spiWrite(int n, uintptr_t address, uint32_t old) {
+  SpiModule &s = sim.spi[n];
+  uint32_t offset = address - spiBase(n);
+  if (offset == 0x0) {
+    spiReg(n, 0x3) = old >> 24;
+    if (!spiEnabled(n)) {
+      s.shifting = false;
+      s.txFull = false;
+      spiReg(n, 0x3) = SPI_S_SPTEF_MASK;
+    }
+    spiUpdateSlaveSelect(n);
+  } else if (offset == 0x4 && sim.trapOffset <= 1) {
+    if (!spiEnabled(n) || s.txFull) {
+      return;
+    }
+    s.txData = spiReg(n, 0x5);
+    s.txFull = true;
+    spiReg(n, 0x3) &= ~SPI_S_SPTEF_MASK;
+    if (!s.shifting) {
+      spiStartShift(n, sim.now);
+    }
+  }
+}
+
+void spiRefresh(int n, uintptr_t address) {
+  if (address - spiBase(n) == 0x4) {
+    spiReg(n, 0x5) = sim.spi[n].rxData;
+  }
+}
+
+/*!
+ *  A leitura do D limpa o SPRF.
+ */
+void spiRead(int n, uintptr_t address) {
+  if (address - spiBase(n) == 0x4 && sim.trapOffset <= 1) {
+    spiReg(n, 0x3) &= ~SPI_S_SPRF_MASK;
+  }
+}
+
+/*!
+ *  Pedido de interrupção: SPRF com SPIE, ou SPTEF com SPTIE.
+ */
+bool spiIrqLine(int n) {
+  uint8_t c1 = spiReg(n, 0x0);
+  uint8_t s = spiReg(n, 0x3);
+  return spiEnabled(n) &&
+         (((c1 & SPI_C1_SPIE_MASK) && (s & SPI_S_SPRF_MASK)) ||
+          ((c1 & SPI_C1_SPTIE_MASK) && (s & SPI_S_SPTEF_MASK)));
+}
+
+/*!
+ *  ---------------------------------------------------------------------------
+ *  DMA e DMAMUX
+ *  ---------------------------------------------------------------------------
+ *  As requisições são atendidas no instante em que ocorrem, sem arbitragem
+ *  entre os canais e sem o custo das transferências. Fontes simuladas: SPI
+ *  Tx (SPTEF com TXDMAE), SPI Rx (SPRF com RXDMAE) e "always enabled", com
+ *  ou sem o disparo periódico do PIT (canais 0 e 1). Os erros de configuração e de barramento não são
+ *  simulados, exceto um BCR menor que o tamanho da transferência (CE).
+ */
+const uint32_t kDmaStatusMask = DMA_DSR_BCR_DONE_MASK | DMA_DSR_BCR_BED_MASK |
+                                DMA_DSR_BCR_BES_MASK | DMA_DSR_BCR_CE_MASK;
+
+inline uint8_t &dmamuxReg(int ch) {
+  return peripheralAlias[DMAMUX0_BASE + ch - kPeripheralBase];
+}
+
+bool dmaSourceActive(int ch) {
+  uint8_t source = dmamuxReg(ch) & DMAMUX_CHCFG_SOURCE_MASK;
+  if (source >= 60) {
+    return true;
+  }
+  if (source == 17 || source == 19) {
+    int n = (source - 17) >> 1;
+    return spiEnabled(n) && (spiReg(n, 0x1) & SPI_C2_TXDMAE_MASK) &&
+           (spiReg(n, 0x3) & SPI_S_SPTEF_MASK);
+  }
+  if (source == 16 || source == 18) {
+    int n = (source - 16) >> 1;
+    return spiEnabled(n) && (spiReg(n, 0x1) & SPI_C2_RXDMAE_MASK) &&
+           (spiReg(n, 0x3) & SPI_S_SPRF_MASK);
+  }
+  return false;
+}
+
+bool dmaRequestEnabled(int ch) {
+  return (R(kSimSCGC7) & SIM_SCGC7_DMA_MASK) &&
+         (R(kSimSCGC6) & SIM_SCGC6_DMAMUX_MASK) &&
+         (dmamuxReg(ch) & DMAMUX_CHCFG_ENBL_MASK) &&
+         (R(dmaChannel(ch) + 0xC) & DMA_DCR_ERQ_MASK) &&
+         !(R(dmaChannel(ch) + 0x8) & DMA_DSR_BCR_DONE_MASK);
+}
+
+inline uint32_t dmaSizeBytes(uint32_t size) {
+  return size == 0 ? 4 : size;
+}
+
+/*!
+ *  Incremento do endereço limitado ao buffer circular de SMOD/DMOD:
+ *  0 = desabilitado, 1 = 16 bytes, ..., 15 = 256 KB.
+ */
+uint32_t dmaIncrement(uint32_t address, uint32_t step, uint32_t mod) {
+  if (mod == 0) {
+    return address + step;
+  }
+  uint32_t mask = (8u << mod) - 1;
+  return (address & ~mask) | ((address + step) & mask);
+}
+
+/*!
+ *  Acesso do DMA: os registradores dos periféricos passam pela sua semântica
+ *  (sem custo para a CPU) e a memória da aplicação é acessada diretamente.
+ */
+void dmaBusRead(uint32_t address, uint32_t size, uint8_t *data) {
+  if (isMapped(address)) {
+    uintptr_t word = address & ~0x3u;
+    uint32_t offset = sim.trapOffset;
+    sim.trapOffset = address & 0x3;
+    refresh(word);
+    memcpy(data, &reinterpret_cast<uint8_t *>(&R(word))[address & 0x3], size);
+    afterRead(word);
+    sim.trapOffset = offset;
+  } else {
+    memcpy(data, reinterpret_cast<const void *>(static_cast<uintptr_t>(address)),
+           size);
+  }
+}
+
+void dmaBusWrite(uint32_t address, uint32_t size, const uint8_t *data) {
+  if (isMapped(address)) {
+    uintptr_t word = address & ~0x3u;
+    uint32_t offset = sim.trapOffset;
+    uint32_t old = R(word);
+    sim.trapOffset = address & 0x3;
+    memcpy(&reinterpret_cast<uint8_t *>(&R(word))[address & 0x3], data, size);
+    afterWrite(word, old);
+    sim.trapOffset = offset;
+  } else {
+    memcpy(reinterpret_cast<void *>(static_cast<uintptr_t>(address)), data,
+           size);
+  }
+}
+
+/*!
+ *  Uma transferência: uma ou mais leituras de SSIZE seguidas de uma ou mais
+ *  escritas de DSIZE, até o maior dos dois tamanhos.
+ */
+void dmaTransfer(int ch) {
+  uintptr_t base = dmaChannel(ch);
+  uint32_t dcr = R(base + 0xC);
+  uint32_t sourceSize = dmaSizeBytes((dcr & DMA_DCR_SSIZE_MASK) >> DMA_DCR_SSIZE_SHIFT);
+  uint32_t destinationSize = dmaSizeBytes((dcr & DMA_DCR_DSIZE_MASK) >> DMA_DCR_DSIZE_SHIFT);
+  uint32_t bytes = sourceSize > destinationSize ? sourceSize : destinationSize;
+  uint32_t count = R(base + 0x8) & DMA_DSR_BCR_BCR_MASK;
+  if (count < bytes) {
+    R(base + 0x8) |= DMA_DSR_BCR_CE_MASK | DMA_DSR_BCR_DONE_MASK;
+    return;
+  }
+  uint8_t data[4];
+  for (uint32_t i = 0; i < bytes; i += sourceSize) {
+    dmaBusRead(R(base), sourceSize, data + i);
+    if (dcr & DMA_DCR_SINC_MASK) {
+      R(base) = dmaIncrement(R(base), sourceSize,
+                             (dcr & DMA_DCR_SMOD_MASK) >> DMA_DCR_SMOD_SHIFT);
+    }
+  }
+  for (uint32_t i = 0; i < bytes; i += destinationSize) {
+    dmaBusWrite(R(base + 0x4), destinationSize, data + i);
+    if (dcr & DMA_DCR_DINC_MASK) {
+      R(base + 0x4) = dmaIncrement(R(base + 0x4), destinationSize,
+                                   (dcr & DMA_DCR_DMOD_MASK) >> DMA_DCR_DMOD_SHIFT);
+    }
+  }
+  count -= bytes;
+  R(base + 0x8) = (R(base + 0x8) & ~DMA_DSR_BCR_BCR_MASK) | count;
+  if (count == 0) {
+    R(base + 0x8) |= DMA_DSR_BCR_DONE_MASK;
+    if (dcr & DMA_DCR_D_REQ_MASK) {
+      R(base + 0xC) &= ~DMA_DCR_ERQ_MASK;
+    }
+  }
+}
+
+/*!
+ *  Atende uma requisição: uma transferência no modo cycle steal (CS), ou
+ *  todas até o fim do bloco.
+ */
+void dmaService(int ch) {
+  do {
+    dmaTransfer(ch);
+  } while (!(R(dmaChannel(ch) + 0xC) & DMA_DCR_CS_MASK) &&
+           !(R(dmaChannel(ch) + 0x8) & DMA_DSR_BCR_DONE_MASK));
+}
+
+/*!
+ *  Disparo periódico: o período do canal do PIT libera uma requisição do
+ *  canal de mesmo número do DMAMUX.
+ */
+void dmaPeriodicTrigger(int ch) {
+  if ((dmamuxReg(ch) & DMAMUX_CHCFG_TRIG_MASK) && dmaRequestEnabled(ch) &&
+      dmaSourceActive(ch)) {
+    dmaService(ch);
+  }
+}
+
+/*!
+ *  Requisições sem disparo periódico, atendidas enquanto a fonte as mantém.
+ */
+void dmaPoll() {
+  for (int ch = 0; ch < 4; ch++) {
+    while (!(dmamuxReg(ch) & DMAMUX_CHCFG_TRIG_MASK) &&
+           dmaRequestEnabled(ch) && dmaSourceActive(ch)) {
+      dmaService(ch);
+    }
+  }
+}
+
+bool dmaIrqLine(int ch) {
+  return (R(dmaChannel(ch) + 0xC) & DMA_DCR_EINT_MASK) &&
+         (R(dmaChannel(ch) + 0x8) & DMA_DSR_BCR_DONE_MASK);
+}
+
+/*!
+ *  DSR_BCR: escrever '1' no DONE limpa o status e mantém o BCR; as demais
+ *  escritas ajustam o BCR. DCR: o START inicia uma requisição por software.
+ */
+void dmaWrite(uintptr_t address, uint32_t old) {
+  if (address >= DMAMUX0_BASE) {
+    dmaPoll();
+    return;
+  }
+  uint32_t offset = address - DMA_BASE;
+  if (offset < 0x100 || offset >= 0x140) {
+    R(address) = old;
+    return;
+  }
+  int ch = (offset - 0x100) >> 4;
+  uint32_t value = R(address);
+  if ((offset & 0xF) == 0x8) {
+    if (value & DMA_DSR_BCR_DONE_MASK) {
+      R(address) = old & DMA_DSR_BCR_BCR_MASK;
+    } else {
+      R(address) = (old & kDmaStatusMask) | (value & DMA_DSR_BCR_BCR_MASK);
+    }
+  } else if ((offset & 0xF) == 0xC && (value & DMA_DCR_START_MASK)) {
+    R(address) = value & ~DMA_DCR_START_MASK;
+    if (!(R(dmaChannel(ch) + 0x8) & DMA_DSR_BCR_DONE_MASK)) {
+      dmaService(ch);
+    }
+  }
+  dmaPoll();
+}
+
+/*!
+ *  ---------------------------------------------------------------------------
+ *  NVIC
+ *  ---------------------------------------------------------------------------
+ */
+uint32_t irqLines() {
+  uint32_t lines = 0;
+  if (pitIrqLine()) {
+    lines |= 1u << PIT_IRQn;
+  }
+  for (int n = 0; n < 3; n++) {
+    if (tpmIrqLine(n)) {
+      lines |= 1u << (TPM0_IRQn + n);
+    }
+  }
+  if (R(portBase(0) + 0xA0)) {
+    lines |= 1u << PORTA_IRQn;
+  }
+  if (R(portBase(3) + 0xA0)) {
+    lines |= 1u << PORTD_IRQn;
+  }
+  for (int ch = 0; ch < 4; ch++) {
+    if (dmaIrqLine(ch)) {
+      lines |= 1u << (DMA0_IRQn + ch);
+    }
+  }
+  for (int n = 0; n < 2; n++) {
+    if (spiIrqLine(n)) {
+      lines |= 1u << (SPI0_IRQn + n);
+    }
+  }
+  return lines;
+}
+
+void nvicWrite(uintptr_t address) {
+  uint32_t value = R(address);
+  switch (address - NVIC_BASE) {
+    case 0x000:
+      sim.nvicEnabled |= value;
+      break;
+    case 0x080:
+      sim.nvicEnabled &= ~value;
+      break;
+    case 0x100:
+      sim.nvicPending |= value;
+      break;
+    case 0x180:
+      sim.nvicPending &= ~value;
+      break;
+    default:
+      return;
+  }
+  R(address) = 0;
+}
+
+void nvicRefresh(uintptr_t address) {
+  switch (address - NVIC_BASE) {
+    case 0x000:
+    case 0x080:
+      R(address) = sim.nvicEnabled;
+      break;
+    case 0x100:
+    case 0x180:
+      R(address) = sim.nvicPending | irqLines();
+      break;
+  }
+}
+
+/*!
+ *  ---------------------------------------------------------------------------
+ *  SysTick
+ *  ---------------------------------------------------------------------------
+ */
+uint32_t sysTickDivider() {
+  return (R(SysTick_BASE) & SysTick_CTRL_CLKSOURCE_Msk) ? 1 : 16;
+}
+
+void sysTickRestart() {
+  SysTickTimer &t = sim.sysTick;
+  t.cycleStart = sim.now;
+  t.cyclePeriod = (static_cast<uint64_t>(R(SysTick_BASE + 0x4) &
+                                         SysTick_LOAD_RELOAD_Msk) + 1) *
+                  sysTickDivider();
+}
+
+void sysTickSync() {
+  SysTickTimer &t = sim.sysTick;
+  if (!t.running || sim.now - t.cycleStart < t.cyclePeriod) {
+    return;
+  }
+  R(SysTick_BASE) |= SysTick_CTRL_COUNTFLAG_Msk;
+  if (R(SysTick_BASE) & SysTick_CTRL_TICKINT_Msk) {
+    t.pending = true;
+  }
+  uint64_t elapsed = sim.now - t.cycleStart - t.cyclePeriod;
+  sysTickRestart();
+  t.cycleStart = sim.now - elapsed % t.cyclePeriod;
+}
+
+uint32_t sysTickValue() {
+  SysTickTimer &t = sim.sysTick;
+  if (!t.running) {
+    return t.frozenValue;
+  }
+  uint64_t ticks = (sim.now - t.cycleStart) / sysTickDivider();
+  return static_cast<uint32_t>(t.cyclePeriod / sysTickDivider() - 1 - ticks);
+}
+
+uint64_t sysTickNextEvent() {
+  SysTickTimer &t = sim.sysTick;
+  return t.running ? t.cycleStart + t.cyclePeriod : kNever;
+}
+
+void sysTickWrite(uintptr_t address, uint32_t old) {
+  SysTickTimer &t = sim.sysTick;
+  switch (address - SysTick_BASE) {
+    case 0x0: {
+      /*!
+       *  O COUNTFLAG só é escrito pelo contador.
+       */
+      R(address) = (R(address) & ~SysTick_CTRL_COUNTFLAG_Msk) |
+                   (old & SysTick_CTRL_COUNTFLAG_Msk);
+      bool enabled = R(address) & SysTick_CTRL_ENABLE_Msk;
+      if (enabled && !t.running) {
+        t.running = true;
+        sysTickRestart();
+      } else if (!enabled && t.running) {
+        sysTickSync();
+        t.frozenValue = sysTickValue();
+        t.running = false;
+      }
+      break;
+    }
+    case 0x8:
+      R(SysTick_BASE) &= ~SysTick_CTRL_COUNTFLAG_Msk;
+      t.frozenValue = 0;
+      if (t.running) {
+        sysTickRestart();
+      }
+      break;
+    case 0xC:
+      R(address) = old;
+      break;
+  }
+}
+
+void sysTickRefresh(uintptr_t address) {
+  if (address == SysTick_BASE + 0x8) {
+    R(address) = sysTickValue();
+  }
+}
+
+/*!
+ *  A leitura do CTRL limpa o COUNTFLAG.
+ */
+void sysTickRead(uintptr_t address) {
+  if (address == SysTick_BASE) {
+    R(address) &= ~SysTick_CTRL_COUNTFLAG_Msk;
+  }
+}
+
+/*!
+ *  ---------------------------------------------------------------------------
+ *  Tempo virtual
+ *  ---------------------------------------------------------------------------
+ */
+void syncAll() {
+  for (int ch = 0; ch < 2; ch++) {
+    pitSync(ch);
+  }
+  for (int n = 0; n < 3; n++) {
+    tpmSync(n);
+  }
+  trainSync();
+  tpmUpdateOutputs();
+  for (int n = 0; n < 2; n++) {
+    spiSync(n);
+  }
+  sysTickSync();
+  dmaPoll();
+}
+
+uint64_t nextEvent() {
+  uint64_t next = kNever;
+  for (int ch = 0; ch < 2; ch++) {
+    uint64_t t = pitNextEvent(ch);
+    next = t < next ? t : next;
+  }
+  for (int n = 0; n < 3; n++) {
+    uint64_t t = tpmNextEvent(n);
+    next = t < next ? t : next;
+  }
+  for (int n = 0; n < 2; n++) {
+    uint64_t t = spiNextEvent(n);
+    next = t < next ? t : next;
+  }
+  uint64_t t = sysTickNextEvent();
+  next = t < next ? t : next;
+  t = trainNextEvent();
+  next = t < next ? t : next;
+  return next;
+}
+
+/*!
+ *  As bordas dos trens de pulsos são aplicadas no seu instante exato,
+ *  mesmo quando um acesso ao barramento avança o tempo além delas.
+ */
+void advanceTo(uint64_t time) {
+  for (uint64_t edge = trainNextEvent(); edge < time && edge > sim.now;
+       edge = trainNextEvent()) {
+    sim.now = edge;
+    syncAll();
+  }
+  if (time > sim.now) {
+    sim.now = time;
+  }
+  syncAll();
+}
+
+uint32_t pendingIrqs() {
+  return (sim.nvicPending | irqLines()) & sim.nvicEnabled;
+}
+
+IrqHandler irqHandler(int irq) {
+  switch (irq) {
+    case PIT_IRQn:   return PIT_IRQHandler;
+    case TPM0_IRQn:  return TPM0_IRQHandler;
+    case TPM1_IRQn:  return TPM1_IRQHandler;
+    case TPM2_IRQn:  return TPM2_IRQHandler;
+    case PORTA_IRQn: return PORTA_IRQHandler;
+    case PORTD_IRQn: return PORTD_IRQHandler;
+    case DMA0_IRQn:  return DMA0_IRQHandler;
+    case DMA1_IRQn:  return DMA1_IRQHandler;
+    case DMA2_IRQn:  return DMA2_IRQHandler;
+    case DMA3_IRQn:  return DMA3_IRQHandler;
+    case SPI0_IRQn:  return SPI0_IRQHandler;
+    case SPI1_IRQn:  return SPI1_IRQHandler;
+  }
+  return 0;
+}
+
+/*!
+ *  Atende as interrupções pendentes, da de menor número para a de maior.
+ */
+void dispatchIrqs() {
+  if (sim.primask || sim.inHandler) {
+    return;
+  }
+  for (uint32_t calls = 0; ; calls++) {
+    syncAll();
+    uint32_t pending = pendingIrqs();
+    if (pending == 0 && !sim.sysTick.pending) {
+      return;
+    }
+    if (calls == 100000) {
+      fatal("mkl_HostSim: interrupcao nao e limpa pela sua rotina de servico.\n");
+    }
+
+    /*!
+     *  O SysTick (exceção 15) é atendido antes das interrupções externas.
+     */
+    if (sim.sysTick.pending) {
+      if (!SysTick_Handler) {
+        fatal("mkl_HostSim: SysTick com TICKINT sem SysTick_Handler.\n");
+      }
+      sim.sysTick.pending = false;
+      sim.inHandler = true;
+      callApplication(SysTick_Handler);
+      sim.inHandler = false;
+      continue;
+    }
+    int irq = __builtin_ctz(pending);
+    IrqHandler handler = irqHandler(irq);
+    if (!handler) {
+      fatal("mkl_HostSim: interrupcao habilitada sem rotina de servico.\n");
+    }
+    sim.nvicPending &= ~(1u << irq);
+    sim.inHandler = true;
+    callApplication(handler);
+    sim.inHandler = false;
+  }
+}
+
+void checkTimeLimit() {
+  if (sim.now >= sim.timeLimit) {
+    fflush(stdout);
+    exit(0);
+  }
+}
+
+/*!
+ *  ---------------------------------------------------------------------------
+ *  Tratamento dos acessos
+ *  ---------------------------------------------------------------------------
+ */
+bool isMapped(uintptr_t address) {
+  return (address >= kPeripheralBase && address < kPeripheralBase + kPeripheralSize) ||
+         (address >= kPrivateBase && address < kPrivateBase + kPrivateSize);
+}
+
+void checkClock(uintptr_t address) {
+  uint32_t scgc4 = R(kSimSCGC4);
+  uint32_t scgc5 = R(kSimSCGC5);
+  uint32_t scgc6 = R(kSimSCGC6);
+  if (address >= PORTA_BASE && address < PORTE_BASE + 0x1000) {
+    if (!(scgc5 & (SIM_SCGC5_PORTA_MASK << ((address - PORTA_BASE) >> 12)))) {
+      fatal("mkl_HostSim: acesso ao PORT com o clock desabilitado (SIM_SCGC5).\n");
+    }
+  } else if (address >= PIT_BASE && address < PIT_BASE + 0x1000) {
+    if (!(scgc6 & SIM_SCGC6_PIT_MASK)) {
+      fatal("mkl_HostSim: acesso ao PIT com o clock desabilitado (SIM_SCGC6).\n");
+    }
+  } else if (address >= TPM0_BASE && address < TPM2_BASE + 0x1000) {
+    if (!(scgc6 & (SIM_SCGC6_TPM0_MASK << ((address - TPM0_BASE) >> 12)))) {
+      fatal("mkl_HostSim: acesso ao TPM com o clock desabilitado (SIM_SCGC6).\n");
+    }
+  } else if (address >= SPI0_BASE && address < SPI1_BASE + 0x1000) {
+    if (!(scgc4 & (SIM_SCGC4_SPI0_MASK << ((address - SPI0_BASE) >> 12)))) {
+      fatal("mkl_HostSim: acesso ao SPI com o clock desabilitado (SIM_SCGC4).\n");
+    }
+  } else if (address >= DMA_BASE && address < DMA_BASE + 0x1000) {
+    if (!(R(kSimSCGC7) & SIM_SCGC7_DMA_MASK)) {
+      fatal("mkl_HostSim: acesso ao DMA com o clock desabilitado (SIM_SCGC7).\n");
+    }
+  } else if (address >= DMAMUX0_BASE && address < DMAMUX0_BASE + 0x1000) {
+    if (!(scgc6 & SIM_SCGC6_DMAMUX_MASK)) {
+      fatal("mkl_HostSim: acesso ao DMAMUX com o clock desabilitado (SIM_SCGC6).\n");
+    }
+  }
+}
+
+void refresh(uintptr_t address) {
+  if (address >= PIT_BASE && address < PIT_BASE + 0x1000) {
+    pitRefresh(address);
+  } else if (address >= TPM0_BASE && address < TPM2_BASE + 0x1000) {
+    tpmRefresh((address - TPM0_BASE) >> 12, address);
+  } else if (address >= GPIOA_BASE && address < GPIOE_BASE + 0x40) {
+    gpioRefresh((address - GPIOA_BASE) >> 6, address);
+  } else if (address >= SPI0_BASE && address < SPI1_BASE + 0x1000) {
+    spiRefresh((address - SPI0_BASE) >> 12, address);
+  } else if (address >= NVIC_BASE && address < NVIC_BASE + 0x400) {
+    nvicRefresh(address);
+  } else if (address >= SysTick_BASE && address < SysTick_BASE + 0x10) {
+    sysTickRefresh(address);
+  }
+}
+
+void afterRead(uintptr_t address) {
+  if (address >= SPI0_BASE && address < SPI1_BASE + 0x1000) {
+    spiRead((address - SPI0_BASE) >> 12, address);
+  } else if (address >= SysTick_BASE && address < SysTick_BASE + 0x10) {
+    sysTickRead(address);
+  }
+}
+
+void afterWrite(uintptr_t address, uint32_t old) {
+  if (address >= PIT_BASE && address < PIT_BASE + 0x1000) {
+    pitWrite(address, old);
+  } else if (address >= TPM0_BASE && address < TPM2_BASE + 0x1000) {
+    tpmWrite((address - TPM0_BASE) >> 12, address, old);
+  } else if (address >= SIM_BASE && address < SIM_BASE + 0x2000) {
+    pitUpdateRunning(0);
+    pitUpdateRunning(1);
+    for (int n = 0; n < 3; n++) {
+      tpmUpdateRunning(n);
+    }
+  } else if (address >= PORTA_BASE && address < PORTE_BASE + 0x1000) {
+    portWrite((address - PORTA_BASE) >> 12, address, old);
+  } else if (address >= GPIOA_BASE && address < GPIOE_BASE + 0x40) {
+    gpioWrite((address - GPIOA_BASE) >> 6, address, old);
+  } else if (address >= SPI0_BASE && address < SPI1_BASE + 0x1000) {
+    spiWrite((address - SPI0_BASE) >> 12, address, old);
+  } else if ((address >= DMA_BASE && address < DMA_BASE + 0x1000) ||
+             (address >= DMAMUX0_BASE && address < DMAMUX0_BASE + 0x1000)) {
+    dmaWrite(address, old);
+  } else if (address >= NVIC_BASE && address < NVIC_BASE + 0x400) {
+    nvicWrite(address);
+  } else if (address >= SysTick_BASE && address < SysTick_BASE + 0x10) {
+    sysTickWrite(address, old);
+  }
+}
+
+/*!
+ *  Indica se a instrução x86 em "code" lê e escreve o operando de memória
+ *  (or, and, xor, add, sub, inc, dec, not, neg, deslocamentos e bts/btr/btc),
+ *  o que corresponde a dois acessos ao barramento no Cortex-M0+.
+ */
+bool isReadModifyWrite(const uint8_t *code) {
+  while (*code == 0x66 || *code == 0x67 || *code == 0xF0 ||
+         *code == 0xF2 || *code == 0xF3) {
+    code++;
+  }
+  if ((*code & 0xF0) == 0x40) {
+    code++;
+  }
+  uint8_t opcode = code[0];
+  uint8_t reg = (code[1] >> 3) & 0x7;
+  switch (opcode) {
+    case 0x00: case 0x01: case 0x08: case 0x09: case 0x10: case 0x11:
+    case 0x18: case 0x19: case 0x20: case 0x21: case 0x28: case 0x29:
+    case 0x30: case 0x31: case 0x86: case 0x87:
+    case 0xC0: case 0xC1: case 0xD0: case 0xD1: case 0xD2: case 0xD3:
+      return true;
+    case 0x80: case 0x81: case 0x83:
+      return reg != 7;
+    case 0xF6: case 0xF7:
+      return reg == 2 || reg == 3;
+    case 0xFE: case 0xFF:
+      return reg == 0 || reg == 1;
+    case 0x0F:
+      return code[1] == 0xAB || code[1] == 0xB3 || code[1] == 0xBB ||
+             code[1] == 0xBA || code[1] == 0xC0 || code[1] == 0xC1 ||
+             code[1] == 0xB0 || code[1] == 0xB1;
+  }
+  return false;
+}
+
+/*!
+ *  Laço de espera: leituras idênticas e repetidas de um registrador avançam
+ *  o tempo diretamente até o próximo evento dos temporizadores.
+ */
+void detectSpin(uintptr_t address) {
+  uint32_t value = R(address);
+  if (address == sim.spinAddress && value == sim.spinValue) {
+    if (++sim.spinCount >= kSpinReads) {
+      uint64_t next = nextEvent();
+      if (next != kNever) {
+        advanceTo(next);
+        refresh(address);
+      }
+      sim.spinCount = 0;
+    }
+  } else {
+    sim.spinAddress = address;
+    sim.spinValue = value;
+    sim.spinCount = 0;
+  }
+}
+
+hostsim_Region regionOf(uintptr_t address) {
+  if (address >= GPIOA_BASE && address < GPIOE_BASE + 0x40) {
+    return hostsim_GPIO;
+  } else if (address >= PORTA_BASE && address < PORTE_BASE + 0x1000) {
+    return hostsim_PORT;
+  } else if (address >= PIT_BASE && address < PIT_BASE + 0x1000) {
+    return hostsim_PIT;
+  } else if (address >= TPM0_BASE && address < TPM2_BASE + 0x1000) {
+    return hostsim_TPM;
+  } else if (address >= SIM_BASE && address < SIM_BASE + 0x2000) {
+    return hostsim_SIM;
+  } else if (address >= NVIC_BASE && address < NVIC_BASE + 0x400) {
+    return hostsim_NVIC;
+  } else if (address >= SPI0_BASE && address < SPI1_BASE + 0x1000) {
+    return hostsim_SPI;
+  } else if ((address >= DMA_BASE && address < DMA_BASE + 0x1000) ||
+             (address >= DMAMUX0_BASE && address < DMAMUX0_BASE + 0x1000)) {
+    return hostsim_DMA;
+  } else if (address >= SysTick_BASE && address < SysTick_BASE + 0x10) {
+    return hostsim_SysTick;
+  }
+  return hostsim_Other;
+}
+
+uint32_t countAccess(uintptr_t address, bool write, bool rmw) {
+  hostsim_Region region = regionOf(address);
+  uint32_t cost = address >= kPrivateBase ? kPrivateAccessCycles
+                                          : kBridgeAccessCycles;
+  uint32_t cycles = 0;
+  if (!write || rmw) {
+    sim.stats.reads[region]++;
+    cycles += cost;
+  }
+  if (write) {
+    sim.stats.writes[region]++;
+    cycles += cost;
+  }
+  sim.stats.cycles += cycles;
+  return cycles;
+}
+
+void beforeAccess(uintptr_t address, bool write, bool rmw) {
+  checkClock(address);
+  advanceTo(sim.now + countAccess(address, write, rmw));
+  refresh(address);
+  if (write) {
+    sim.spinAddress = 0;
+  } else {
+    detectSpin(address);
+  }
+}
+
+inline void *pageOf(uintptr_t address) {
+  return reinterpret_cast<void *>(address & ~(kPageSize - 1));
+}
+
+void onSegmentationFault(int, siginfo_t *info, void *context) {
+  ucontext_t *uc = static_cast<ucontext_t *>(context);
+  uintptr_t address = reinterpret_cast<uintptr_t>(info->si_addr);
+  if (sim.trapActive || !isMapped(address)) {
+    signal(SIGSEGV, SIG_DFL);
+    return;
+  }
+  bool write = (uc->uc_mcontext.gregs[REG_ERR] & 0x2) != 0;
+  bool rmw = write && isReadModifyWrite(
+      reinterpret_cast<const uint8_t *>(uc->uc_mcontext.gregs[REG_RIP]));
+  sim.trapOffset = address & 0x3;
+  address &= ~static_cast<uintptr_t>(0x3);
+  beforeAccess(address, write, rmw);
+  sim.trapActive = true;
+  sim.trapAddress = address;
+  sim.trapWrite = write;
+  sim.trapOld = R(address);
+  mprotect(pageOf(address), kPageSize, PROT_READ | PROT_WRITE);
+  uc->uc_mcontext.gregs[REG_EFL] |= 0x100;
+}
+
+/*!
+ *  Fim da instrução que acessou um registrador ou, com a contagem ligada,
+ *  de qualquer instrução da aplicação.
+ */
+void onSingleStep(int, siginfo_t *, void *context) {
+  ucontext_t *uc = static_cast<ucontext_t *>(context);
+  if (sim.counting) {
+    sim.stats.instructions++;
+  }
+  if (!sim.trapActive) {
+    if (!sim.counting) {
+      signal(SIGTRAP, SIG_DFL);
+    }
+    return;
+  }
+  if (!sim.counting) {
+    uc->uc_mcontext.gregs[REG_EFL] &= ~0x100;
+  }
+  mprotect(pageOf(sim.trapAddress), kPageSize, PROT_NONE);
+  sim.trapActive = false;
+  if (sim.trapWrite) {
+    afterWrite(sim.trapAddress, sim.trapOld);
+  } else {
+    afterRead(sim.trapAddress);
+  }
+}
+
+void resetRegisters() {
+  memset(peripheralAlias, 0, kPeripheralSize);
+  memset(privateAlias, 0, kPrivateSize);
+  R(kSimSCGC4) = 0xF0000030u;
+  R(kSimSCGC5) = 0x00000182u;
+  R(kSimSCGC6) = 0x00000001u;
+  R(SIM_BASE + 0x1040) = 0x00000100u;
+  R(SIM_BASE + 0x1044) = 0x00010000u;
+  R(PIT_BASE) = PIT_MCR_MDIS_MASK;
+  R(spiBase(0)) = 0x20000004u;
+  R(spiBase(1)) = 0x20000004u;
+  hostsim_PinObserver observer = sim.observer;
+  hostsim_SpiObserver spiObserver = sim.spiObserver;
+  uint64_t timeLimit = sim.timeLimit;
+  bool counting = sim.counting;
+  memset(&sim, 0, sizeof(sim));
+  sim.observer = observer;
+  sim.spiObserver = spiObserver;
+  sim.timeLimit = timeLimit;
+  sim.counting = counting;
+}
+
+/*!
+ *  Mapeia as janelas de periféricos antes da construção dos objetos globais
+ *  da aplicação, que já acessam os registradores.
+ */
+__attribute__((constructor(101))) void initialize() {
+  int fd = memfd_create("mkl_HostSim", 0);
+  if (fd < 0 || ftruncate(fd, kPeripheralSize + kPrivateSize) != 0) {
+    fatal("mkl_HostSim: falha ao criar a memoria dos registradores.\n");
+  }
+  peripheralAlias = static_cast<uint8_t *>(mmap(0, kPeripheralSize,
+      PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0));
+  privateAlias = static_cast<uint8_t *>(mmap(0, kPrivateSize,
+      PROT_READ | PROT_WRITE, MAP_SHARED, fd, kPeripheralSize));
+  void *peripherals = mmap(reinterpret_cast<void *>(kPeripheralBase),
+      kPeripheralSize, PROT_NONE, MAP_SHARED | MAP_FIXED_NOREPLACE, fd, 0);
+  void *core = mmap(reinterpret_cast<void *>(kPrivateBase), kPrivateSize,
+      PROT_NONE, MAP_SHARED | MAP_FIXED_NOREPLACE, fd, kPeripheralSize);
+  if (peripheralAlias == MAP_FAILED || privateAlias == MAP_FAILED ||
+      peripherals != reinterpret_cast<void *>(kPeripheralBase) ||
+      core != reinterpret_cast<void *>(kPrivateBase)) {
+    fatal("mkl_HostSim: falha ao mapear os enderecos dos perifericos.\n");
+  }
+  close(fd);
+
+  struct sigaction action;
+  memset(&action, 0, sizeof(action));
+  action.sa_flags = SA_SIGINFO;
+  action.sa_sigaction = onSegmentationFault;
+  sigaction(SIGSEGV, &action, 0);
+  action.sa_sigaction = onSingleStep;
+  sigaction(SIGTRAP, &action, 0);
+
+  sim.timeLimit = kNever;
+  resetRegisters();
+}
+
+}  // namespace
+
+/*!
+ *   @fn         reset
+ *
+ *   @brief      Retorna os registradores e o tempo virtual ao estado de reset.
+ */
+void mkl_HostSim::reset() {
+  Uncounted uncounted;
+  resetRegisters();
+}
+
+/*!
+ *   @fn         cycles
+ *
+ *   @brief      Retorna o tempo virtual, em ciclos do núcleo.
+ */
+uint64_t mkl_HostSim::cycles() {
+  Uncounted uncounted;
+  return sim.now;
+}
+
+/*!
+ *   @fn         run
+ *
+ *   @brief      Avança o tempo virtual, atendendo as interrupções.
+ *
+ *   @param[in]  cycles - número de ciclos do núcleo a avançar.
+ */
+void mkl_HostSim::run(uint64_t cycles) {
+  Uncounted uncounted;
+  uint64_t target = sim.now + cycles;
+  dispatchIrqs();
+  for (uint64_t next = nextEvent(); next <= target && next > sim.now;
+       next = nextEvent()) {
+    advanceTo(next);
+    dispatchIrqs();
+    checkTimeLimit();
+  }
+  advanceTo(target);
+  dispatchIrqs();
+  checkTimeLimit();
+}
+
+/*!
+ *   @fn         setTimeLimit
+ *
+ *   @brief      Encerra a simulação ao atingir o tempo virtual indicado.
+ *
+ *   Útil para executar no host firmwares cujo laço principal não termina.
+ *
+ *   @param[in]  cycles - tempo virtual, em ciclos, de término da simulação.
+ */
+void mkl_HostSim::setTimeLimit(uint64_t cycles) {
+  Uncounted uncounted;
+  sim.timeLimit = cycles;
+}
+
+/*!
+ *   @fn         enableIrq
+ *
+ *   @brief      Equivalente a __enable_irq(): limpa o PRIMASK.
+ */
+void mkl_HostSim::enableIrq() {
+  Uncounted uncounted;
+  sim.primask = false;
+  dispatchIrqs();
+}
+
+/*!
+ *   @fn         disableIrq
+ *
+ *   @brief      Equivalente a __disable_irq(): ajusta o PRIMASK.
+ */
+void mkl_HostSim::disableIrq() {
+  Uncounted uncounted;
+  sim.primask = true;
+}
+
+/*!
+ *   @fn         readPrimask
+ *
+ *   @brief      Equivalente a __get_PRIMASK(): 1 com as interrupções
+ *               desabilitadas.
+ */
+uint32_t mkl_HostSim::readPrimask() {
+  Uncounted uncounted;
+  return sim.primask ? 1 : 0;
+}
+
+/*!
+ *   @fn         waitForInterrupt
+ *
+ *   @brief      Equivalente a __WFI(): dorme até uma interrupção pendente.
+ *
+ *   O tempo virtual avança de evento em evento até que alguma interrupção
+ *   habilitada fique pendente. Com o PRIMASK ajustado o núcleo acorda sem
+ *   atender a interrupção, como no hardware.
+ */
+void mkl_HostSim::waitForInterrupt() {
+  Uncounted uncounted;
+  syncAll();
+  while (pendingIrqs() == 0) {
+    uint64_t next = nextEvent();
+    if (next == kNever) {
+      fatal("mkl_HostSim: WFI sem nenhum evento futuro.\n");
+    }
+    advanceTo(next);
+    checkTimeLimit();
+  }
+  dispatchIrqs();
+}
+
+/*!
+ *   @fn         setInputPin
+ *
+ *   @brief      Força o nível lógico externo de um pino.
+ *
+ *   @param[in]  GPIONumber - número do GPIO (0 = A, ..., 4 = E).
+ *               pinNumber - número do pino.
+ *               level - nível lógico aplicado ao pino.
+ */
+void mkl_HostSim::setInputPin(uint8_t GPIONumber, uint8_t pinNumber, int level) {
+  Uncounted uncounted;
+  uint32_t bit = 1u << pinNumber;
+  sim.externalDriven[GPIONumber] |= bit;
+  if (level) {
+    sim.externalLevel[GPIONumber] |= bit;
+  } else {
+    sim.externalLevel[GPIONumber] &= ~bit;
+  }
+  portDetectEdges(GPIONumber);
+}
+
+/*!
+ *   @fn         startPulseTrain
+ *
+ *   @brief      Injeta um trem de pulsos em um pino de entrada.
+ *
+ *   O pino sobe a cada "period" ciclos, a partir de um período após a
+ *   chamada, e desce "highCycles" ciclos depois de cada subida. Um novo
+ *   trem no mesmo pino substitui o anterior.
+ *
+ *   @param[in]  GPIONumber - número do GPIO (0 = A, ..., 4 = E).
+ *               pinNumber - número do pino.
+ *               period - período, em ciclos do núcleo.
+ *               highCycles - largura do pulso em '1', menor que o período.
+ *               pulses - número de pulsos.
+ */
+void mkl_HostSim::startPulseTrain(uint8_t GPIONumber, uint8_t pinNumber,
+                                  uint64_t period, uint64_t highCycles,
+                                  uint32_t pulses) {
+  Uncounted uncounted;
+  PulseTrain *train = 0;
+  for (int i = 0; i < kPulseTrains; i++) {
+    PulseTrain &p = sim.trains[i];
+    if ((p.active && p.port == GPIONumber && p.pin == pinNumber) ||
+        (!p.active && !train)) {
+      train = &p;
+    }
+  }
+  if (!train) {
+    fatal("mkl_HostSim: trens de pulsos demais.\n");
+  }
+  train->active = pulses != 0;
+  train->port = GPIONumber;
+  train->pin = pinNumber;
+  train->level = 1;
+  train->nextEdge = sim.now + period;
+  train->period = period;
+  train->highCycles = highCycles;
+  train->remaining = pulses;
+}
+
+/*!
+ *   @fn         releaseInputPin
+ *
+ *   @brief      Deixa o pino flutuando, restando apenas o resistor de pull.
+ */
+void mkl_HostSim::releaseInputPin(uint8_t GPIONumber, uint8_t pinNumber) {
+  Uncounted uncounted;
+  sim.externalDriven[GPIONumber] &= ~(1u << pinNumber);
+  portDetectEdges(GPIONumber);
+}
+
+/*!
+ *   @fn         readOutputPins
+ *
+ *   @brief      Retorna o nível dos pinos configurados como saída GPIO.
+ */
+uint32_t mkl_HostSim::readOutputPins(uint8_t GPIONumber) {
+  Uncounted uncounted;
+  return sim.outputLevels[GPIONumber];
+}
+
+/*!
+ *   @fn         setPinObserver
+ *
+ *   @brief      Registra o observador das mudanças nos pinos de saída.
+ */
+void mkl_HostSim::setPinObserver(hostsim_PinObserver observer) {
+  Uncounted uncounted;
+  sim.observer = observer;
+}
+
+/*!
+ *   @fn         setSpiObserver
+ *
+ *   @brief      Registra o observador dos bytes transmitidos pelo SPI.
+ */
+void mkl_HostSim::setSpiObserver(hostsim_SpiObserver observer) {
+  Uncounted uncounted;
+  sim.spiObserver = observer;
+}
+
+/*!
+ *   @fn         readBusStats
+ *
+ *   @brief      Lê os contadores acumulados de acessos ao barramento.
+ *
+ *   @param[out] stats - contadores de leituras e escritas por região e
+ *                       custo estimado, em ciclos do Cortex-M0+.
+ */
+void mkl_HostSim::readBusStats(hostsim_BusStats *stats) {
+  Uncounted uncounted;
+  *stats = sim.stats;
+}
+
+/*!
+ *   @fn         resetBusStats
+ *
+ *   @brief      Zera os contadores de acessos ao barramento.
+ */
+void mkl_HostSim::resetBusStats() {
+  Uncounted uncounted;
+  memset(&sim.stats, 0, sizeof(sim.stats));
+}
+
+/*!
+ *   @fn         countInstructions
+ *
+ *   @brief      Liga ou desliga a contagem das instruções da aplicação.
+ *
+ *   Com a contagem ligada, o trap flag do x86-64 fica em '1' no código da
+ *   aplicação e nas rotinas de interrupção, e cada instrução soma 1 em
+ *   hostsim_BusStats::instructions.
+ *
+ *   @param[in]  enable - true para ligar a contagem.
+ *
+ *   @return     O estado anterior da contagem, para ser restaurado.
+ */
+bool mkl_HostSim::countInstructions(bool enable) {
+  Uncounted uncounted;
+  bool previous = sim.counting;
+  sim.counting = enable;
+  return previous;
+}
+
+/*!
+ *  Orçamento com largura fixa no relatório, "-" se não há limite.
+ */
+static void writeBudget(FILE *stream, uint64_t budget) {
+  if (budget == HOSTSIM_NO_BUDGET) {
+    fprintf(stream, "%-8s", "-");
+  } else {
+    fprintf(stream, "%-8llu", static_cast<unsigned long long>(budget));
+  }
+}
+
+/*!
+ *   @fn         writeReport
+ *
+ *   @brief      Escreve uma linha de relatório do custo de uma rotina.
+ *
+ *   A linha tem formato fixo, com os valores médios por chamada, para que
+ *   relatórios de versões diferentes possam ser comparados com diff.
+ *
+ *   @param[in]  stream - arquivo de saída.
+ *               name - nome da rotina medida.
+ *               before, after - contadores lidos antes e depois das chamadas.
+ *               calls - número de chamadas medidas.
+ *               budget - orçamento, em ciclos por chamada
+ *               (HOSTSIM_NO_BUDGET = sem limite).
+ *               instructionBudget - orçamento, em instruções contadas por
+ *               chamada (HOSTSIM_NO_BUDGET = sem limite).
+ *
+ *   @return     true se o custo por chamada está dentro dos orçamentos.
+ */
+bool mkl_HostSim::writeReport(FILE *stream, const char *name,
+                              const hostsim_BusStats &before,
+                              const hostsim_BusStats &after,
+                              uint32_t calls, uint64_t budget,
+                              uint64_t instructionBudget) {
+  Uncounted uncounted;
+  static const char *const kRegionNames[hostsim_Regions] = {
+    "gpio", "port", "pit", "tpm", "sim", "nvic", "spi", "dma", "systick", "other"
+  };
+  if (calls == 0) {
+    calls = 1;
+  }
+  uint64_t cycles = (after.cycles - before.cycles) / calls;
+  uint64_t instructions = (after.instructions - before.instructions) / calls;
+  bool withinBudget = cycles <= budget && instructions <= instructionBudget;
+  fprintf(stream, "%-28s cycles=%-8llu budget=", name,
+          static_cast<unsigned long long>(cycles));
+  writeBudget(stream, budget);
+  fprintf(stream, " instr=%-8llu budget=",
+          static_cast<unsigned long long>(instructions));
+  writeBudget(stream, instructionBudget);
+  fprintf(stream, " %s", withinBudget ? "ok  " : "OVER");
+  for (int region = 0; region < hostsim_Regions; region++) {
+    uint64_t reads = after.reads[region] - before.reads[region];
+    uint64_t writes = after.writes[region] - before.writes[region];
+    if (reads || writes) {
+      fprintf(stream, " %s=%lluR/%lluW", kRegionNames[region],
+              static_cast<unsigned long long>(reads / calls),
+              static_cast<unsigned long long>(writes / calls));
+    }
+  }
+  fprintf(stream, "\n");
+  return withinBudget;
+}
@@ -0,0 +1,225 @@
+/*!
+ * @copyright   © 2017 UFAM - Universidade Federal do Amazonas.
+ *
+ * @brief       Interface do simulador de registradores da MKL25Z4 para o host (Linux).
+ *
+ * @file        mkl_HostSim.h
+ * @version     1.8
+ * @date        17 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   SIM, PORT, GPIO, PIT, TPM, SPI, DMA, NVIC e SysTick simulados.
+ *              +compiler     Kinetis® Design Studio IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão (data): Descrição breve.
+ *                             ++ 1.0 (17 Outubro 2026): Versão inicial.
+ *                             ++ 1.1 (17 Outubro 2026): Modelo do SPI.
+ *                             ++ 1.2 (17 Outubro 2026): Modelo do DMA, do DMAMUX e do PCS0 do SPI.
+ *                             ++ 1.3 (17 Outubro 2026): Modelo do SysTick.
+ *                             ++ 1.4 (17 Outubro 2026): readPrimask, para __get_PRIMASK/__set_PRIMASK.
+ *                             ++ 1.5 (17 Outubro 2026): Saídas PWM dos canais do TPM nos pinos (ALT3/ALT4).
+ *                             ++ 1.6 (17 Outubro 2026): Captura de entrada do TPM e trens de pulsos nos pinos (startPulseTrain).
+ *                             ++ 1.7 (17 Outubro 2026): Interrupções do SPI (SPIE e SPTIE).
+ *                             ++ 1.8 (17 Outubro 2026): Contagem das instruções executadas pela aplicação (countInstructions).
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas
+ *              +courses      Engenharia da Computação
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Versão inicial:
+ *                             ++ Patrick Chagas dos Santos <patrick.chagas@gmail.com>
+ *                             ++ Gabriel Montenegro Villacrez <gvmontenegro19@gmail.com>
+ *                             ++ Andrezza Bonfim <andrezzabonfiiim@gmail.com>
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ *              Este programa é um software livre; Você pode redistribuí-lo
+ *              e/ou modificá-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              versão 3 da licença, ou qualquer versão posterior.
+ *
+ *              Este programa é distribuído na esperança de que seja útil,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implícita de
+ *              COMERCIALIZAÇÃO OU USO PARA UM DETERMINADO PROPÓSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#ifndef MKL_HOSTSIM_H_
+#define MKL_HOSTSIM_H_
+
+#include <stdint.h>
+#include <stdio.h>
+
+/*!
+ *  Frequências de relógio simuladas (modo FEI, padrão após o reset).
+ */
+#define HOSTSIM_CORE_CLOCK   20971520u
+#define HOSTSIM_BUS_CLOCK    20971520u
+#define HOSTSIM_TPM_CLOCK    20971520u
+
+/*!
+ *  Orçamento sem limite, em writeReport.
+ */
+#define HOSTSIM_NO_BUDGET    (~0ull)
+
+/*!
+ *  Observador de mudanças nos pinos de saída de uma porta.
+ *
+ *  É chamado dentro do tratador de sinal do simulador, logo deve apenas
+ *  atualizar estado próprio (sem alocação dinâmica e sem E/S bufferizada).
+ */
+typedef void (*hostsim_PinObserver)(uint8_t GPIONumber, uint32_t oldLevels,
+                                    uint32_t newLevels, uint64_t cycle);
+
+/*!
+ *  Observador dos bytes transmitidos pelo SPI.
+ *
+ *  É chamado ao fim do deslocamento de cada byte, com as mesmas restrições
+ *  do observador de pinos.
+ */
+typedef void (*hostsim_SpiObserver)(uint8_t SPINumber, uint8_t data,
+                                    uint64_t cycle);
+
+/*!
+ *  Regiões do mapa de memória contabilizadas no modelo de custo.
+ */
+typedef enum {
+  hostsim_GPIO = 0,
+  hostsim_PORT,
+  hostsim_PIT,
+  hostsim_TPM,
+  hostsim_SIM,
+  hostsim_NVIC,
+  hostsim_SPI,
+  hostsim_DMA,
+  hostsim_SysTick,
+  hostsim_Other,
+  hostsim_Regions
+} hostsim_Region;
+
+/*!
+ *  Contadores acumulados de acessos ao barramento, do custo estimado, em
+ *  ciclos do Cortex-M0+, desses acessos e das instruções executadas pela
+ *  aplicação com a contagem ligada (countInstructions).
+ */
+typedef struct {
+  uint64_t reads[hostsim_Regions];
+  uint64_t writes[hostsim_Regions];
+  uint64_t cycles;
+  uint64_t instructions;
+} hostsim_BusStats;
+
+/*!
+ *  @class    mkl_HostSim
+ *
+ *  @brief    Simulador do mapa de registradores da MKL25Z4 executado no host.
+ *
+ *  @details  Os blocos SIM, PORT, GPIO, PIT, TPM, SPI, DMA, NVIC e SysTick
+ *            são mapeados nos seus endereços reais (0x40000000 a 0x400FFFFF e
+ *            0xE000E000) em páginas sem permissão de acesso. Cada acesso dos drivers gera
+ *            uma falha de página que é tratada pelo simulador: o registrador é
+ *            atualizado, a instrução é executada passo a passo e a semântica
+ *            do registrador (w1c, PSOR/PCOR/PTOR, contadores, flags) é
+ *            aplicada.
+ *
+ *            O tempo virtual é contado em ciclos do núcleo e avança a cada
+ *            acesso ao barramento, em run() e em waitForInterrupt(). As
+ *            interrupções são atendidas nesses pontos seguros, chamando as
+ *            rotinas PIT_IRQHandler, TPMx_IRQHandler, PORTx_IRQHandler,
+ *            DMAx_IRQHandler, SPIx_IRQHandler e SysTick_Handler definidas
+ *            pela aplicação.
+ *
+ *            O SysTick conta os ciclos do núcleo (CLKSOURCE = 1) ou os
+ *            ciclos/16 (CLKSOURCE = 0). Uma escrita no VAL recomeça a
+ *            contagem do LOAD no mesmo ciclo.
+ *
+ *            Os canais do TPM em modo PWM (MSB, com ELSB ou ELSA) acionam os
+ *            seus pinos (ALT3/ALT4), vistos pelo observador de pinos; o
+ *            CnV e o MOD são trocados no fim do período. Nos canais em
+ *            captura de entrada, a borda no pino copia o contador para o
+ *            CnV; startPulseTrain injeta trens de pulsos com bordas em
+ *            instantes exatos do tempo virtual.
+ *
+ *            As transferências do DMA são feitas no instante da requisição,
+ *            sem custo para a CPU: não entram nas estatísticas de acesso ao
+ *            barramento.
+ *
+ *            O custo dos acessos não mede o trabalho da CPU entre eles. Com
+ *            countInstructions(true), cada instrução da aplicação é
+ *            executada passo a passo (trap flag do x86-64) e contada; o
+ *            código do simulador chamado pela aplicação (run,
+ *            waitForInterrupt, readBusStats...) não entra na contagem, mas
+ *            as rotinas de interrupção atendidas por ele entram. São
+ *            instruções do host, no nível de otimização do build: uma
+ *            medida relativa do trabalho da CPU, para comparar versões, e
+ *            não os ciclos do Cortex-M0+. Cada instrução contada custa um
+ *            sinal: a contagem deve ficar ligada só durante as medições.
+ *
+ *            Requer Linux x86-64.
+ *
+ *  @section  EXAMPLES USAGE
+ *
+ *            Avanço do tempo e estímulo dos pinos de entrada.
+ *             +fn mkl_HostSim::run(20971);
+ *             +fn mkl_HostSim::setInputPin(1, 8, 0);
+ *             +fn mkl_HostSim::startPulseTrain(0, 12, 20971, 2000, 100);
+ *             +fn levels = mkl_HostSim::readOutputPins(2);
+ *
+ *            Medição do custo de uma rotina e comparação com o orçamento.
+ *             +fn mkl_HostSim::countInstructions(true);
+ *             +fn mkl_HostSim::readBusStats(&before);
+ *             +fn disp.updateDisplays();
+ *             +fn mkl_HostSim::readBusStats(&after);
+ *             +fn ok = mkl_HostSim::writeReport(stdout, "updateDisplays",
+ *                                               before, after, 1, 1500, 900);
+ */
+class mkl_HostSim {
+ public:
+  /*!
+   * Métodos de controle do tempo virtual.
+   */
+  static void reset();
+  static uint64_t cycles();
+  static void run(uint64_t cycles);
+  static void setTimeLimit(uint64_t cycles);
+
+  /*!
+   * Métodos equivalentes aos intrínsecos do núcleo.
+   */
+  static void enableIrq();
+  static void disableIrq();
+  static uint32_t readPrimask();
+  static void waitForInterrupt();
+
+  /*!
+   * Métodos de estímulo e observação dos pinos.
+   */
+  static void setInputPin(uint8_t GPIONumber, uint8_t pinNumber, int level);
+  static void releaseInputPin(uint8_t GPIONumber, uint8_t pinNumber);
+  static void startPulseTrain(uint8_t GPIONumber, uint8_t pinNumber,
+                              uint64_t period, uint64_t highCycles,
+                              uint32_t pulses);
+  static uint32_t readOutputPins(uint8_t GPIONumber);
+  static void setPinObserver(hostsim_PinObserver observer);
+  static void setSpiObserver(hostsim_SpiObserver observer);
+
+  /*!
+   * Métodos do modelo de custo dos acessos ao barramento.
+   */
+  static void readBusStats(hostsim_BusStats *stats);
+  static void resetBusStats();
+  static bool countInstructions(bool enable);
+  static bool writeReport(FILE *stream, const char *name,
+                          const hostsim_BusStats &before,
+                          const hostsim_BusStats &after,
+                          uint32_t calls, uint64_t budget,
+                          uint64_t instructionBudget);
+};
+
+#endif  //  MKL_HOSTSIM_H_
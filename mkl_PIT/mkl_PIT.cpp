@@ -1,310 +1,433 @@
-/*!
- * @copyright    2017 UFAM - Universidade Federal do Amazonas.
- *
- * @brief       Interface de programao de aplicaes em C++ para o Periodic interrupt Timer (MKL25Z).
- *
- * @file        dsf_PIT_ocp.cpp
- * @version     1.0
- * @date        6 Julho 2017
- *
- * @section     HARDWARES & SOFTWARES
- *              +board        FRDM-KL25Z da NXP.
- *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
- *              +peripheral   PIT - Periodic Interrupt Timer.
- *              +compiler     Kinetis Design Studio IDE.
- *              +manual       L25P80M48SF0RM, Rev.3, September 2012
- *              +revisions    Verso (data): Descrio breve.
- *                             ++ 1.0 (6 Julho 2017): Verso inicial.
- *
- * @section     AUTHORS & DEVELOPERS
- *              +institution  Universidade Federal do Amazonas
- *              +courses      Engenharia da Computao / Engenharia Eltrica
- *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
- *              +student      Verso inicial:
- *                             ++ Jose Luis da Silva <joseluis70123@gmail.com>
- *
- * @section     LICENSE
- *
- *              GNU General Public License (GNU GPL).
- *
- *              Este programa  um software livre; Voc pode redistribu-lo
- *              e/ou modific-lo de acordo com os termos do "GNU General Public
- *              License" como publicado pela Free Software Foundation; Seja a
- *              verso 3 da licena, ou qualquer verso posterior.
- *
- *              Este programa  distribudo na esperana de que seja til,
- *              mas SEM QUALQUER GARANTIA; Sem a garantia implcita de
- *              COMERCIALIZAO OU USO PARA UM DETERMINADO PROPSITO.
- *              Veja o site da "GNU General Public License" para mais detalhes.
- *
- * @htmlonly    http://www.gnu.org/copyleft/gpl.html
- */
-
-#include "mkl_PIT.h"
-#include <MKL25Z4.h>
-#include <stdint.h>
-
-/*!
- *   @fn         bindChannel
- *
- *   @brief      Inicializa os ponteiros por canal.
- *
- *   Este mtodo associa ao objeto de software os endereos de memria dos
- *   registradores alocados para o canal indicado.
- *
- *   @param[in]  channel - canal dsf_Ch0_PIT ou canal dsf_Ch1_PIT usado.
- *   @remarks    Siglas e pginas do Manual de Referncia KL25:
- *               - PIT_LDVALn: Timer Load Value Register. Pg. 578.
- *               - PIT_CVALn:  Current Timer Value Register. Pg.578.
- *               - PIT_TCTRLn: Timer Control Register. Pg. 579.
- *               - PIT_TFLGn:  Timer Flag Register. Pg. 580.
- *               - PIT_MCR:    PIT Module Control Register. Pg. 575.
- */
-void mkl_PIT::bindChannel(PIT_ChPIT channel) {
-  /*!
-   * Clculo do endereo absoluto do LDVALn para o PIT.
-   * Address: LDVAL0 = 0x40037100 e LDVAL1 = 0x40037110
-   * addrLDVALn= 0x40037100(base)+ 0x10*channel, onde channel= 0 ou 1
-   */
-  addrLDVALn = (volatile unsigned int *)(0x40037100 + 0x10*channel);
-
-  /*!
-   * Clculo do endereo absoluto do LCVALn para o PIT.
-   * Address: LCVAL0 = 0x40037104 LCVAL1 = 0x40037114.
-   * addrCVALn = 0x40037104(base) + 0x10*channel,onde channel=0 ou 1
-   */
-  addrCVALn = (volatile unsigned int *)(0x40037104 + 0x10*channel);
-
-  /*!
-   * Clculo do endereo absoluto do TCTRLn para o PIT.
-   * Address: TCTRL0 = 0x40037108 e TCTRL1 = 0x40037118.
-   * addrTCTRLn = 0x40037108(base) + 0x10*channel,onde channel= 0 ou 1
-   */
-  addrTCTRLn = (volatile unsigned int *)(0x40037108 + 0x10*channel);
-
-  /*!
-   * Clculo do endereo absoluto do TFLGn para o PIT.
-   * Address: TFLG0 = 0x4003710C e TFLG1 = 0x4003711C.
-   * addrTFLGn = 0x4003710C(base) + 0x10*channel,onde channel= 0 ou 1
-   */
-  addrTFLGn = (volatile unsigned int *)(0x4003710C + 0x10*channel);
-}
-
-
-/*!
- *   @fn         enablePeripheralClock
- *
- *   @brief      Habilita o clock do Mdulo.
- *
- *   Este mtodo habilita a operao do mdulo, habilitando o clock
- *   de operao do perifrico.
- *
- *   @remarks  Siglas e pginas do Manual de Referncia KL25:
- *	        - SIM_SCGC6: System Clock Gating Control Register 6. Pg. 207.
- */
-void mkl_PIT::enablePeripheralClock() {
-  SIM_SCGC6 |= SIM_SCGC6_PIT_MASK;
-}
-
-
-/*!
- *   @fn         enablePeripheralModule
- *
- *   @brief      Habilita o clock dos Timers.
- *
- *   Este mtodo habilita a operao do barramento de clock, habilitando o clock
- *   de operao dos Timers dos 2 canais/
- *
- *   @remarks  Siglas e pginas do Manual de Referncia KL25:
- *             - PIT_MCR: PIT Module Control Register. Pg. 575.
- */
-void mkl_PIT::enablePeripheralModule() {
-  /*!
-   *  Ajusta '0' no MDIS do MCR.
-   */
-  PIT_MCR &= ~PIT_MCR_MDIS_MASK;
-}
-
-
-/*!
- *   @fn       disablePeripheralModule
- *
- *   @brief    Desabilita a operao dos Timers
- *
- *   Este mtodo desabilita a operao dos Timers, desligando o clock de
- *   operao dos 2 canais dos timers.
- *
- *   @warning  Desabilita todos os Timers para ambos os canais.
- *
- *   @remarks  Siglas e pginas do Manual de Referncia KL25:
- *            - PIT_MCR: PIT Module Control Register. Pg. 575.
- */
-void mkl_PIT::disablePeripheralModule() {
-  /*!
-   *  Ajusta '1' no MDIS do MCR.
-   */
-  PIT_MCR |= PIT_MCR_MDIS_MASK;
-}
-
-
-/*!
- *   @fn         setPeriod
- *
- *   @brief      seta o valor de fundo de escala de um canal.
- *
- *   Este mtodo define o valor de incio de um canal, onde o timer
- *   ir decrementar o valor corrente at alcanar 0.
- *
- *   @param[in]  time - nmero de ciclos de clock convertido em hexadecimal,
- *               de acordo com o periodo desejado.
- *               Nmero de ciclos de clock (LDVALn) = Perodo(desejado)*20MHz - 1.
- *
- *   @remarks    Sigla e pgina do Manual de Referncia KL25:
- *               - LDVALn: Timer Load Value Register. Pg. 578..
- */
-void mkl_PIT::setPeriod(uint32_t time) {
-  /*!
-   *  Ajusta LDVALn com "time".
-   */
-  *addrLDVALn = time;
-}
-
-
-/*!
- *   @fn       readCounter
- *
- *   @brief    L a contagem de um canal
- *
- *   Este mtodo retorna o valor corrente da contagem de um canal do timer.
- *
- *   @return   O valor do registrador que possui o valor corrente (CVALn) do canal.
- *
- *   @remarks  Siglas e pginas do Manual de Referncia KL25:
- *             - PIT_CVALn: Current Timer Value Register. Pg.578.
- */
-uint32_t mkl_PIT::readCounter() {
-  /*!
-   *  L e retorna o valor de CVALn
-   */
-  return *addrCVALn;
-}
-/*!
- *   @fn         enableTimer
- *
- *   @brief      Habilita a operao de um canal.
- *
- *   Este mtodo habilita a operao de contagem decrescente de um canal do timer.
- *
- *   @remarks  Siglas e pginas do Manual de Referncia KL25:
- *	       - PIT_TCTRLn: Timer Control Register. Pg. 579.
- */
-void mkl_PIT::enableTimer() {
-  /*!
-   *  Ajusta '1' no campo TEN.
-   */
-  *addrTCTRLn |= PIT_TCTRL_TEN_MASK;
-}
-
-
-/*!
- *   @fn         disableTimer
- *
- *   @brief      desabilita a operao de um canal.
- *
- *   Este mtodo desabilita a operao de contagem de um canal do Timer.
- *
- *   @remarks  Siglas e pginas do Manual de Referncia KL25:
- *	       - PIT_TCTRLn: Timer Control Register. Pg. 579.
- */
-void mkl_PIT::disableTimer() {
-  /*!
-   *  Ajusta '0' no campo TEN.
-   */
-  *addrTCTRLn &= ~PIT_TCTRL_TEN_MASK;
-}
-
-
-/*!
- *   @fn         resetCounter
- *
- *   @brief      reseta o valor do contador de um canal do Timer.
- *
- *   Este mtodo reseta o valor do contador de um canal. Caso se queira carregar
- *   um novo valor de incio em LDVALn,  necessrio que se desabilite e habilite os Timers.
- *
- *   @remarks  Siglas e pginas do Manual de Referncia KL25:
- *             - Timers. Pg. 581.
- */
-void mkl_PIT::resetCounter() {
-  disableTimer();
-  enableTimer();
-}
-
-/*!
- *   @fn       waitInterruptFlag
- *
- *   @brief    Aguarda a gerao de uma interrupo de um canal.
- *
- *   Este mtodo espera a ocorrncia de uma interrupo de um canal, monitorando a
- *   a flag de interrupo at que esta se torne verdadeira.
- *
- *   @remarks  Siglas e pginas do Manual de Referncia KL25:
- *             - PIT_TFLGn: Timer Flag Register. Pg.580.
- */
-
-void mkl_PIT::waitInterruptFlag() {
-  while ( !isInterruptFlagSet() ) { }
-}
-
-/*!
- *   @fn       clearInterruptFlag
- *
- *   @brief    limpa a flag de interrupo de um canal.
- *
- *   Este mtodo limpa o registrador de flag de interrupo de um canal,
- *   o que deve ser feito antes de configurar interrupes.
- *
- *
- *   @remarks  Siglas e pginas do Manual de Referncia KL25:
- *             - PIT_TFLGn: Timer Flag Register. Pg.580.
- */
-void mkl_PIT::clearInterruptFlag() {
-  *addrTFLGn |= PIT_TFLG_TIF_MASK;
-}
-
-
-/*!
- *   @fn       delay
- *
- *   @brief    Espera estourar a temporizao de um canal.
- *
- *   Este mtodo espera o registrador de flag de interrupo sinalizar que
- *   expirou a temporizao programada de um canal, sendo a gerao de
- *   interrupes desabilitadas.
- *
- *   @param[in]  time - nmero de ciclos de clock convertido em hexadecimal,
- *               de acordo com o perodo desejado.
- *               Nmero de ciclos de clock (LDVALn) = Perdo(desejado)*20MHz - 1.
- */
-
-/*!
- *   @fn       isInterruptFlagSet
- *
- *   @brief    retorna verdadeiro quando ocorre uma interrupo de um canal.
- *
- *   Este mtodo retorna verdadeiro caso seja gerado uma interrupo por um canal,
- *   onde a flag de interrupo  setada quando ocorre uma interrupo.
- *
- *   @return   True, caso haja uma interrupo.
- *             False, caso ainda no tenha ocorrido uma interrupo.
- *
- *   @remarks  Siglas e pginas do Manual de Referncia KL25:
- *             - PIT_TFLGn: Timer Flag Register. Pg.580.
- */
-
-bool mkl_PIT::isInterruptFlagSet(){
-	if ( *addrTFLGn && PIT_TFLG_TIF_MASK ) {
-	    return true;
-	  }
-	    return false;
-}
+/*!
+ * @copyright   © 2017 UFAM - Universidade Federal do Amazonas.
+ *
+ * @brief       Interface de programação de aplicações em C++ para o Periodic interrupt Timer (MKL25Z).
+ *
+ * @file        dsf_PIT_ocp.cpp
+ * @version     1.5
+ * @date        6 Julho 2017
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   PIT - Periodic Interrupt Timer.
+ *              +compiler     Kinetis® Design Studio IDE.
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão (data): Descrição breve.
+ *                             ++ 1.0 (6 Julho 2017): Versão inicial.
+ *                             ++ 1.1 (17 Outubro 2026): setFrequency: período a partir da frequência em Hz.
+ *                             ++ 1.2 (17 Outubro 2026): enableChainMode/disableChainMode (CHN).
+ *                             ++ 1.3 (17 Outubro 2026): Correção do teste do TIF (& em vez de &&).
+ *                             ++ 1.4 (17 Outubro 2026): setPeriod com um mkl_PITTiming.
+ *                             ++ 1.5 (17 Outubro 2026): claimChannel/releaseChannel: reserva de um canal por um único driver.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas
+ *              +courses      Engenharia da Computação / Engenharia Elétrica
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Versão inicial:
+ *                             ++ Jose Luis da Silva <joseluis70123@gmail.com>
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ *              Este programa é um software livre; Você pode redistribuí-lo
+ *              e/ou modificá-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              versão 3 da licença, ou qualquer versão posterior.
+ *
+ *              Este programa é distribuído na esperança de que seja útil,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implícita de
+ *              COMERCIALIZAÇÃO OU USO PARA UM DETERMINADO PROPÓSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include "mkl_PIT.h"
+#include <MKL25Z4.h>
+#include <stdint.h>
+
+const mkl_PIT *mkl_PIT::channelOwners[2] = {0, 0};
+
+/*!
+ *   @fn         bindChannel
+ *
+ *   @brief      Inicializa os ponteiros por canal.
+ *
+ *   Este método associa ao objeto de software os endereços de memória dos
+ *   registradores alocados para o canal indicado.
+ *
+ *   @param[in]  channel - canal dsf_Ch0_PIT ou canal dsf_Ch1_PIT usado.
+ *   @remarks    Siglas e páginas do Manual de Referência KL25:
+ *               - PIT_LDVALn: Timer Load Value Register. Pág. 578.
+ *               - PIT_CVALn:  Current Timer Value Register. Pág.578.
+ *               - PIT_TCTRLn: Timer Control Register. Pág. 579.
+ *               - PIT_TFLGn:  Timer Flag Register. Pág. 580.
+ *               - PIT_MCR:    PIT Module Control Register. Pág. 575.
+ */
+void mkl_PIT::bindChannel(PIT_ChPIT channel) {
+  /*!
+   * Cálculo do endereço absoluto do LDVALn para o PIT.
+   * Address: LDVAL0 = 0x40037100 e LDVAL1 = 0x40037110
+   * addrLDVALn= 0x40037100(base)+ 0x10*channel, onde channel= 0 ou 1
+   */
+  addrLDVALn = (volatile unsigned int *)(0x40037100 + 0x10*channel);
+
+  /*!
+   * Cálculo do endereço absoluto do LCVALn para o PIT.
+   * Address: LCVAL0 = 0x40037104 LCVAL1 = 0x40037114.
+   * addrCVALn = 0x40037104(base) + 0x10*channel,onde channel=0 ou 1
+   */
+  addrCVALn = (volatile unsigned int *)(0x40037104 + 0x10*channel);
+
+  /*!
+   * Cálculo do endereço absoluto do TCTRLn para o PIT.
+   * Address: TCTRL0 = 0x40037108 e TCTRL1 = 0x40037118.
+   * addrTCTRLn = 0x40037108(base) + 0x10*channel,onde channel= 0 ou 1
+   */
+  addrTCTRLn = (volatile unsigned int *)(0x40037108 + 0x10*channel);
+
+  /*!
+   * Cálculo do endereço absoluto do TFLGn para o PIT.
+   * Address: TFLG0 = 0x4003710C e TFLG1 = 0x4003711C.
+   * addrTFLGn = 0x4003710C(base) + 0x10*channel,onde channel= 0 ou 1
+   */
+  addrTFLGn = (volatile unsigned int *)(0x4003710C + 0x10*channel);
+}
+
+/*!
+ *   @fn         claimChannel
+ *
+ *   @brief      Reserva o canal para este objeto.
+ *
+ *   Os drivers que programam um canal por conta própria (mkl_PITTimerWheel,
+ *   mkl_PITLifetimeTimer e o canal dedicado do mkl_TimerService) o
+ *   reservam antes de usá-lo, e um segundo driver no mesmo canal é
+ *   recusado em vez de reprogramá-lo. As reservas são feitas na
+ *   inicialização, fora das interrupções.
+ *
+ *   @return     true se o canal estava livre ou já era deste objeto;
+ *               false se outro objeto o reservou.
+ */
+bool mkl_PIT::claimChannel() {
+  const mkl_PIT *&owner = channelOwners[readChannelIndex()];
+
+  if (owner && owner != this) {
+    return false;
+  }
+  owner = this;
+  return true;
+}
+
+/*!
+ *   @fn         releaseChannel
+ *
+ *   @brief      Libera o canal, se ele foi reservado por este objeto.
+ */
+void mkl_PIT::releaseChannel() {
+  const mkl_PIT *&owner = channelOwners[readChannelIndex()];
+
+  if (owner == this) {
+    owner = 0;
+  }
+}
+
+/*!
+ *   @fn         readChannelIndex
+ *
+ *   @brief      Retorna o número do canal associado (0 ou 1), a partir do
+ *               endereço do LDVALn (0x40037100 + 0x10*channel).
+ */
+int mkl_PIT::readChannelIndex() const {
+  return (reinterpret_cast<uintptr_t>(addrLDVALn) >> 4) & 1;
+}
+
+
+/*!
+ *   @fn         enablePeripheralClock
+ *
+ *   @brief      Habilita o clock do Módulo.
+ *
+ *   Este método habilita a operação do módulo, habilitando o clock
+ *   de operação do periférico.
+ *
+ *   @remarks  Siglas e páginas do Manual de Referência KL25:
+ *	        - SIM_SCGC6: System Clock Gating Control Register 6. Pág. 207.
+ */
+void mkl_PIT::enablePeripheralClock() {
+  SIM_SCGC6 |= SIM_SCGC6_PIT_MASK;
+}
+
+
+/*!
+ *   @fn         enablePeripheralModule
+ *
+ *   @brief      Habilita o clock dos Timers.
+ *
+ *   Este método habilita a operação do barramento de clock, habilitando o clock
+ *   de operação dos Timers dos 2 canais/
+ *
+ *   @remarks  Siglas e páginas do Manual de Referência KL25:
+ *             - PIT_MCR: PIT Module Control Register. Pág. 575.
+ */
+void mkl_PIT::enablePeripheralModule() {
+  /*!
+   *  Ajusta '0' no MDIS do MCR.
+   */
+  PIT_MCR &= ~PIT_MCR_MDIS_MASK;
+}
+
+
+/*!
+ *   @fn       disablePeripheralModule
+ *
+ *   @brief    Desabilita a operação dos Timers
+ *
+ *   Este método desabilita a operação dos Timers, desligando o clock de
+ *   operação dos 2 canais dos timers.
+ *
+ *   @warning  Desabilita todos os Timers para ambos os canais.
+ *
+ *   @remarks  Siglas e páginas do Manual de Referência KL25:
+ *            - PIT_MCR: PIT Module Control Register. Pág. 575.
+ */
+void mkl_PIT::disablePeripheralModule() {
+  /*!
+   *  Ajusta '1' no MDIS do MCR.
+   */
+  PIT_MCR |= PIT_MCR_MDIS_MASK;
+}
+
+
+/*!
+ *   @fn         setPeriod
+ *
+ *   @brief      seta o valor de fundo de escala de um canal.
+ *
+ *   Este método define o valor de início de um canal, onde o timer
+ *   irá decrementar o valor corrente até alcançar 0.
+ *
+ *   @param[in]  time - número de ciclos de clock convertido em hexadecimal,
+ *               de acordo com o periodo desejado.
+ *               Número de ciclos de clock (LDVALn) = Período(desejado)*20MHz - 1.
+ *
+ *   @remarks    Sigla e página do Manual de Referência KL25:
+ *               - LDVALn: Timer Load Value Register. Pág. 578.
+ */
+void mkl_PIT::setPeriod(uint32_t time) {
+  /*!
+   *  Ajusta LDVALn com "time".
+   */
+  *addrLDVALn = time;
+}
+
+/*!
+ *   @fn         setPeriod
+ *
+ *   @brief      Ajusta o período do canal com um mkl_PITTiming.
+ *
+ *   O LDVALn já vem calculado (de preferência em uma variável constexpr):
+ *   uma única escrita, sem divisão.
+ *
+ *   @param[in]  timing - resultado de mkl_PITTiming::from(duração).
+ */
+void mkl_PIT::setPeriod(const mkl_PITTiming &timing) {
+  *addrLDVALn = timing.ldval;
+}
+
+
+/*!
+ *   @fn         setFrequency
+ *
+ *   @brief      Ajusta o período de um canal a partir da frequência desejada.
+ *
+ *   LDVALn = PIT_BUS_CLOCK/hz - 1. A divisão é feita uma vez, na
+ *   configuração.
+ *
+ *   @param[in]  hz - frequência dos estouros do canal, em Hz.
+ *
+ *   @remarks    Sigla e página do Manual de Referência KL25:
+ *               - LDVALn: Timer Load Value Register. Pág. 578.
+ */
+void mkl_PIT::setFrequency(uint32_t hz) {
+  setPeriod(PIT_BUS_CLOCK/hz - 1);
+}
+
+
+/*!
+ *   @fn       readCounter
+ *
+ *   @brief    Lê a contagem de um canal
+ *
+ *   Este método retorna o valor corrente da contagem de um canal do timer.
+ *
+ *   @return   O valor do registrador que possui o valor corrente (CVALn) do canal.
+ *
+ *   @remarks  Siglas e páginas do Manual de Referência KL25:
+ *             - PIT_CVALn: Current Timer Value Register. Pág.578.
+ */
+uint32_t mkl_PIT::readCounter() {
+  /*!
+   *  Lê e retorna o valor de CVALn
+   */
+  return *addrCVALn;
+}
+/*!
+ *   @fn         enableTimer
+ *
+ *   @brief      Habilita a operação de um canal.
+ *
+ *   Este método habilita a operação de contagem decrescente de um canal do timer.
+ *
+ *   @remarks  Siglas e páginas do Manual de Referência KL25:
+ *	       - PIT_TCTRLn: Timer Control Register. Pág. 579.
+ */
+void mkl_PIT::enableTimer() {
+  /*!
+   *  Ajusta '1' no campo TEN.
+   */
+  *addrTCTRLn |= PIT_TCTRL_TEN_MASK;
+}
+
+
+/*!
+ *   @fn         disableTimer
+ *
+ *   @brief      desabilita a operação de um canal.
+ *
+ *   Este método desabilita a operação de contagem de um canal do Timer.
+ *
+ *   @remarks  Siglas e páginas do Manual de Referência KL25:
+ *	       - PIT_TCTRLn: Timer Control Register. Pág. 579.
+ */
+void mkl_PIT::disableTimer() {
+  /*!
+   *  Ajusta '0' no campo TEN.
+   */
+  *addrTCTRLn &= ~PIT_TCTRL_TEN_MASK;
+}
+
+
+/*!
+ *   @fn         enableChainMode
+ *
+ *   @brief      Encadeia o canal ao canal anterior.
+ *
+ *   Com o CHN em '1', o canal decrementa uma vez a cada estouro do canal
+ *   anterior, em vez de a cada ciclo do clock do barramento. Só tem efeito
+ *   no canal 1; o canal 0 não tem canal anterior.
+ *
+ *   @remarks  Siglas e páginas do Manual de Referência KL25:
+ *	       - PIT_TCTRLn: Timer Control Register. Pág. 579.
+ *	       - Chained timers. Pág. 582.
+ */
+void mkl_PIT::enableChainMode() {
+  /*!
+   *  Ajusta '1' no campo CHN.
+   */
+  *addrTCTRLn |= PIT_TCTRL_CHN_MASK;
+}
+
+
+/*!
+ *   @fn         disableChainMode
+ *
+ *   @brief      Desfaz o encadeamento do canal.
+ *
+ *   @remarks  Siglas e páginas do Manual de Referência KL25:
+ *	       - PIT_TCTRLn: Timer Control Register. Pág. 579.
+ */
+void mkl_PIT::disableChainMode() {
+  /*!
+   *  Ajusta '0' no campo CHN.
+   */
+  *addrTCTRLn &= ~PIT_TCTRL_CHN_MASK;
+}
+
+
+/*!
+ *   @fn         resetCounter
+ *
+ *   @brief      reseta o valor do contador de um canal do Timer.
+ *
+ *   Este método reseta o valor do contador de um canal. Caso se queira carregar
+ *   um novo valor de início em LDVALn, é necessário que se desabilite e habilite os Timers.
+ *
+ *   @remarks  Siglas e páginas do Manual de Referência KL25:
+ *             - Timers. Pág. 581.
+ */
+void mkl_PIT::resetCounter() {
+  disableTimer();
+  enableTimer();
+}
+
+/*!
+ *   @fn       waitInterruptFlag
+ *
+ *   @brief    Aguarda a geração de uma interrupção de um canal.
+ *
+ *   Este método espera a ocorrência de uma interrupção de um canal, monitorando a
+ *   a flag de interrupção até que esta se torne verdadeira.
+ *
+ *   @remarks  Siglas e páginas do Manual de Referência KL25:
+ *             - PIT_TFLGn: Timer Flag Register. Pág.580.
+ */
+
+void mkl_PIT::waitInterruptFlag() {
+  while ( !isInterruptFlagSet() ) { }
+}
+
+/*!
+ *   @fn       clearInterruptFlag
+ *
+ *   @brief    limpa a flag de interrupção de um canal.
+ *
+ *   Este método limpa o registrador de flag de interrupção de um canal,
+ *   o que deve ser feito antes de configurar interrupções.
+ *
+ *
+ *   @remarks  Siglas e páginas do Manual de Referência KL25:
+ *             - PIT_TFLGn: Timer Flag Register. Pág.580.
+ */
+void mkl_PIT::clearInterruptFlag() {
+  *addrTFLGn |= PIT_TFLG_TIF_MASK;
+}
+
+
+/*!
+ *   @fn       delay
+ *
+ *   @brief    Espera estourar a temporização de um canal.
+ *
+ *   Este método espera o registrador de flag de interrupção sinalizar que
+ *   expirou a temporização programada de um canal, sendo a geração de
+ *   interrupções desabilitadas.
+ *
+ *   @param[in]  time - número de ciclos de clock convertido em hexadecimal,
+ *               de acordo com o período desejado.
+ *               Número de ciclos de clock (LDVALn) = Perído(desejado)*20MHz - 1.
+ */
+
+/*!
+ *   @fn       isInterruptFlagSet
+ *
+ *   @brief    retorna verdadeiro quando ocorre uma interrupção de um canal.
+ *
+ *   Este método retorna verdadeiro caso seja gerado uma interrupção por um canal,
+ *   onde a flag de interrupção é setada quando ocorre uma interrupção.
+ *
+ *   @return   True, caso haja uma interrupção.
+ *             False, caso ainda não tenha ocorrido uma interrupção.
+ *
+ *   @remarks  Siglas e páginas do Manual de Referência KL25:
+ *             - PIT_TFLGn: Timer Flag Register. Pág.580.
+ */
+
+bool mkl_PIT::isInterruptFlagSet(){
+	if ( *addrTFLGn & PIT_TFLG_TIF_MASK ) {
+	    return true;
+	  }
+	    return false;
+}
@@ -1,133 +1,219 @@
-/*!
- * @copyright    2017 UFAM - Universidade Federal do Amazonas.
- *
- * @brief       Interface de programao de aplicaes em C++ para  o Periodic interrupt Timer (MKL25Z).
- *
- * @file        dsf_PIT_ocp.h
- * @version     1.0
- * @date        6 Julho 2017
- *
- * @section     HARDWARES & SOFTWARES
- *              +board        FRDM-KL25Z da NXP.
- *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
- *              +peripheral   PIT - Periodic Interrupt Timer.
- *              +compiler     Kinetis Design Studio IDE
- *              +manual       L25P80M48SF0RM, Rev.3, September 2012
- *              +revisions    Verso (data): Descrio breve.
- *                             ++ 1.0 (6 Julho 2017): Verso inicial.
- *
- * @section     AUTHORS & DEVELOPERS
- *              +institution  Universidade Federal do Amazonas
- *              +courses      Engenharia da Computao / Engenharia Eltrica
- *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
- *              +student      Verso inicial:
- *                             ++ Jose Luis da Silva <joseluis70123@gmail.com>
- *
- * @section     LICENSE
- *
- *              GNU General Public License (GNU GPL).
- *
- *              Este programa  um software livre; Voc pode redistribu-lo
- *              e/ou modific-lo de acordo com os termos do "GNU General Public
- *              License" como publicado pela Free Software Foundation; Seja a
- *              verso 3 da licena, ou qualquer verso posterior.
- *
- *              Este programa  distribudo na esperana de que seja til,
- *              mas SEM QUALQUER GARANTIA; Sem a garantia implcita de
- *              COMERCIALIZAO OU USO PARA UM DETERMINADO PROPSITO.
- *              Veja o site da "GNU General Public License" para mais detalhes.
- *
- * @htmlonly    http://www.gnu.org/copyleft/gpl.html
- */
-
-#ifndef C__USERS_JOSEL_DESKTOP_CPPLINT_DSF_PIT_OCP_H_
-#define C__USERS_JOSEL_DESKTOP_CPPLINT_DSF_PIT_OCP_H_
-
-#include <stdint.h>
-#ifndef mkl_PIT_H
-#define mkl_PIT_H
-
-/*!
- *  Definio dos canais do PIT.
- */
-typedef enum {
-  PIT_Ch0 = 0,  //!< Canal 0 do PIT.
-  PIT_Ch1 = 1   //!< Canal 1 do PIT.
-} PIT_ChPIT;
-
-
-/*!
- *  @class    dsf_PIT_ocp
- *
- *  @brief    A classe dsf_PIT_ocp representa o perifrico Periodic Interrupt Timer da MKL25Z.
- *
- *  @details  Esta classe  usada para a gerao de interrupes periodicas,
- *            quando entao uma instruo  executada. Uso do periferico on-chip
- *            Periodic Interrupt Timer.
- *
- *  @section  EXAMPLES USAGE
- *
- *
- *   Uso dos mtodos para o uso do PIT
- *     +fn dsf_PIT_ocp(channel);
- *     +fn enablePeripheralModule();
- *     +fn setPeriod(time);
- *     +fn resetCounter();
- *     +fn enableTimer();
- *     +fn enableInterruptRequests();
- */
-class mkl_PIT {
- public:
-
-  /*!
-   * Mtodos que afetam os dois canais
-   */
-  void enablePeripheralClock();
-  void enablePeripheralModule();
-  void disablePeripheralModule();
-
-  /*!
-   * Mtodos que afetam somente um canal.
-   */
-  void setPeriod(uint32_t time);
-
-  /*!
-   * Mtodos que afetam somente o Timer do PIT
-   */
-  void enableTimer();
-  void disableTimer();
-  void resetCounter();
-  uint32_t readCounter();
-
-  /*!
-   * Mtodos que afetam somente a flag que sinaliza  interrupo
-   */
-  void waitInterruptFlag();
-  bool isInterruptFlagSet();
-  void clearInterruptFlag();
-
-  void bindChannel(PIT_ChPIT channel);
-
-  /*!
-   *  Endereo no mapa de memria do Timer Load Value Register - canal n.
-   */
-  volatile unsigned int *addrLDVALn;
-
-  /*!
-   *  Endereo no mapa de memria do Current Timer Value Register - canal n.
-   */
-  volatile unsigned int  *addrCVALn;
-
-  /*!
-   *  Endereo no mapa de memria do Timer Control Register - canal n.
-   */
-  volatile unsigned int *addrTCTRLn;
-
-  /*!
-   *  Endereo no mapa de memria do Timer Flag Register - canal n.
-   */
-  volatile unsigned int *addrTFLGn;
-};
-
-#endif
-#endif  //! C__USERS_JOSEL_DESKTOP_CPPLINT_DSF_PIT_OCP_H_
+/*!
+ * @copyright   © 2017 UFAM - Universidade Federal do Amazonas.
+ *
+ * @brief       Interface de programação de aplicações em C++ para  o Periodic interrupt Timer (MKL25Z).
+ *
+ * @file        dsf_PIT_ocp.h
+ * @version     1.5
+ * @date        6 Julho 2017
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   PIT - Periodic Interrupt Timer.
+ *              +compiler     Kinetis® Design Studio IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão (data): Descrição breve.
+ *                             ++ 1.0 (6 Julho 2017): Versão inicial.
+ *                             ++ 1.1 (17 Outubro 2026): setFrequency: período a partir da frequência em Hz.
+ *                             ++ 1.2 (17 Outubro 2026): enableChainMode/disableChainMode (CHN).
+ *                             ++ 1.3 (17 Outubro 2026): Correção do teste do TIF (& em vez de &&).
+ *                             ++ 1.4 (17 Outubro 2026): mkl_PITTiming e setPeriod com o LDVALn calculado de uma duração do std::chrono.
+ *                             ++ 1.5 (17 Outubro 2026): claimChannel/releaseChannel: reserva de um canal por um único driver.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas
+ *              +courses      Engenharia da Computação / Engenharia Elétrica
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Versão inicial:
+ *                             ++ Jose Luis da Silva <joseluis70123@gmail.com>
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ *              Este programa é um software livre; Você pode redistribuí-lo
+ *              e/ou modificá-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              versão 3 da licença, ou qualquer versão posterior.
+ *
+ *              Este programa é distribuído na esperança de que seja útil,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implícita de
+ *              COMERCIALIZAÇÃO OU USO PARA UM DETERMINADO PROPÓSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#ifndef C__USERS_JOSEL_DESKTOP_CPPLINT_DSF_PIT_OCP_H_
+#define C__USERS_JOSEL_DESKTOP_CPPLINT_DSF_PIT_OCP_H_
+
+#include <stdint.h>
+#include "mkl_Duration/mkl_Duration.h"
+#ifndef mkl_PIT_H
+#define mkl_PIT_H
+
+/*!
+ *  Frequência do clock do barramento, que alimenta o PIT (modo FEI, padrão
+ *  após o reset).
+ */
+#ifndef PIT_BUS_CLOCK
+#define PIT_BUS_CLOCK 20971520u
+#endif
+
+/*!
+ *  Definição dos canais do PIT.
+ */
+typedef enum {
+  PIT_Ch0 = 0,  //!< Canal 0 do PIT.
+  PIT_Ch1 = 1   //!< Canal 1 do PIT.
+} PIT_ChPIT;
+
+/*!
+ *  @class    mkl_PITTiming
+ *
+ *  @brief    Valor do LDVALn do PIT para uma duração do std::chrono.
+ *
+ *  @details  ldval = duração*PIT_BUS_CLOCK - 1, arredondado: o período do
+ *            canal é ldval + 1 ciclos do barramento. errorNs é a diferença,
+ *            em nanossegundos, entre o período obtido e o pedido.
+ *
+ *            Em uma variável constexpr, o cálculo é feito na compilação, e
+ *            uma duração fora do alcance (abaixo de um ciclo ou acima de
+ *            2^32 ciclos, cerca de 204 s) é um erro de compilação: a chamada
+ *            a durationOutOfRange, que não é constexpr. Fora de uma
+ *            expressão constante, o cálculo é feito em tempo de execução e,
+ *            fora do alcance, retorna o maior período com
+ *            errorNs = kOutOfRange.
+ *
+ *  @section  EXAMPLES USAGE
+ *
+ *     +fn constexpr mkl_PITTiming kScan =
+ *           mkl_PITTiming::from(std::chrono::microseconds(1000));
+ *     +fn pit.setPeriod(kScan);
+ */
+struct mkl_PITTiming {
+  static const int32_t kOutOfRange = INT32_MAX;
+
+  uint32_t ldval;
+  int32_t errorNs;
+
+  template <class Rep, class Period>
+  static constexpr mkl_PITTiming from(std::chrono::duration<Rep, Period> d) {
+    return select(d, mkl_Duration::ticks(d, PIT_BUS_CLOCK, 0));
+  }
+
+  static mkl_PITTiming durationOutOfRange() {
+    return mkl_PITTiming{0xFFFFFFFF, kOutOfRange};
+  }
+
+ private:
+  template <class Rep, class Period>
+  static constexpr mkl_PITTiming select(std::chrono::duration<Rep, Period> d,
+                                        uint64_t ticks) {
+    return (mkl_Duration::fits(d, PIT_BUS_CLOCK) && ticks >= 1 &&
+            ticks <= 0x100000000ull)
+               ? mkl_PITTiming{
+                     (uint32_t)(ticks - 1),
+                     (int32_t)(mkl_Duration::ticksToNanoseconds(
+                                   ticks, PIT_BUS_CLOCK, 0) -
+                               mkl_Duration::nanoseconds(d))}
+               : durationOutOfRange();
+  }
+};
+
+
+/*!
+ *  @class    dsf_PIT_ocp
+ *
+ *  @brief    A classe dsf_PIT_ocp representa o periférico Periodic Interrupt Timer da MKL25Z.
+ *
+ *  @details  Esta classe é usada para a geração de interrupções periodicas,
+ *            quando entao uma instrução é executada. Uso do periferico on-chip
+ *            Periodic Interrupt Timer.
+ *
+ *  @section  EXAMPLES USAGE
+ *
+ *
+ *   Uso dos métodos para o uso do PIT
+ *     +fn dsf_PIT_ocp(channel);
+ *     +fn enablePeripheralModule();
+ *     +fn setPeriod(time);
+ *     +fn setPeriod(mkl_PITTiming::from(std::chrono::milliseconds(1)));
+ *     +fn resetCounter();
+ *     +fn enableTimer();
+ *     +fn enableInterruptRequests();
+ */
+class mkl_PIT {
+ public:
+
+  /*!
+   * Métodos que afetam os dois canais
+   */
+  void enablePeripheralClock();
+  void enablePeripheralModule();
+  void disablePeripheralModule();
+
+  /*!
+   * Métodos que afetam somente um canal.
+   */
+  void setPeriod(uint32_t time);
+  void setPeriod(const mkl_PITTiming &timing);
+  void setFrequency(uint32_t hz);
+
+  /*!
+   * Métodos que afetam somente o Timer do PIT
+   */
+  void enableTimer();
+  void disableTimer();
+  void resetCounter();
+  uint32_t readCounter();
+  void enableChainMode();
+  void disableChainMode();
+
+  /*!
+   * Métodos que afetam somente a flag que sinaliza  interrupção
+   */
+  void waitInterruptFlag();
+  bool isInterruptFlagSet();
+  void clearInterruptFlag();
+
+  void bindChannel(PIT_ChPIT channel);
+
+  /*!
+   * Reserva do canal entre os drivers que usam o PIT.
+   */
+  bool claimChannel();
+  void releaseChannel();
+
+  /*!
+   *  Endereço no mapa de memória do Timer Load Value Register - canal n.
+   */
+  volatile unsigned int *addrLDVALn;
+
+  /*!
+   *  Endereço no mapa de memória do Current Timer Value Register - canal n.
+   */
+  volatile unsigned int  *addrCVALn;
+
+  /*!
+   *  Endereço no mapa de memória do Timer Control Register - canal n.
+   */
+  volatile unsigned int *addrTCTRLn;
+
+  /*!
+   *  Endereço no mapa de memória do Timer Flag Register - canal n.
+   */
+  volatile unsigned int *addrTFLGn;
+
+ private:
+  /*!
+   *  Objeto que reservou cada canal (0 = livre).
+   */
+  static const mkl_PIT *channelOwners[2];
+
+  int readChannelIndex() const;
+};
+
+#endif
+#endif  //! C__USERS_JOSEL_DESKTOP_CPPLINT_DSF_PIT_OCP_H_
@@ -0,0 +1,185 @@
+/*!
+ * @copyright   © 2017 UFAM - Universidade Federal do Amazonas.
+ *
+ * @brief       Canal do PIT com o canal fixo em compilação.
+ *
+ * @file        mkl_PITChannel.h
+ * @version     1.1
+ * @date        17 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   PIT (Periodic Interrupt Timer).
+ *              +compiler     Kinetis® Design Studio IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão (data): Descrição breve.
+ *                             ++ 1.0 (17 Outubro 2026): Versão inicial.
+ *                             ++ 1.1 (17 Outubro 2026): setPeriod com um mkl_PITTiming.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas
+ *              +courses      Engenharia da Computação
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Versão inicial:
+ *                             ++ Patrick Chagas dos Santos <patrick.chagas@gmail.com>
+ *                             ++ Gabriel Montenegro Villacrez <gvmontenegro19@gmail.com>
+ *                             ++ Andrezza Bonfim <andrezzabonfiiim@gmail.com>
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ *              Este programa é um software livre; Você pode redistribuí-lo
+ *              e/ou modificá-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              versão 3 da licença, ou qualquer versão posterior.
+ *
+ *              Este programa é distribuído na esperança de que seja útil,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implícita de
+ *              COMERCIALIZAÇÃO OU USO PARA UM DETERMINADO PROPÓSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#ifndef MKL_PITCHANNEL_H_
+#define MKL_PITCHANNEL_H_
+
+#include <MKL25Z4.h>
+#include <stdint.h>
+#include <mkl_PIT/mkl_PIT.h>
+
+/*!
+ *  Registradores de um canal do PIT, na ordem do mapa de memória.
+ */
+typedef struct {
+  volatile uint32_t LDVAL;  /*!< Timer Load Value Register. Pág. 578. */
+  volatile uint32_t CVAL;   /*!< Current Timer Value Register. Pág. 578. */
+  volatile uint32_t TCTRL;  /*!< Timer Control Register. Pág. 579. */
+  volatile uint32_t TFLG;   /*!< Timer Flag Register. Pág. 580. */
+} mkl_PITChannelRegisters;
+
+static_assert(sizeof(mkl_PITChannelRegisters) == 0x10,
+              "os canais do PIT ficam a 0x10 bytes um do outro");
+
+/*!
+ *  @class    mkl_PITChannel
+ *
+ *  @brief    Canal do PIT com o número do canal fixo em compilação.
+ *
+ *  @details  Alternativa ao mkl_PIT sem atributos: o canal é o parâmetro do
+ *            template, e a estrutura mkl_PITChannelRegisters é sobreposta ao
+ *            endereço 0x40037100 + 0x10*channel, uma constante. Cada método é
+ *            inline e acessa o registrador direto pelo endereço constante, sem
+ *            carregar ponteiros do objeto; setPeriod(), readCounter() e
+ *            clearInterruptFlag() são uma única escrita ou leitura.
+ *
+ *            Todos os métodos são estáticos e o objeto não ocupa RAM: pode-se
+ *            usar o tipo direto (mkl_PITChannel<PIT_Ch0>::setPeriod(...)) ou
+ *            declarar um objeto por legibilidade.
+ *
+ *            A interrupção dos dois canais é a mesma (PIT_IRQn); a rotina de
+ *            serviço deve consultar isInterruptFlagSet() de cada canal.
+ *
+ *  @section  EXAMPLES USAGE
+ *
+ *   Uso dos métodos para o uso do PIT
+ *     +fn mkl_PITChannel<PIT_Ch0> pit;
+ *     +fn pit.enablePeripheralClock();
+ *     +fn pit.enablePeripheralModule();
+ *     +fn pit.setFrequency(1000);
+ *     +fn pit.enableTimer();
+ *     +fn pit.enableInterruptRequests();
+ *     +fn pit.clearInterruptFlag();        // na rotina de serviço
+ */
+template <PIT_ChPIT channel>
+class mkl_PITChannel {
+ public:
+  /*!
+   * Métodos que afetam os dois canais.
+   */
+  static void enablePeripheralClock() {
+    SIM_SCGC6 |= SIM_SCGC6_PIT_MASK;
+  }
+  static void enablePeripheralModule() {
+    PIT_MCR &= ~PIT_MCR_MDIS_MASK;
+  }
+  static void disablePeripheralModule() {
+    PIT_MCR |= PIT_MCR_MDIS_MASK;
+  }
+
+  /*!
+   * Métodos que afetam somente o canal.
+   */
+  static void setPeriod(uint32_t time) {
+    regs()->LDVAL = time;
+  }
+  static void setPeriod(const mkl_PITTiming &timing) {
+    regs()->LDVAL = timing.ldval;
+  }
+  static void setFrequency(uint32_t hz) {
+    regs()->LDVAL = PIT_BUS_CLOCK/hz - 1;
+  }
+  static uint32_t readCounter() {
+    return regs()->CVAL;
+  }
+  static void enableTimer() {
+    regs()->TCTRL |= PIT_TCTRL_TEN_MASK;
+  }
+  static void disableTimer() {
+    regs()->TCTRL &= ~PIT_TCTRL_TEN_MASK;
+  }
+
+  /*!
+   *  Recarrega o contador com o LDVAL (Timers, pág. 581).
+   */
+  static void resetCounter() {
+    disableTimer();
+    enableTimer();
+  }
+
+  /*!
+   * Métodos da flag e das interrupções do canal.
+   */
+  static bool isInterruptFlagSet() {
+    return regs()->TFLG & PIT_TFLG_TIF_MASK;
+  }
+  static void waitInterruptFlag() {
+    while (!isInterruptFlagSet()) { }
+  }
+
+  /*!
+   *  O TIF é limpo escrevendo '1' (w1c): uma escrita, sem leitura.
+   */
+  static void clearInterruptFlag() {
+    regs()->TFLG = PIT_TFLG_TIF_MASK;
+  }
+  static void enableInterruptRequests() {
+    regs()->TCTRL |= PIT_TCTRL_TIE_MASK;
+    NVIC_EnableIRQ(PIT_IRQn);
+  }
+
+  /*!
+   *  Desabilita os pedidos do canal. A entrada do NVIC é compartilhada com
+   *  o outro canal e só é desabilitada se ele também não pedir.
+   */
+  static void disableInterruptRequests() {
+    regs()->TCTRL &= ~PIT_TCTRL_TIE_MASK;
+    if (!(PIT->CHANNEL[channel ^ 1].TCTRL & PIT_TCTRL_TIE_MASK)) {
+      NVIC_DisableIRQ(PIT_IRQn);
+    }
+  }
+
+ private:
+  /*!
+   *  Endereço do canal no mapa de memória, constante em compilação.
+   */
+  static const uint32_t kBaseAddress = 0x40037100 + 0x10*channel;
+
+  static mkl_PITChannelRegisters *regs() {
+    return reinterpret_cast<mkl_PITChannelRegisters *>(kBaseAddress);
+  }
+};
+
+#endif  //  MKL_PITCHANNEL_H_
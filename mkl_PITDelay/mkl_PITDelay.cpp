@@ -1,126 +1,171 @@
-/*!
- * @copyright    2017 UFAM - Universidade Federal do Amazonas.
- *
- * @brief       Interface de programao de aplicaes em C++ para  o Periodic interrupt Timer (MKL25Z).
- *
- * @file        mkl_PITPeriodicInterrupt.cpp
- * @version     1.0
- * @date        6 Julho 2017
- *
- * @section     HARDWARES & SOFTWARES
- *              +board        FRDM-KL25Z da NXP.
- *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
- *              +peripheral   PIT - Periodic Interrupt Timer.
- *              +compiler     Kinetis Design Studio IDE
- *              +manual       L25P80M48SF0RM, Rev.3, September 2012
- *              +revisions    Verso (data): Descrio breve.
- *                             ++ 1.0 (6 Julho 2017): Verso inicial.
- *
- * @section     AUTHORS & DEVELOPERS
- *              +institution  Universidade Federal do Amazonas
- *              +courses      Engenharia da Computao / Engenharia Eltrica
- *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
- *              +student      Verso inicial:
- *                             ++ Jose Luis da Silva <joseluis70123@gmail.com>
- *
- * @section     LICENSE
- *
- *              GNU General Public License (GNU GPL).
- *
- *              Este programa  um software livre; Voc pode redistribu-lo
- *              e/ou modific-lo de acordo com os termos do "GNU General Public
- *              License" como publicado pela Free Software Foundation; Seja a
- *              verso 3 da licena, ou qualquer verso posterior.
- *
- *              Este programa  distribudo na esperana de que seja til,
- *              mas SEM QUALQUER GARANTIA; Sem a garantia implcita de
- *              COMERCIALIZAO OU USO PARA UM DETERMINADO PROPSITO.
- *              Veja o site da "GNU General Public License" para mais detalhes.
- *
- * @htmlonly    http://www.gnu.org/copyleft/gpl.html
- */
-
-#include <stdint.h>
-#include <MKL25Z4.h>
-#include "mkl_PITDelay.h"
-
-mkl_PITDelay::mkl_PITDelay(PIT_ChPIT channel){
-	      /*!
-		   *Inicializa os atributos do canal.
-		   */
-			bindChannel(channel);
-
-		  /*!
-		   *Habilita a operao do mdulo.
-		   */
-		  enablePeripheralClock();
-}
-
-void mkl_PITDelay::startDelay(){
-	  /*!
-	   *  Zera e inicializa a contagem de espera.
-	   */
-	  resetCounter();
-
-	  /*!
-	   *  Espera a contagem programada expirar.
-	   */
-	  waitInterruptFlag();
-
-	  /*!
-	   *  Limpa pedidos de interrupo, por segurana.
-	   */
-	  clearInterruptFlag();
-}
-
-/*!
- *   @fn         cancelDelay
- *
- *   @brief      desabilita a operao delay.
- *
- *   Este mtodo desabilita a operao de contagem de um canal do Timer.
- *
- *   @remarks  Siglas e pginas do Manual de Referncia KL25:
- *	       - PIT_TCTRLn: Timer Control Register. Pg. 579.
- */
-
-void mkl_PITDelay::cancelDelay(){
-
-*addrTCTRLn &= ~PIT_TCTRL_TEN_MASK;
-}
-/*!
- *   @fn       timeoutDelay
- *
- *   @brief    retorna verdadeiro quando ocorre uma interrupo de um canal.
- *
- *   Este mtodo retorna verdadeiro caso o tempo de delay tenha chegado.
- *
- *   @return   True, caso haja uma interrupo.
- *             False, caso ainda no tenha ocorrido uma interrupo.
- *
- *   @remarks  Siglas e pginas do Manual de Referncia KL25:
- *             - PIT_TFLGn: Timer Flag Register. Pg.580.
- */
-bool mkl_PITDelay::timeoutDelay(){
-	if ( *addrTFLGn && PIT_TFLG_TIF_MASK ) {
-		    return true;
-		 }
-		    return false;
-}
-
-/*!
- *   @fn       getCounter
- *
- *   @brief    L a contagem de um canal
- *
- *   Este mtodo retorna o valor corrente da contagem de um canal do timer.
- *
- *   @return   O valor do registrador que possui o valor corrente (CVALn) do canal.
- *
- *   @remarks  Siglas e pginas do Manual de Referncia KL25:
- *             - PIT_CVALn: Current Timer Value Register. Pg.578.
- */
-uint32_t mkl_PITDelay::getCounter(){
-	 return *addrCVALn;
-}
-
+/*!
+ * @copyright   © 2017 UFAM - Universidade Federal do Amazonas.
+ *
+ * @brief       Interface de programação de aplicações em C++ para  o Periodic interrupt Timer (MKL25Z).
+ *
+ * @file        mkl_PITPeriodicInterrupt.cpp
+ * @version     1.2
+ * @date        6 Julho 2017
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   PIT - Periodic Interrupt Timer.
+ *              +compiler     Kinetis® Design Studio IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão (data): Descrição breve.
+ *                             ++ 1.0 (6 Julho 2017): Versão inicial.
+ *                             ++ 1.1 (17 Outubro 2026): startDelay sem espera, waitDelay e correção do timeoutDelay.
+ *                             ++ 1.2 (17 Outubro 2026): startDelay e waitDelay com um mkl_PITTiming.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas
+ *              +courses      Engenharia da Computação / Engenharia Elétrica
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Versão inicial:
+ *                             ++ Jose Luis da Silva <joseluis70123@gmail.com>
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ *              Este programa é um software livre; Você pode redistribuí-lo
+ *              e/ou modificá-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              versão 3 da licença, ou qualquer versão posterior.
+ *
+ *              Este programa é distribuído na esperança de que seja útil,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implícita de
+ *              COMERCIALIZAÇÃO OU USO PARA UM DETERMINADO PROPÓSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include <stdint.h>
+#include <MKL25Z4.h>
+#include "mkl_PITDelay.h"
+
+mkl_PITDelay::mkl_PITDelay(PIT_ChPIT channel){
+	      /*!
+		   *Inicializa os atributos do canal.
+		   */
+			bindChannel(channel);
+
+		  /*!
+		   *Habilita a operação do módulo.
+		   */
+		  enablePeripheralClock();
+}
+
+/*!
+ *   @fn         startDelay
+ *
+ *   @brief      Inicia a temporização, sem esperar.
+ *
+ *   O fim da temporização é consultado por timeoutDelay().
+ *
+ *   @remarks  Siglas e páginas do Manual de Referência KL25:
+ *	       - PIT_TCTRLn: Timer Control Register. Pág. 579.
+ *             - PIT_TFLGn: Timer Flag Register. Pág.580.
+ */
+void mkl_PITDelay::startDelay(){
+	  /*!
+	   *  Zera e inicializa a contagem de espera.
+	   */
+	  resetCounter();
+
+	  /*!
+	   *  Limpa o estouro de uma temporização anterior.
+	   */
+	  clearInterruptFlag();
+}
+
+/*!
+ *   @fn         waitDelay
+ *
+ *   @brief      Inicia a temporização e espera o seu fim.
+ */
+void mkl_PITDelay::waitDelay(){
+	  startDelay();
+
+	  /*!
+	   *  Espera a contagem programada expirar.
+	   */
+	  waitInterruptFlag();
+	  clearInterruptFlag();
+}
+
+/*!
+ *   @fn         startDelay
+ *
+ *   @brief      Ajusta o período com "timing" e inicia a temporização, sem
+ *               esperar.
+ */
+void mkl_PITDelay::startDelay(const mkl_PITTiming &timing){
+	  setPeriod(timing);
+	  startDelay();
+}
+
+/*!
+ *   @fn         waitDelay
+ *
+ *   @brief      Ajusta o período com "timing", inicia a temporização e
+ *               espera o seu fim.
+ */
+void mkl_PITDelay::waitDelay(const mkl_PITTiming &timing){
+	  setPeriod(timing);
+	  waitDelay();
+}
+
+/*!
+ *   @fn         cancelDelay
+ *
+ *   @brief      desabilita a operação delay.
+ *
+ *   Este método desabilita a operação de contagem de um canal do Timer.
+ *
+ *   @remarks  Siglas e páginas do Manual de Referência KL25:
+ *	       - PIT_TCTRLn: Timer Control Register. Pág. 579.
+ */
+
+void mkl_PITDelay::cancelDelay(){
+
+*addrTCTRLn &= ~PIT_TCTRL_TEN_MASK;
+}
+/*!
+ *   @fn       timeoutDelay
+ *
+ *   @brief    retorna verdadeiro quando ocorre uma interrupção de um canal.
+ *
+ *   Este método retorna verdadeiro caso o tempo de delay tenha chegado.
+ *
+ *   @return   True, caso haja uma interrupção.
+ *             False, caso ainda não tenha ocorrido uma interrupção.
+ *
+ *   @remarks  Siglas e páginas do Manual de Referência KL25:
+ *             - PIT_TFLGn: Timer Flag Register. Pág.580.
+ */
+bool mkl_PITDelay::timeoutDelay(){
+	if ( *addrTFLGn & PIT_TFLG_TIF_MASK ) {
+		    return true;
+		 }
+		    return false;
+}
+
+/*!
+ *   @fn       getCounter
+ *
+ *   @brief    Lê a contagem de um canal
+ *
+ *   Este método retorna o valor corrente da contagem de um canal do timer.
+ *
+ *   @return   O valor do registrador que possui o valor corrente (CVALn) do canal.
+ *
+ *   @remarks  Siglas e páginas do Manual de Referência KL25:
+ *             - PIT_CVALn: Current Timer Value Register. Pág.578.
+ */
+uint32_t mkl_PITDelay::getCounter(){
+	 return *addrCVALn;
+}
+
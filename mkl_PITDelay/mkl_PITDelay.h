@@ -1,84 +1,96 @@
-/*!
- * @copyright    2017 UFAM - Universidade Federal do Amazonas.
- *
- * @brief       Interface de programao de aplicaes em C++ para  o Periodic interrupt Timer (MKL25Z).
- *
- * @file        mkl_PITDelay.h
- * @version     1.0
- * @date        6 Julho 2017
- *
- * @section     HARDWARES & SOFTWARES
- *              +board        FRDM-KL25Z da NXP.
- *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
- *              +peripheral   PIT - Periodic Interrupt Timer.
- *              +compiler     Kinetis Design Studio IDE
- *              +manual       L25P80M48SF0RM, Rev.3, September 2012
- *              +revisions    Verso (data): Descrio breve.
- *                             ++ 1.0 (6 Julho 2017): Verso inicial.
- *
- * @section     AUTHORS & DEVELOPERS
- *              +institution  Universidade Federal do Amazonas
- *              +courses      Engenharia da Computao / Engenharia Eltrica
- *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
- *              +student      Verso inicial:
- *                             ++ Jose Luis da Silva <joseluis70123@gmail.com>
- *
- * @section     LICENSE
- *
- *              GNU General Public License (GNU GPL).
- *
- *              Este programa  um software livre; Voc pode redistribu-lo
- *              e/ou modific-lo de acordo com os termos do "GNU General Public
- *              License" como publicado pela Free Software Foundation; Seja a
- *              verso 3 da licena, ou qualquer verso posterior.
- *
- *              Este programa  distribudo na esperana de que seja til,
- *              mas SEM QUALQUER GARANTIA; Sem a garantia implcita de
- *              COMERCIALIZAO OU USO PARA UM DETERMINADO PROPSITO.
- *              Veja o site da "GNU General Public License" para mais detalhes.
- *
- * @htmlonly    http://www.gnu.org/copyleft/gpl.html
- */
-
-#ifndef SOURCES_MKL_PITDELAY_H_
-#define SOURCES_MKL_PITDELAY_H_
-
-#include <stdint.h>
-#include <MKL25Z4.h>
-#include "mkl_PIT/mkl_PIT.h"
-/*!
- *  @class     mkl_PITDelay
- *
- *  @brief    A classe implementa o modo de operao delay, do perifrico PIT.
- *
- *  @details  Esta classe  derivada da classe me "mkl_PIT" e
- *            implementa o modo de operao delay.
- *
- *
- */
-class mkl_PITDelay : public mkl_PIT{
-public:
-	/*!
-	  * Mtodo construtor padrao da classe.
-      */
-	  mkl_PITDelay(PIT_ChPIT channel);
-	  /*!
-	     * Mtodos de inicializao de temporizao.
-	     */
-	  void startDelay();
-	  /*!
-	    * Mtodos de checagem da temporizao.
-	   */
-	  bool timeoutDelay();
-	  uint32_t getCounter();
-	  /*!
-	   * Mtodo de cancelamento de temporizao.
-	   */
-	  void cancelDelay();
-
-
-};
-
-
-
-#endif /* SOURCES_MKL_PITDELAY_H_ */
+/*!
+ * @copyright   © 2017 UFAM - Universidade Federal do Amazonas.
+ *
+ * @brief       Interface de programação de aplicações em C++ para  o Periodic interrupt Timer (MKL25Z).
+ *
+ * @file        mkl_PITDelay.h
+ * @version     1.2
+ * @date        6 Julho 2017
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   PIT - Periodic Interrupt Timer.
+ *              +compiler     Kinetis® Design Studio IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão (data): Descrição breve.
+ *                             ++ 1.0 (6 Julho 2017): Versão inicial.
+ *                             ++ 1.1 (17 Outubro 2026): startDelay sem espera, waitDelay e correção do timeoutDelay.
+ *                             ++ 1.2 (17 Outubro 2026): startDelay e waitDelay com um mkl_PITTiming.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas
+ *              +courses      Engenharia da Computação / Engenharia Elétrica
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Versão inicial:
+ *                             ++ Jose Luis da Silva <joseluis70123@gmail.com>
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ *              Este programa é um software livre; Você pode redistribuí-lo
+ *              e/ou modificá-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              versão 3 da licença, ou qualquer versão posterior.
+ *
+ *              Este programa é distribuído na esperança de que seja útil,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implícita de
+ *              COMERCIALIZAÇÃO OU USO PARA UM DETERMINADO PROPÓSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#ifndef SOURCES_MKL_PITDELAY_H_
+#define SOURCES_MKL_PITDELAY_H_
+
+#include <stdint.h>
+#include <MKL25Z4.h>
+#include "mkl_PIT/mkl_PIT.h"
+/*!
+ *  @class     mkl_PITDelay
+ *
+ *  @brief    A classe implementa o modo de operação delay, do periférico PIT.
+ *
+ *  @details  Esta classe é derivada da classe mãe "mkl_PIT" e
+ *            implementa o modo de operação delay.
+ *
+ *            A duração pode ser dada por um mkl_PITTiming, calculado na
+ *            compilação a partir de uma duração do std::chrono:
+ *
+ *     +fn constexpr mkl_PITTiming kWait =
+ *           mkl_PITTiming::from(std::chrono::milliseconds(30));
+ *     +fn delay.waitDelay(kWait);
+ *
+ *
+ */
+class mkl_PITDelay : public mkl_PIT{
+public:
+	/*!
+	  * Método construtor padrao da classe.
+      */
+	  mkl_PITDelay(PIT_ChPIT channel);
+	  /*!
+	     * Métodos de inicialização de temporização.
+	     */
+	  void startDelay();
+	  void waitDelay();
+	  void startDelay(const mkl_PITTiming &timing);
+	  void waitDelay(const mkl_PITTiming &timing);
+	  /*!
+	    * Métodos de checagem da temporização.
+	   */
+	  bool timeoutDelay();
+	  uint32_t getCounter();
+	  /*!
+	   * Método de cancelamento de temporização.
+	   */
+	  void cancelDelay();
+
+
+};
+
+
+
+#endif /* SOURCES_MKL_PITDELAY_H_ */
@@ -0,0 +1,152 @@
+/*!
+ * @copyright   © 2017 UFAM - Universidade Federal do Amazonas.
+ *
+ * @brief       Base de tempo monotônica de 64 bits com os canais do PIT encadeados.
+ *
+ * @file        mkl_PITLifetimeTimer.cpp
+ * @version     1.2
+ * @date        17 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   PIT (Periodic Interrupt Timer).
+ *              +compiler     Kinetis® Design Studio IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão (data): Descrição breve.
+ *                             ++ 1.0 (17 Outubro 2026): Versão inicial.
+ *                             ++ 1.1 (17 Outubro 2026): Reserva dos canais (mkl_PIT::claimChannel); start retorna false com o canal 1 ocupado.
+ *                             ++ 1.2 (17 Outubro 2026): O canal 0 é sempre do contador: start() recusa o canal 0 em uso.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas
+ *              +courses      Engenharia da Computação
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Versão inicial:
+ *                             ++ Patrick Chagas dos Santos <patrick.chagas@gmail.com>
+ *                             ++ Gabriel Montenegro Villacrez <gvmontenegro19@gmail.com>
+ *                             ++ Andrezza Bonfim <andrezzabonfiiim@gmail.com>
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ *              Este programa é um software livre; Você pode redistribuí-lo
+ *              e/ou modificá-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              versão 3 da licença, ou qualquer versão posterior.
+ *
+ *              Este programa é distribuído na esperança de que seja útil,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implícita de
+ *              COMERCIALIZAÇÃO OU USO PARA UM DETERMINADO PROPÓSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include "mkl_PITLifetimeTimer.h"
+#include <MKL25Z4.h>
+
+/*!
+ *  Associa os canais 0 e 1 e habilita o clock do PIT.
+ */
+mkl_PITLifetimeTimer::mkl_PITLifetimeTimer() {
+  low.bindChannel(PIT_Ch0);
+  high.bindChannel(PIT_Ch1);
+  low.enablePeripheralClock();
+}
+
+/*!
+ *  Zera e inicia o contador. O canal 1 é habilitado antes do canal 0, para
+ *  não perder o primeiro estouro (Chained timers, pág. 582).
+ *  Retorna false, sem mudar os canais, se um deles já foi reservado por
+ *  outro driver ou se o canal 0 já está habilitado.
+ */
+bool mkl_PITLifetimeTimer::start() {
+  if (PIT->CHANNEL[0].TCTRL & PIT_TCTRL_TEN_MASK) {
+    return false;
+  }
+  if (!low.claimChannel()) {
+    return false;
+  }
+  if (!high.claimChannel()) {
+    low.releaseChannel();
+    return false;
+  }
+  low.enablePeripheralModule();
+
+  high.disableTimer();
+  high.setPeriod(0xFFFFFFFF);
+  high.enableChainMode();
+  high.enableTimer();
+
+  low.setPeriod(0xFFFFFFFF);
+  low.enableTimer();
+  return true;
+}
+
+/*!
+ *  Para o contador e libera os canais.
+ */
+void mkl_PITLifetimeTimer::stop() {
+  low.disableTimer();
+  high.disableTimer();
+  high.disableChainMode();
+  high.releaseChannel();
+  low.releaseChannel();
+}
+
+/*!
+ *  Retorna os ciclos do clock do barramento desde start().
+ *
+ *  O LTMR64H é lido primeiro: a leitura dele captura o CVAL0 no LTMR64L.
+ */
+uint64_t mkl_PITLifetimeTimer::readTicks() {
+  uint32_t wraps = ~PIT_LTMR64H;
+  uint32_t count = ~PIT_LTMR64L;
+
+  return (static_cast<uint64_t>(wraps) << 32) | count;
+}
+
+/*!
+ *  Retorna os microssegundos desde start().
+ */
+uint64_t mkl_PITLifetimeTimer::readMicroseconds() {
+  return ticksToMicroseconds(readTicks());
+}
+
+/*!
+ *  Retorna os milissegundos desde start().
+ */
+uint64_t mkl_PITLifetimeTimer::readMilliseconds() {
+  return ticksToMilliseconds(readTicks());
+}
+
+/*!
+ *  Converte ciclos do clock do barramento em µs, arredondando para baixo.
+ *
+ *  Com 20971520 Hz = 5*2^22, 1 µs = 2^16/3125 ciclos. A parte alta e a baixa
+ *  do valor são convertidas separadamente para o produto caber em 64 bits.
+ */
+uint64_t mkl_PITLifetimeTimer::ticksToMicroseconds(uint64_t ticks) {
+#if PIT_BUS_CLOCK == 20971520u
+  return (ticks >> 16) * 3125 + (((ticks & 0xFFFF) * 3125) >> 16);
+#else
+  return (ticks / PIT_BUS_CLOCK) * 1000000 +
+         (ticks % PIT_BUS_CLOCK) * 1000000 / PIT_BUS_CLOCK;
+#endif
+}
+
+/*!
+ *  Converte ciclos do clock do barramento em ms, arredondando para baixo.
+ *
+ *  Com 20971520 Hz, 1 ms = 2^19/25 ciclos.
+ */
+uint64_t mkl_PITLifetimeTimer::ticksToMilliseconds(uint64_t ticks) {
+#if PIT_BUS_CLOCK == 20971520u
+  return (ticks >> 19) * 25 + (((ticks & 0x7FFFF) * 25) >> 19);
+#else
+  return (ticks / PIT_BUS_CLOCK) * 1000 +
+         (ticks % PIT_BUS_CLOCK) * 1000 / PIT_BUS_CLOCK;
+#endif
+}
@@ -0,0 +1,105 @@
+/*!
+ * @copyright   © 2017 UFAM - Universidade Federal do Amazonas.
+ *
+ * @brief       Base de tempo monotônica de 64 bits com os canais do PIT encadeados.
+ *
+ * @file        mkl_PITLifetimeTimer.h
+ * @version     1.2
+ * @date        17 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   PIT (Periodic Interrupt Timer).
+ *              +compiler     Kinetis® Design Studio IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão (data): Descrição breve.
+ *                             ++ 1.0 (17 Outubro 2026): Versão inicial.
+ *                             ++ 1.1 (17 Outubro 2026): Reserva dos canais (mkl_PIT::claimChannel); start retorna false com o canal 1 ocupado.
+ *                             ++ 1.2 (17 Outubro 2026): O canal 0 é sempre do contador: start() recusa o canal 0 em uso.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas
+ *              +courses      Engenharia da Computação
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Versão inicial:
+ *                             ++ Patrick Chagas dos Santos <patrick.chagas@gmail.com>
+ *                             ++ Gabriel Montenegro Villacrez <gvmontenegro19@gmail.com>
+ *                             ++ Andrezza Bonfim <andrezzabonfiiim@gmail.com>
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ *              Este programa é um software livre; Você pode redistribuí-lo
+ *              e/ou modificá-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              versão 3 da licença, ou qualquer versão posterior.
+ *
+ *              Este programa é distribuído na esperança de que seja útil,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implícita de
+ *              COMERCIALIZAÇÃO OU USO PARA UM DETERMINADO PROPÓSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#ifndef MKL_PITLIFETIMETIMER_H_
+#define MKL_PITLIFETIMETIMER_H_
+
+#include <stdint.h>
+#include <mkl_PIT/mkl_PIT.h>
+
+/*!
+ *  @class    mkl_PITLifetimeTimer
+ *
+ *  @brief    Contador de 64 bits do tempo de execução, em ciclos do clock do
+ *            barramento, com o canal 1 do PIT encadeado ao canal 0.
+ *
+ *  @details  O canal 1 (CHN = 1, LDVAL1 = 0xFFFFFFFF) decrementa a cada
+ *            estouro do canal 0, e os dois formam o Lifetime Timer. A leitura
+ *            do LTMR64H captura o CVAL0 no LTMR64L, logo a leitura dos dois
+ *            em sequência é consistente, sem desabilitar interrupções e sem
+ *            laço de releitura.
+ *
+ *            Os dois canais contam de 0xFFFFFFFF, e o contador é o valor
+ *            de 64 bits invertido.
+ *
+ *            Com o clock de 20,97 MHz, o contador estoura após mais de 27 mil
+ *            anos. As conversões para µs e ms usam apenas deslocamentos e
+ *            multiplicações, sem a divisão de 64 bits em software do
+ *            Cortex-M0+, e não estouram para nenhum valor do contador.
+ *
+ *            Ocupa os dois canais do PIT, sem as interrupções deles.
+ *            start() reserva os dois (mkl_PIT::claimChannel) e retorna
+ *            false se um deles já tem dono ou se o canal 0 já está
+ *            habilitado: um LDVAL0 ou um TEN mudado por outro driver
+ *            estragaria todas as marcas de tempo. Não use com uma
+ *            mkl_PITTimerWheel nem com um mkl_TimerService; as
+ *            temporizações ficam com os TPM.
+ *
+ *  @section  EXAMPLES USAGE
+ *
+ *             +fn mkl_PITLifetimeTimer lifetime;
+ *             +fn lifetime.start();
+ *             +fn uint64_t t0 = lifetime.readTicks();
+ *             +fn uint64_t us = lifetime.readMicroseconds();
+ *             +fn mkl_PITLifetimeTimer::ticksToMicroseconds(t1 - t0);
+ */
+class mkl_PITLifetimeTimer {
+ public:
+  mkl_PITLifetimeTimer();
+  bool start();
+  void stop();
+  uint64_t readTicks();
+  uint64_t readMicroseconds();
+  uint64_t readMilliseconds();
+  static uint64_t ticksToMicroseconds(uint64_t ticks);
+  static uint64_t ticksToMilliseconds(uint64_t ticks);
+
+ private:
+  mkl_PIT low;
+  mkl_PIT high;
+};
+
+#endif  //  MKL_PITLIFETIMETIMER_H_
@@ -1,119 +1,119 @@
-/*!
- * @copyright    2017 UFAM - Universidade Federal do Amazonas.
- *
- * @brief       Interface de programao de aplicaes em C++ para  o Periodic interrupt Timer (MKL25Z).
- *
- * @file        mkl_PITPeriodicInterrupt.cpp
- * @version     1.0
- * @date        6 Julho 2017
- *
- * @section     HARDWARES & SOFTWARES
- *              +board        FRDM-KL25Z da NXP.
- *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
- *              +peripheral   PIT - Periodic Interrupt Timer.
- *              +compiler     Kinetis Design Studio IDE
- *              +manual       L25P80M48SF0RM, Rev.3, September 2012
- *              +revisions    Verso (data): Descrio breve.
- *                             ++ 1.0 (6 Julho 2017): Verso inicial.
- *
- * @section     AUTHORS & DEVELOPERS
- *              +institution  Universidade Federal do Amazonas
- *              +courses      Engenharia da Computao / Engenharia Eltrica
- *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
- *              +student      Verso inicial:
- *                             ++ Jose Luis da Silva e Silva <joseluis70123@gmail.com>
- *
- * @section     LICENSE
- *
- *              GNU General Public License (GNU GPL).
- *
- *              Este programa  um software livre; Voc pode redistribu-lo
- *              e/ou modific-lo de acordo com os termos do "GNU General Public
- *              License" como publicado pela Free Software Foundation; Seja a
- *              verso 3 da licena, ou qualquer verso posterior.
- *
- *              Este programa  distribudo na esperana de que seja til,
- *              mas SEM QUALQUER GARANTIA; Sem a garantia implcita de
- *              COMERCIALIZAO OU USO PARA UM DETERMINADO PROPSITO.
- *              Veja o site da "GNU General Public License" para mais detalhes.
- *
- * @htmlonly    http://www.gnu.org/copyleft/gpl.html
- */
-
-#include <stdint.h>
-#include <MKL25Z4.h>
-#include "mkl_PITPeriodicInterrupt.h"
-
-/*!
- *   @fn         mkl_PITInterruptInterrupt
- *
- *   @brief      Inicializa o perifrico PIT.
- *
- *   Este mtodo construtor associa ao objeto o canal do parametro "channel"
- *
- *   @param[in]  channel - canal dsf_Ch0_PIT ou canal dsf_Ch1_PIT usado.
- */
-
-mkl_PITInterruptInterrupt::mkl_PITInterruptInterrupt(PIT_ChPIT channel){
-	 /*!
-	   *  Inicializa os atributos do canal.
-	   */
-		bindChannel(channel);
-
-	  /*!
-	   *  Habilita a operao do mdulo.
-	   */
-	  enablePeripheralClock();
-}
-/*!
- *   @fn         enableInterruptRequests
- *
- *   @brief      Habilita pedidos de interrupes de um canal
- *
- *   Este mtodo habilita a gerao de pedidos de interrupes de um canal e habilita tambm
- *   a entrada de interrupo do PIT no gerenciador de interrupes (NVIC), o que ativa a
- *   chamada da rotina de servio de interrupo (ISR) do vetor de interrupes do NVIC.
- *
- *   @remarks  Siglas e pginas do Manual de Referncia KL25:
- *	           - PIT_TCTRLn: Timer Control Register. Pg. 579.
- *             - NVIC: Nested Vectored Interrupt Controller. Pg. 51.
- */
-
-void mkl_PITInterruptInterrupt::enableInterruptRequests(){
-	/*!
-	   * Habilita a gerao de pedidos de interrpes.
-	   */
-	  *addrTCTRLn |= PIT_TCTRL_TIE_MASK;
-
-	  /*!
-	   * Habilita a entrada de interrupes do PIT no NVIC.
-	   */
-	  NVIC_EnableIRQ(PIT_IRQn);
-}
-
-/*!
- *   @fn         disableInterruptRequests
- *
- *   @brief      Desabilita pedidos de interrupes de um canal
- *
- *   Este mtodo desabilita o pedido de interrupes de um canal e desabilita tambm a entrada
- *   de interrupo do PIT no gerenciador de interrupes (NVIC), o que desativa a chamada da
- *   rotina de servio de interrupo (ISR) do vetor de interrupes do NVIC.
- *
- *   @remarks  Siglas e pginas do Manual de Referncia KL25:
- *             - PIT_TCTRLn: Timer Control Register. Pg. 579.
- *             - NVIC: Nested Vectored Interrupt Controller. Pg. 51.
- */
-
-void mkl_PITInterruptInterrupt::disableInterruptRequests(){
-	/*!
-	   *  Desabilita a gerao de pedidos de interrpes.
-	   */
-	  *addrTCTRLn &= ~PIT_TCTRL_TIE_MASK;
-
-	  /*!
-	   * Desabilita a entrada de interrupes do PIT no NVIC.
-	   */
-	  NVIC_DisableIRQ(PIT_IRQn);
-}
-
+/*!
+ * @copyright   © 2017 UFAM - Universidade Federal do Amazonas.
+ *
+ * @brief       Interface de programação de aplicações em C++ para  o Periodic interrupt Timer (MKL25Z).
+ *
+ * @file        mkl_PITPeriodicInterrupt.cpp
+ * @version     1.0
+ * @date        6 Julho 2017
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   PIT - Periodic Interrupt Timer.
+ *              +compiler     Kinetis® Design Studio IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão (data): Descrição breve.
+ *                             ++ 1.0 (6 Julho 2017): Versão inicial.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas
+ *              +courses      Engenharia da Computação / Engenharia Elétrica
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Versão inicial:
+ *                             ++ Jose Luis da Silva e Silva <joseluis70123@gmail.com>
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ *              Este programa é um software livre; Você pode redistribuí-lo
+ *              e/ou modificá-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              versão 3 da licença, ou qualquer versão posterior.
+ *
+ *              Este programa é distribuído na esperança de que seja útil,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implícita de
+ *              COMERCIALIZAÇÃO OU USO PARA UM DETERMINADO PROPÓSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include <stdint.h>
+#include <MKL25Z4.h>
+#include "mkl_PITPeriodicInterrupt.h"
+
+/*!
+ *   @fn         mkl_PITInterruptInterrupt
+ *
+ *   @brief      Inicializa o periférico PIT.
+ *
+ *   Este método construtor associa ao objeto o canal do parametro "channel"
+ *
+ *   @param[in]  channel - canal dsf_Ch0_PIT ou canal dsf_Ch1_PIT usado.
+ */
+
+mkl_PITInterruptInterrupt::mkl_PITInterruptInterrupt(PIT_ChPIT channel){
+	 /*!
+	   *  Inicializa os atributos do canal.
+	   */
+		bindChannel(channel);
+
+	  /*!
+	   *  Habilita a operação do módulo.
+	   */
+	  enablePeripheralClock();
+}
+/*!
+ *   @fn         enableInterruptRequests
+ *
+ *   @brief      Habilita pedidos de interrupções de um canal
+ *
+ *   Este método habilita a geração de pedidos de interrupções de um canal e habilita também
+ *   a entrada de interrupção do PIT no gerenciador de interrupções (NVIC), o que ativa a
+ *   chamada da rotina de serviço de interrupção (ISR) do vetor de interrupções do NVIC.
+ *
+ *   @remarks  Siglas e páginas do Manual de Referência KL25:
+ *	           - PIT_TCTRLn: Timer Control Register. Pág. 579.
+ *             - NVIC: Nested Vectored Interrupt Controller. Pág. 51.
+ */
+
+void mkl_PITInterruptInterrupt::enableInterruptRequests(){
+	/*!
+	   * Habilita a geração de pedidos de interrpções.
+	   */
+	  *addrTCTRLn |= PIT_TCTRL_TIE_MASK;
+
+	  /*!
+	   * Habilita a entrada de interrupções do PIT no NVIC.
+	   */
+	  NVIC_EnableIRQ(PIT_IRQn);
+}
+
+/*!
+ *   @fn         disableInterruptRequests
+ *
+ *   @brief      Desabilita pedidos de interrupções de um canal
+ *
+ *   Este método desabilita o pedido de interrupções de um canal e desabilita também a entrada
+ *   de interrupção do PIT no gerenciador de interrupções (NVIC), o que desativa a chamada da
+ *   rotina de serviço de interrupção (ISR) do vetor de interrupções do NVIC.
+ *
+ *   @remarks  Siglas e páginas do Manual de Referência KL25:
+ *             - PIT_TCTRLn: Timer Control Register. Pág. 579.
+ *             - NVIC: Nested Vectored Interrupt Controller. Pág. 51.
+ */
+
+void mkl_PITInterruptInterrupt::disableInterruptRequests(){
+	/*!
+	   *  Desabilita a geração de pedidos de interrpções.
+	   */
+	  *addrTCTRLn &= ~PIT_TCTRL_TIE_MASK;
+
+	  /*!
+	   * Desabilita a entrada de interrupções do PIT no NVIC.
+	   */
+	  NVIC_DisableIRQ(PIT_IRQn);
+}
+
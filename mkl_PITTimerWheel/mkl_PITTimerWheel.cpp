@@ -0,0 +1,435 @@
+/*!
+ * @copyright   © 2017 UFAM - Universidade Federal do Amazonas.
+ *
+ * @brief       Temporizadores por software em roda de tempo, com um canal do PIT.
+ *
+ * @file        mkl_PITTimerWheel.cpp
+ * @version     1.4
+ * @date        17 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   PIT (Periodic Interrupt Timer).
+ *              +compiler     Kinetis® Design Studio IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão (data): Descrição breve.
+ *                             ++ 1.0 (17 Outubro 2026): Versão inicial.
+ *                             ++ 1.1 (17 Outubro 2026): Modo sem tick (startTickless): o PIT é programado para o próximo estouro.
+ *                             ++ 1.2 (17 Outubro 2026): Reserva do canal (claimChannel) em start e startTickless.
+ *                             ++ 1.3 (17 Outubro 2026): Seção crítica (PRIMASK) também em tick e handleInterrupt: start/cancel podem vir de uma interrupção de prioridade maior.
+ *                             ++ 1.4 (17 Outubro 2026): Atraso da recarga no modo sem tick medido com o SysTick, em vez da constante PIT_WHEEL_RELOAD_CYCLES.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas
+ *              +courses      Engenharia da Computação
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Versão inicial:
+ *                             ++ Patrick Chagas dos Santos <patrick.chagas@gmail.com>
+ *                             ++ Gabriel Montenegro Villacrez <gvmontenegro19@gmail.com>
+ *                             ++ Andrezza Bonfim <andrezzabonfiiim@gmail.com>
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ *              Este programa é um software livre; Você pode redistribuí-lo
+ *              e/ou modificá-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              versão 3 da licença, ou qualquer versão posterior.
+ *
+ *              Este programa é distribuído na esperança de que seja útil,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implícita de
+ *              COMERCIALIZAÇÃO OU USO PARA UM DETERMINADO PROPÓSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include "mkl_PITTimerWheel.h"
+#include <MKL25Z4.h>
+
+/*!
+ *  Operações das listas circulares com sentinela: a remoção não precisa
+ *  saber em que lista o elo está.
+ */
+static void linkInit(mkl_TimerLink *head) {
+  head->next = head;
+  head->prev = head;
+}
+
+static void linkInsert(mkl_TimerLink *head, mkl_TimerLink *link) {
+  link->next = head;
+  link->prev = head->prev;
+  head->prev->next = link;
+  head->prev = link;
+}
+
+static void linkRemove(mkl_TimerLink *link) {
+  link->prev->next = link->next;
+  link->next->prev = link->prev;
+  link->next = 0;
+  link->prev = 0;
+}
+
+/*!
+ *  Temporizador inativo, sem rotina.
+ */
+mkl_SoftTimer::mkl_SoftTimer()
+    : expiry(0), period(0), callback(0), context(0), expired(false) {
+  next = 0;
+  prev = 0;
+}
+
+/*!
+ *   @fn         setCallback
+ *
+ *   @brief      Associa a rotina chamada no estouro, na interrupção.
+ */
+void mkl_SoftTimer::setCallback(mkl_TimerCallback callback, void *context) {
+  this->callback = callback;
+  this->context = context;
+}
+
+/*!
+ *   @fn         mkl_PITTimerWheel
+ *
+ *   @brief      Associa o canal e esvazia a roda.
+ */
+mkl_PITTimerWheel::mkl_PITTimerWheel(PIT_ChPIT channel)
+    : mkl_PITInterruptInterrupt(channel), now(0), tickless(false),
+      cyclesPerTick(0), load(0), endTick(0), endRemainder(0), readCycles(0),
+      deadline(0), deadlineValid(false) {
+  for (int i = 0; i < kSlots; i++) {
+    linkInit(&slots[i]);
+  }
+}
+
+/*!
+ *   @fn         start
+ *
+ *   @brief      Programa o canal para interromper tickHz vezes por segundo.
+ *
+ *   @return     false se o canal já foi reservado por outro driver.
+ */
+bool mkl_PITTimerWheel::start(uint32_t tickHz) {
+  if (!claimChannel()) {
+    return false;
+  }
+  enablePeripheralModule();
+  setFrequency(tickHz);
+  resetCounter();
+  clearInterruptFlag();
+  enableInterruptRequests();
+  return true;
+}
+
+/*!
+ *   @fn         startTickless
+ *
+ *   @brief      Inicia a roda no modo sem tick, com ticks de 1/tickHz s.
+ *
+ *   O canal passa a interromper só no próximo estouro (ou após o maior
+ *   período que cabe no LDVAL, se não houver temporizador ativo). O SysTick,
+ *   referência da reprogramação, é iniciado em contagem livre se estiver
+ *   parado.
+ *
+ *   @return     false se o canal já foi reservado por outro driver, ou se o
+ *               SysTick já conta com outro LOAD ou outro clock.
+ */
+bool mkl_PITTimerWheel::startTickless(uint32_t tickHz) {
+  if (SysTick->CTRL & SysTick_CTRL_ENABLE_Msk) {
+    if (SysTick->LOAD != SysTick_LOAD_RELOAD_Msk ||
+        !(SysTick->CTRL & SysTick_CTRL_CLKSOURCE_Msk)) {
+      return false;
+    }
+  } else {
+    SysTick->LOAD = SysTick_LOAD_RELOAD_Msk;
+    SysTick->VAL = 0;
+    SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_ENABLE_Msk;
+  }
+  if (!claimChannel()) {
+    return false;
+  }
+  enablePeripheralModule();
+  cyclesPerTick = PIT_BUS_CLOCK/tickHz;
+  tickless = true;
+
+  /*!
+   *  Período inicial de um tick, a partir do tick atual.
+   */
+  endTick = now + 1;
+  endRemainder = 0;
+  load = cyclesPerTick - 1;
+  setPeriod(load);
+  resetCounter();
+  clearInterruptFlag();
+
+  /*!
+   *  Duração de uma leitura do SysTick e uma do CVAL, descontada em
+   *  reprogram().
+   */
+  uint32_t before = SysTick->VAL;
+  readCounter();
+  readCycles = (before - SysTick->VAL) & SysTick_VAL_CURRENT_Msk;
+  findDeadline();
+  reprogram();
+  enableInterruptRequests();
+  return true;
+}
+
+/*!
+ *   @fn         handleInterrupt
+ *
+ *   @brief      Rotina de serviço do canal: limpa o TIF e avança a roda.
+ *
+ *   No modo sem tick, a roda salta para o tick do estouro programado (não
+ *   há estouros antes dele), trata-o e reprograma o canal.
+ */
+void mkl_PITTimerWheel::handleInterrupt() {
+  if (!isInterruptFlagSet()) {
+    return;
+  }
+  clearInterruptFlag();
+  if (!tickless) {
+    tick();
+    return;
+  }
+
+  /*!
+   *  O período terminou no tick endTick, e o canal foi recarregado com o
+   *  mesmo LDVAL: o novo fim fica load + 1 ciclos adiante. O fim é
+   *  atualizado antes das rotinas, que podem consultar o tick atual.
+   */
+  uint32_t primask = __get_PRIMASK();
+  __disable_irq();
+  now = endTick - 1;
+  advanceEnd();
+  __set_PRIMASK(primask);
+  tick();
+  __disable_irq();
+  findDeadline();
+  reprogram();
+  __set_PRIMASK(primask);
+}
+
+/*!
+ *   @fn         tick
+ *
+ *   @brief      Avança um tick e trata os temporizadores que estouram nele.
+ *
+ *   Os estourados saem da posição para uma lista local antes de qualquer
+ *   rotina ser chamada; assim, as rotinas podem iniciar e cancelar
+ *   temporizadores, inclusive os da lista local. As listas só são mexidas
+ *   com as interrupções mascaradas (PRIMASK), e as rotinas são chamadas
+ *   com elas habilitadas: uma interrupção de prioridade maior (a da porta
+ *   de uma tecla, por exemplo) pode chamar startTimer e cancelTimer.
+ */
+void mkl_PITTimerWheel::tick() {
+  uint32_t primask = __get_PRIMASK();
+  __disable_irq();
+  uint32_t t = now + 1;
+  now = t;
+
+  mkl_TimerLink *head = &slots[t & (kSlots - 1)];
+  mkl_TimerLink fired;
+  linkInit(&fired);
+  for (mkl_TimerLink *link = head->next; link != head; ) {
+    mkl_TimerLink *following = link->next;
+    if (static_cast<mkl_SoftTimer *>(link)->expiry == t) {
+      linkRemove(link);
+      linkInsert(&fired, link);
+    }
+    link = following;
+  }
+
+  while (fired.next != &fired) {
+    mkl_SoftTimer &timer = *static_cast<mkl_SoftTimer *>(fired.next);
+    linkRemove(&timer);
+    timer.expired = true;
+    if (timer.period) {
+      timer.expiry = t + timer.period;
+      insert(timer);
+    }
+    mkl_TimerCallback callback = timer.callback;
+    void *context = timer.context;
+    if (callback) {
+      __set_PRIMASK(primask);
+      callback(context);
+      __disable_irq();
+    }
+  }
+  __set_PRIMASK(primask);
+}
+
+/*!
+ *   @fn         startTimer
+ *
+ *   @brief      (Re)inicia o temporizador para estourar após "ticks" ticks.
+ *
+ *   @param[in]  timer - temporizador; se ativo, é reiniciado.
+ *   @param[in]  ticks - ticks até o estouro, de 1 a 2^31.
+ *   @param[in]  period - ticks entre os estouros seguintes; 0 para um único
+ *               estouro.
+ */
+void mkl_PITTimerWheel::startTimer(mkl_SoftTimer &timer, uint32_t ticks,
+                                   uint32_t period) {
+  uint32_t primask = __get_PRIMASK();
+  __disable_irq();
+  if (timer.isActive()) {
+    linkRemove(&timer);
+  }
+  timer.expired = false;
+  timer.period = period;
+  timer.expiry = (tickless ? currentTick() : now) + (ticks ? ticks : 1);
+  insert(timer);
+
+  /*!
+   *  No modo sem tick, o canal é reprogramado se o novo estouro for antes
+   *  do programado. Com o TIF já ativo, a interrupção pendente reprograma.
+   */
+  if (tickless && !isInterruptFlagSet() &&
+      static_cast<int32_t>(timer.expiry - endTick) < 0) {
+    deadline = timer.expiry;
+    deadlineValid = true;
+    reprogram();
+  }
+  __set_PRIMASK(primask);
+}
+
+/*!
+ *   @fn         cancelTimer
+ *
+ *   @brief      Para o temporizador, sem marcar o estouro.
+ */
+void mkl_PITTimerWheel::cancelTimer(mkl_SoftTimer &timer) {
+  uint32_t primask = __get_PRIMASK();
+  __disable_irq();
+  if (timer.isActive()) {
+    linkRemove(&timer);
+  }
+  __set_PRIMASK(primask);
+}
+
+/*!
+ *   @fn         readTicks
+ *
+ *   @brief      Retorna o tick atual, inclusive no modo sem tick.
+ */
+uint32_t mkl_PITTimerWheel::readTicks() {
+  if (!tickless) {
+    return now;
+  }
+  uint32_t primask = __get_PRIMASK();
+  __disable_irq();
+  uint32_t ticks = currentTick();
+  __set_PRIMASK(primask);
+  return ticks;
+}
+
+/*!
+ *  Tick atual no modo sem tick, com as interrupções desabilitadas: o fim do
+ *  período está CVAL + 1 ciclos adiante. Se o período já terminou (TIF
+ *  ativo, interrupção ainda não atendida), o canal já foi recarregado e o
+ *  fim considerado é o do novo período.
+ */
+uint32_t mkl_PITTimerWheel::currentTick() {
+  uint32_t tick = endTick;
+  uint32_t rest = endRemainder;
+  uint32_t count = readCounter();
+  if (isInterruptFlagSet()) {
+    count = readCounter();
+    rest += load + 1;
+    tick += rest/cyclesPerTick;
+    rest %= cyclesPerTick;
+  }
+  if (count + 1 <= rest) {
+    return tick;
+  }
+  return tick - (count + 1 - rest + cyclesPerTick - 1)/cyclesPerTick;
+}
+
+/*!
+ *  Avança o fim do período em load + 1 ciclos, após a recarga automática.
+ */
+void mkl_PITTimerWheel::advanceEnd() {
+  uint32_t rest = endRemainder + load + 1;
+  endTick += rest/cyclesPerTick;
+  endRemainder = rest % cyclesPerTick;
+}
+
+/*!
+ *  Procura o estouro mais próximo entre todos os temporizadores ativos.
+ */
+void mkl_PITTimerWheel::findDeadline() {
+  deadlineValid = false;
+  for (int i = 0; i < kSlots; i++) {
+    for (mkl_TimerLink *link = slots[i].next; link != &slots[i];
+         link = link->next) {
+      uint32_t expiry = static_cast<mkl_SoftTimer *>(link)->expiry;
+      if (!deadlineValid || static_cast<int32_t>(expiry - deadline) < 0) {
+        deadline = expiry;
+        deadlineValid = true;
+      }
+    }
+  }
+}
+
+/*!
+ *  Recarrega o canal para terminar o período no início do tick "deadline"
+ *  (ou após o maior período possível, sem estouro pendente). Chamado com as
+ *  interrupções desabilitadas.
+ *
+ *  O novo LDVAL é o número de ciclos até o fim atual (CVAL + 1) mais a
+ *  distância, em ciclos, entre o fim atual e o novo: só uma soma entre a
+ *  leitura do CVAL e a recarga, que é feita desabilitando e habilitando o
+ *  TEN (a escrita no LDVAL só valeria no fim do período em curso).
+ *
+ *  O período termina, então, atrasado dos ciclos entre a leitura do CVAL e
+ *  a recarga, medidos com o SysTick (núcleo, sem estados de espera):
+ *  - "elapsed", do SysTick lido antes do CVAL ao lido depois do novo CVAL;
+ *  - menos os ciclos desde a recarga (load - CVAL novo);
+ *  - menos a duração de uma leitura do SysTick e uma do CVAL (readCycles,
+ *    medida em startTickless com um CVAL entre duas leituras do SysTick).
+ *    Como o primeiro par é SysTick-CVAL e o último CVAL-SysTick, o ponto em
+ *    que cada leitura amostra o contador se cancela.
+ *  O atraso (mais o período mínimo, se o novo fim já passou) fica em
+ *  endRemainder: a fase dos ticks não depende de uma latência suposta da
+ *  ponte de periféricos.
+ */
+void mkl_PITTimerWheel::reprogram() {
+  uint32_t tick = currentTick();
+  uint32_t maxTicks = 0xFFFFFFFF/cyclesPerTick - 1;
+  uint32_t target = tick + maxTicks;
+  if (deadlineValid) {
+    int32_t ahead = static_cast<int32_t>(deadline - tick);
+    target = tick + (ahead < 1 ? 1 : (static_cast<uint32_t>(ahead) < maxTicks
+                                          ? static_cast<uint32_t>(ahead)
+                                          : maxTicks));
+  }
+  int64_t distance = static_cast<int64_t>(static_cast<int32_t>(target - endTick)) *
+                     cyclesPerTick - endRemainder;
+
+  uint32_t before = SysTick->VAL;
+  uint32_t count = readCounter();
+  int64_t cycles = distance + count;
+  load = cycles > 0 ? static_cast<uint32_t>(cycles) : 0;
+  setPeriod(load);
+  disableTimer();
+  enableTimer();
+  uint32_t sinceReload = load - readCounter();
+  uint32_t elapsed = (before - SysTick->VAL) & SysTick_VAL_CURRENT_Msk;
+
+  int32_t measured = static_cast<int32_t>(elapsed - sinceReload - readCycles);
+  uint32_t late = static_cast<uint32_t>((measured > 0 ? measured : 0) +
+                                        (load - cycles));
+  endTick = target + late/cyclesPerTick;
+  endRemainder = late % cyclesPerTick;
+}
+
+/*!
+ *  Insere o temporizador na posição do seu estouro.
+ */
+void mkl_PITTimerWheel::insert(mkl_SoftTimer &timer) {
+  linkInsert(&slots[timer.expiry & (kSlots - 1)], &timer);
+}
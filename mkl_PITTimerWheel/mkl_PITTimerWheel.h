@@ -0,0 +1,202 @@
+/*!
+ * @copyright   © 2017 UFAM - Universidade Federal do Amazonas.
+ *
+ * @brief       Temporizadores por software em roda de tempo, com um canal do PIT.
+ *
+ * @file        mkl_PITTimerWheel.h
+ * @version     1.5
+ * @date        17 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   PIT (Periodic Interrupt Timer).
+ *              +compiler     Kinetis® Design Studio IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão (data): Descrição breve.
+ *                             ++ 1.0 (17 Outubro 2026): Versão inicial.
+ *                             ++ 1.1 (17 Outubro 2026): Modo sem tick (startTickless): o PIT é programado para o próximo estouro.
+ *                             ++ 1.2 (17 Outubro 2026): PIT_WHEEL_RELOAD_CYCLES, documentado como não verificado na placa.
+ *                             ++ 1.3 (17 Outubro 2026): Reserva do canal (claimChannel) em start e startTickless.
+ *                             ++ 1.4 (17 Outubro 2026): Seção crítica (PRIMASK) também em tick e handleInterrupt: start/cancel podem vir de uma interrupção de prioridade maior.
+ *                             ++ 1.5 (17 Outubro 2026): Atraso da recarga no modo sem tick medido com o SysTick; PIT_WHEEL_RELOAD_CYCLES removido.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas
+ *              +courses      Engenharia da Computação
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Versão inicial:
+ *                             ++ Patrick Chagas dos Santos <patrick.chagas@gmail.com>
+ *                             ++ Gabriel Montenegro Villacrez <gvmontenegro19@gmail.com>
+ *                             ++ Andrezza Bonfim <andrezzabonfiiim@gmail.com>
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ *              Este programa é um software livre; Você pode redistribuí-lo
+ *              e/ou modificá-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              versão 3 da licença, ou qualquer versão posterior.
+ *
+ *              Este programa é distribuído na esperança de que seja útil,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implícita de
+ *              COMERCIALIZAÇÃO OU USO PARA UM DETERMINADO PROPÓSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#ifndef MKL_PITTIMERWHEEL_H_
+#define MKL_PITTIMERWHEEL_H_
+
+#include <stdint.h>
+#include <mkl_PITPeriodicInterrupt/mkl_PITPeriodicInterrupt.h>
+
+/*!
+ *  Rotina chamada no estouro de um temporizador, na interrupção do PIT.
+ */
+typedef void (*mkl_TimerCallback)(void *context);
+
+/*!
+ *  Elo das listas duplamente encadeadas e circulares da roda.
+ */
+struct mkl_TimerLink {
+  mkl_TimerLink *next;
+  mkl_TimerLink *prev;
+};
+
+/*!
+ *  @class    mkl_SoftTimer
+ *
+ *  @brief    Temporizador por software de um mkl_PITTimerWheel.
+ *
+ *  @details  O objeto é o próprio nó da lista (sem alocação) e deve existir
+ *            enquanto estiver ativo. O estouro pode ser consultado
+ *            (isExpired/clearExpired) ou tratado por uma rotina (setCallback).
+ */
+class mkl_SoftTimer : private mkl_TimerLink {
+ public:
+  mkl_SoftTimer();
+  void setCallback(mkl_TimerCallback callback, void *context);
+  bool isActive() const { return next != 0; }
+  bool isExpired() const { return expired; }
+  void clearExpired() { expired = false; }
+
+ private:
+  friend class mkl_PITTimerWheel;
+  uint32_t expiry;
+  uint32_t period;
+  mkl_TimerCallback callback;
+  void *context;
+  volatile bool expired;
+};
+
+/*!
+ *  @class    mkl_PITTimerWheel
+ *
+ *  @brief    Roda de tempo de temporizadores por software, avançada pela
+ *            interrupção periódica de um canal do PIT.
+ *
+ *  @details  Roda com hash de kSlots posições: o temporizador que estoura no
+ *            tick t fica na lista da posição t % kSlots. Iniciar e cancelar
+ *            são O(1) (inserção e remoção em lista duplamente encadeada). A
+ *            cada tick, apenas a lista da posição atual é percorrida, e os
+ *            temporizadores cujo estouro é um tick futuro (uma volta ou mais
+ *            adiante) são mantidos: o tempo da interrupção depende só dos
+ *            temporizadores daquela posição, cerca de n/kSlots para n
+ *            temporizadores.
+ *
+ *            No estouro, o temporizador é marcado (isExpired), rearmado se
+ *            for periódico e a rotina dele, se houver, é chamada na
+ *            interrupção; ela pode iniciar e cancelar temporizadores.
+ *
+ *            O contador de ticks é de 32 bits; a duração máxima é 2^31
+ *            ticks. start/cancel podem ser chamados fora e dentro de
+ *            qualquer interrupção, de prioridade maior ou menor que a do
+ *            PIT: eles e as partes de tick/handleInterrupt que mexem nas
+ *            listas usam uma seção crítica com o PRIMASK, e as rotinas dos
+ *            temporizadores rodam fora dela.
+ *
+ *            start() e startTickless() reservam o canal
+ *            (mkl_PIT::claimChannel) e retornam false, sem tocar no canal,
+ *            se outro driver já o reservou: o mkl_PITLifetimeTimer ocupa o
+ *            canal 1, e o mkl_TimerService, o canal do tick e o seu canal
+ *            dedicado quando aberto.
+ *
+ *            O canal pode ser compartilhado: se a interrupção dele já é
+ *            usada, por exemplo, pela varredura dos displays, não chame
+ *            start() e chame tick() na rotina de serviço existente.
+ *
+ *            No modo sem tick (startTickless), o canal não interrompe a cada
+ *            tick: o LDVAL é reprogramado para o estouro mais próximo, e a
+ *            CPU pode dormir (WFI) entre os eventos. O tempo é mantido pelo
+ *            fim do período em curso (tick e fração em ciclos) e pelo CVAL:
+ *            na reprogramação, o novo LDVAL é o CVAL lido (readCounter) mais
+ *            a distância até o novo fim. Os ciclos entre a leitura do CVAL
+ *            e a recarga do canal são medidos com o SysTick em contagem
+ *            livre, e não estimados: o fim do novo período é registrado com
+ *            esse atraso, e os ticks não perdem a fase, qualquer que seja a
+ *            latência da ponte de periféricos.
+ *
+ *            O SysTick é usado como no mkl_Profiler (LOAD = 0xFFFFFF,
+ *            CLKSOURCE = 1, núcleo e barramento no mesmo clock) e pode ser
+ *            compartilhado com ele: startTickless o inicia se estiver
+ *            parado e retorna false se ele estiver programado de outra
+ *            forma.
+ *            Um cancelamento não reprograma o canal; no pior caso, ele
+ *            acorda uma vez sem estouro. A busca do próximo estouro, na
+ *            interrupção, percorre todos os temporizadores.
+ *
+ *  @section  EXAMPLES USAGE
+ *
+ *             +fn mkl_PITTimerWheel wheel(PIT_Ch0);
+ *             +fn mkl_SoftTimer debounce, sleep;
+ *             +fn wheel.start(1000);                       // tick de 1 ms
+ *             +fn wheel.startTimer(debounce, 30);
+ *             +fn wheel.startTimer(sleep, 60000, 60000);   // periódico
+ *             +fn void PIT_IRQHandler() { wheel.handleInterrupt(); }
+ *             +fn if (debounce.isExpired()) { debounce.clearExpired(); }
+ */
+class mkl_PITTimerWheel : public mkl_PITInterruptInterrupt {
+ public:
+  static const uint8_t kSlots = 32;
+
+  explicit mkl_PITTimerWheel(PIT_ChPIT channel);
+  bool start(uint32_t tickHz);
+  bool startTickless(uint32_t tickHz);
+  void handleInterrupt();
+  void tick();
+  void startTimer(mkl_SoftTimer &timer, uint32_t ticks, uint32_t period = 0);
+  void cancelTimer(mkl_SoftTimer &timer);
+  uint32_t readTicks();
+
+ private:
+  mkl_TimerLink slots[kSlots];
+  volatile uint32_t now;
+
+  /*!
+   *  Estado do modo sem tick: o período em curso, de LDVAL = "load", termina
+   *  "endRemainder" ciclos após o início do tick "endTick".
+   */
+  bool tickless;
+  uint32_t cyclesPerTick;
+  uint32_t load;
+  uint32_t endTick;
+  uint32_t endRemainder;
+
+  /*!
+   *  Ciclos de uma leitura do SysTick e uma do CVAL, medidos no início.
+   */
+  uint32_t readCycles;
+  uint32_t deadline;
+  bool deadlineValid;
+
+  void insert(mkl_SoftTimer &timer);
+  uint32_t currentTick();
+  void advanceEnd();
+  void findDeadline();
+  void reprogram();
+};
+
+#endif  //  MKL_PITTIMERWHEEL_H_
@@ -0,0 +1,169 @@
+/*!
+ * @copyright   © 2017 UFAM - Universidade Federal do Amazonas.
+ *
+ * @brief       Medição do tempo de execução de trechos de código com o SysTick.
+ *
+ * @file        mkl_Profiler.cpp
+ * @version     1.1
+ * @date        17 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   SysTick (System Timer).
+ *              +compiler     Kinetis® Design Studio IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão (data): Descrição breve.
+ *                             ++ 1.0 (17 Outubro 2026): Versão inicial.
+ *                             ++ 1.1 (17 Outubro 2026): Soma de 32 bits, mínimo e máximo opcionais e desconto sem underflow.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas
+ *              +courses      Engenharia da Computação
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Versão inicial:
+ *                             ++ Patrick Chagas dos Santos <patrick.chagas@gmail.com>
+ *                             ++ Gabriel Montenegro Villacrez <gvmontenegro19@gmail.com>
+ *                             ++ Andrezza Bonfim <andrezzabonfiiim@gmail.com>
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ *              Este programa é um software livre; Você pode redistribuí-lo
+ *              e/ou modificá-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              versão 3 da licença, ou qualquer versão posterior.
+ *
+ *              Este programa é distribuído na esperança de que seja útil,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implícita de
+ *              COMERCIALIZAÇÃO OU USO PARA UM DETERMINADO PROPÓSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include "mkl_Profiler.h"
+
+/*!
+ *  Tabela das sondas, nomes e custo de uma medição vazia.
+ */
+mkl_ProfilerProbe mkl_Profiler::probes[mkl_Profiler::kProbes];
+uint32_t mkl_Profiler::overhead;
+const char *mkl_Profiler::names[mkl_Profiler::kProbes];
+
+/*!
+ *   @fn         start
+ *
+ *   @brief      Inicia o SysTick em contagem livre e zera as sondas.
+ *
+ *   O custo de uma medição vazia (duas leituras seguidas do VAL) é medido
+ *   aqui e descontado das medições seguintes.
+ *
+ *   @remarks  Siglas do Cortex-M0+ Devices Generic User Guide:
+ *             - SYST_CSR, SYST_RVR, SYST_CVR: SysTick registers. Sec. 4.4.
+ */
+void mkl_Profiler::start() {
+  SysTick->LOAD = SysTick_LOAD_RELOAD_Msk;
+  SysTick->VAL = 0;
+  SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_ENABLE_Msk;
+
+  overhead = 0;
+  uint32_t begin = readCounter();
+  overhead = (begin - SysTick->VAL) & SysTick_VAL_CURRENT_Msk;
+  reset();
+}
+
+/*!
+ *   @fn         reset
+ *
+ *   @brief      Zera as estatísticas de todas as sondas.
+ */
+void mkl_Profiler::reset() {
+  for (int i = 0; i < kProbes; i++) {
+    probes[i].count = 0;
+    probes[i].total = 0;
+#ifdef MKL_PROFILER_MINMAX
+    probes[i].min = 0xFFFFFFFF;
+    probes[i].max = 0;
+#endif
+  }
+}
+
+/*!
+ *   @fn         setName
+ *
+ *   @brief      Associa um nome à sonda, usado por dump().
+ */
+void mkl_Profiler::setName(uint8_t probe, const char *name) {
+  names[probe] = name;
+}
+
+/*!
+ *   @fn         readMean
+ *
+ *   @brief      Retorna a duração média da sonda, em ciclos.
+ */
+uint32_t mkl_Profiler::readMean(uint8_t probe) {
+  if (probes[probe].count == 0) {
+    return 0;
+  }
+  return probes[probe].total / probes[probe].count;
+}
+
+/*!
+ *  Escreve o número em decimal. Fora do caminho crítico: usa divisões.
+ */
+static void putNumber(void (*putChar)(char), uint32_t value) {
+  char text[10];
+  int length = 0;
+  do {
+    text[length++] = '0' + value % 10;
+    value /= 10;
+  } while (value);
+  while (length) {
+    putChar(text[--length]);
+  }
+}
+
+static void putText(void (*putChar)(char), const char *text) {
+  while (*text) {
+    putChar(*text++);
+  }
+}
+
+/*!
+ *   @fn         dump
+ *
+ *   @brief      Envia as sondas com medições, uma por linha, a um canal de
+ *               depuração.
+ *
+ *   Formato: "nome: count=N mean=N\r\n", em ciclos do núcleo, com
+ *   " min=N max=N" antes do "\r\n" se MKL_PROFILER_MINMAX estiver definido.
+ *
+ *   @param[in]  putChar - envia um caractere (UART, semihosting, putchar).
+ */
+void mkl_Profiler::dump(void (*putChar)(char)) {
+  for (int i = 0; i < kProbes; i++) {
+    if (probes[i].count == 0) {
+      continue;
+    }
+    if (names[i]) {
+      putText(putChar, names[i]);
+    } else {
+      putText(putChar, "probe ");
+      putNumber(putChar, i);
+    }
+    putText(putChar, ": count=");
+    putNumber(putChar, probes[i].count);
+    putText(putChar, " mean=");
+    putNumber(putChar, readMean(i));
+#ifdef MKL_PROFILER_MINMAX
+    putText(putChar, " min=");
+    putNumber(putChar, probes[i].min);
+    putText(putChar, " max=");
+    putNumber(putChar, probes[i].max);
+#endif
+    putText(putChar, "\r\n");
+  }
+}
@@ -0,0 +1,173 @@
+/*!
+ * @copyright   © 2017 UFAM - Universidade Federal do Amazonas.
+ *
+ * @brief       Medição do tempo de execução de trechos de código com o SysTick.
+ *
+ * @file        mkl_Profiler.h
+ * @version     1.2
+ * @date        17 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   SysTick (System Timer).
+ *              +compiler     Kinetis® Design Studio IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão (data): Descrição breve.
+ *                             ++ 1.0 (17 Outubro 2026): Versão inicial.
+ *                             ++ 1.1 (17 Outubro 2026): Soma de 32 bits, mínimo e máximo opcionais e desconto sem underflow.
+ *                             ++ 1.2 (17 Outubro 2026): O SysTick pode ser compartilhado com o modo sem tick da mkl_PITTimerWheel.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas
+ *              +courses      Engenharia da Computação
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Versão inicial:
+ *                             ++ Patrick Chagas dos Santos <patrick.chagas@gmail.com>
+ *                             ++ Gabriel Montenegro Villacrez <gvmontenegro19@gmail.com>
+ *                             ++ Andrezza Bonfim <andrezzabonfiiim@gmail.com>
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ *              Este programa é um software livre; Você pode redistribuí-lo
+ *              e/ou modificá-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              versão 3 da licença, ou qualquer versão posterior.
+ *
+ *              Este programa é distribuído na esperança de que seja útil,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implícita de
+ *              COMERCIALIZAÇÃO OU USO PARA UM DETERMINADO PROPÓSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#ifndef MKL_PROFILER_H_
+#define MKL_PROFILER_H_
+
+#include <MKL25Z4.h>
+#include <stdint.h>
+
+/*!
+ *  Estatísticas de uma sonda, em ciclos do núcleo.
+ */
+typedef struct {
+  uint32_t count;  /*!< Número de medições. */
+  uint32_t total;  /*!< Soma das durações, para a média. */
+#ifdef MKL_PROFILER_MINMAX
+  uint32_t min;    /*!< Menor duração. */
+  uint32_t max;    /*!< Maior duração. */
+#endif
+} mkl_ProfilerProbe;
+
+/*!
+ *  @class    mkl_Profiler
+ *
+ *  @brief    Tabela estática de sondas de tempo de execução.
+ *
+ *  @details  O SysTick conta livremente os ciclos do núcleo (LOAD =
+ *            0xFFFFFF, CLKSOURCE = 1). Uma sonda lê o VAL na entrada e na
+ *            saída do trecho; a diferença, módulo 2^24, é acumulada na
+ *            tabela probes[], com a soma e o número de medições. A tabela fica em RAM, em endereço fixo: pode ser lida
+ *            pelo depurador, pelo simulador do host (mkl_HostSim) ou enviada
+ *            em texto por dump().
+ *
+ *            O SysTick está no barramento privado do núcleo, sem estados de
+ *            espera: a entrada da sonda é uma leitura (cerca de 4 ciclos com
+ *            a carga do endereço) e a saída, a leitura e a atualização de
+ *            dois contadores de 32 bits (cerca de 12 ciclos). O custo das
+ *            leituras medido em start() é descontado; um trecho mais curto
+ *            que ele conta como 0 ciclos.
+ *
+ *            Com MKL_PROFILER_MINMAX definido, a sonda guarda também o
+ *            mínimo e o máximo, ao custo de duas comparações e até duas
+ *            escritas a mais (cerca de 8 ciclos) por medição.
+ *
+ *            Trechos de até 2^24 ciclos (0,8 s a 20,97 MHz) são medidos
+ *            corretamente. A soma é de 32 bits: chame reset() antes de 2^32
+ *            ciclos medidos em uma sonda (3,4 minutos a 20,97 MHz). O tempo das interrupções atendidas dentro do
+ *            trecho entra na medição. O SysTick deixa de estar disponível
+ *            para outro uso; o modo sem tick da mkl_PITTimerWheel só lê o
+ *            VAL, com o SysTick programado da mesma forma, e pode rodar
+ *            junto.
+ *
+ *            Com MKL_PROFILER_DISABLED definido, mkl_ProfilerScope não gera
+ *            código.
+ *
+ *  @section  EXAMPLES USAGE
+ *
+ *             +fn enum { probe_pitIsr, probe_writeWord };
+ *             +fn mkl_Profiler::start();
+ *             +fn mkl_Profiler::setName(probe_pitIsr, "pit isr");
+ *             +fn { mkl_ProfilerScope scope(probe_pitIsr); ... }
+ *             +fn mkl_Profiler::dump(putChar);
+ */
+class mkl_Profiler {
+ public:
+  static const uint8_t kProbes = 8;
+
+  static void start();
+  static void reset();
+  static void setName(uint8_t probe, const char *name);
+  static uint32_t readMean(uint8_t probe);
+  static void dump(void (*putChar)(char));
+
+  /*!
+   *  Leitura do contador na entrada de um trecho.
+   */
+  static uint32_t readCounter() {
+    return SysTick->VAL;
+  }
+
+  /*!
+   *  Acumula a duração do trecho iniciado em begin (o SysTick é
+   *  decrescente).
+   */
+  static void record(uint8_t probe, uint32_t begin) {
+    uint32_t cycles = (begin - SysTick->VAL) & SysTick_VAL_CURRENT_Msk;
+    cycles = cycles > overhead ? cycles - overhead : 0;
+    mkl_ProfilerProbe &p = probes[probe];
+    p.count++;
+    p.total += cycles;
+#ifdef MKL_PROFILER_MINMAX
+    if (cycles < p.min) {
+      p.min = cycles;
+    }
+    if (cycles > p.max) {
+      p.max = cycles;
+    }
+#endif
+  }
+
+  static mkl_ProfilerProbe probes[kProbes];
+
+ private:
+  static uint32_t overhead;
+  static const char *names[kProbes];
+};
+
+/*!
+ *  @class    mkl_ProfilerScope
+ *
+ *  @brief    Sonda de escopo: mede do construtor ao destrutor.
+ */
+class mkl_ProfilerScope {
+ public:
+#ifndef MKL_PROFILER_DISABLED
+  explicit mkl_ProfilerScope(uint8_t probe)
+      : probe(probe), begin(mkl_Profiler::readCounter()) {}
+  ~mkl_ProfilerScope() {
+    mkl_Profiler::record(probe, begin);
+  }
+
+ private:
+  uint8_t probe;
+  uint32_t begin;
+#else
+  explicit mkl_ProfilerScope(uint8_t) {}
+#endif
+};
+
+#endif  //  MKL_PROFILER_H_
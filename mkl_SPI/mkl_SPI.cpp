@@ -0,0 +1,317 @@
+/*!
+ * @copyright   © 2017 UFAM - Universidade Federal do Amazonas.
+ *
+ * @brief       Implementação da API em C++ para o SPI no modo mestre.
+ *
+ * @file        mkl_SPI.cpp
+ * @version     1.3
+ * @date        17 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   SPI.
+ *              +compiler     Kinetis® Design Studio IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão (data): Descrição breve.
+ *                             ++ 1.0 (17 Outubro 2026): Versão inicial.
+ *                             ++ 1.1 (17 Outubro 2026): Saída do slave select (PCS0).
+ *                             ++ 1.2 (17 Outubro 2026): enableReceiveInterrupt/disableReceiveInterrupt: interrupção no fim de cada byte (SPIE).
+ *                             ++ 1.3 (17 Outubro 2026): Requisição de DMA do receptor (enableReceiveDMA).
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas
+ *              +courses      Engenharia da Computação
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Versão inicial:
+ *                             ++ Patrick Chagas dos Santos <patrick.chagas@gmail.com>
+ *                             ++ Gabriel Montenegro Villacrez <gvmontenegro19@gmail.com>
+ *                             ++ Andrezza Bonfim <andrezzabonfiiim@gmail.com>
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ *              Este programa é um software livre; Você pode redistribuí-lo
+ *              e/ou modificá-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              versão 3 da licença, ou qualquer versão posterior.
+ *
+ *              Este programa é distribuído na esperança de que seja útil,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implícita de
+ *              COMERCIALIZAÇÃO OU USO PARA UM DETERMINADO PROPÓSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include "mkl_SPI.h"
+
+/*!
+ *   @fn         mkl_SPI
+ *
+ *   @brief      Construtor padrão da classe.
+ *
+ *   O construtor associa o objeto ao SPI dos pinos, habilita o clock do SPI e
+ *   dos GPIOs, seleciona o mux dos pinos SCK e MOSI e habilita o SPI no modo
+ *   mestre, modo 0 (CPOL = 0, CPHA = 0), MSB primeiro e baud rate máximo
+ *   (clock do barramento / 2).
+ *
+ *   @param[in]  sck - pino de clock do SPI.
+ *   @param[in]  mosi - pino de saída de dados do mesmo SPI.
+ *
+ *   @remarks    Siglas e páginas do Manual de Referência KL25:
+ *               - SPIx_C1: SPI Control Register 1. Pág. 657.
+ *               - SPIx_C2: SPI Control Register 2. Pág. 658.
+ */
+mkl_SPI::mkl_SPI(spi_SCKPin sck, spi_MOSIPin mosi) {
+  uint8_t SPINumber = (sck >> 8) & 0x1;
+
+  enablePeripheralClock(SPINumber);
+  bindPeripheral(SPINumber);
+  setupPin(sck);
+  setupPin(mosi);
+
+  *addressSPIxC1 = SPI_C1_MSTR_MASK;
+  *addressSPIxC2 = 0;
+  setBaudRate(spi_prescaler1, spi_div2);
+  enableSPI();
+}
+
+/*!
+ *   @fn         setBaudRate
+ *
+ *   @brief      Ajusta o baud rate do SPI.
+ *
+ *   Baud rate = clock do barramento / (prescaler * divisor).
+ *
+ *   @remarks    Siglas e páginas do Manual de Referência KL25:
+ *               - SPIx_BR: SPI Baud Rate Register. Pág. 660.
+ */
+void mkl_SPI::setBaudRate(spi_Prescaler prescaler, spi_Div divisor) {
+  *addressSPIxBR = SPI_BR_SPPR(prescaler) | SPI_BR_SPR(divisor);
+}
+
+/*!
+ *   @fn         setClockMode
+ *
+ *   @brief      Seleciona a polaridade e a fase do clock.
+ *
+ *   @remarks    Siglas e páginas do Manual de Referência KL25:
+ *               - SPIx_C1: SPI Control Register 1. Pág. 657.
+ */
+void mkl_SPI::setClockMode(spi_ClockMode mode) {
+  *addressSPIxC1 = (*addressSPIxC1 & ~(SPI_C1_CPOL_MASK | SPI_C1_CPHA_MASK))
+                   | mode;
+}
+
+/*!
+ *   @fn         enableSPI
+ *
+ *   @brief      Habilita o SPI.
+ */
+void mkl_SPI::enableSPI() {
+  *addressSPIxC1 |= SPI_C1_SPE_MASK;
+}
+
+/*!
+ *   @fn         disableSPI
+ *
+ *   @brief      Desabilita o SPI, descartando a transmissão em curso.
+ */
+void mkl_SPI::disableSPI() {
+  *addressSPIxC1 &= ~SPI_C1_SPE_MASK;
+}
+
+/*!
+ *   @fn         enableSlaveSelectOutput
+ *
+ *   @brief      Habilita a saída automática do slave select no pino PCS0.
+ *
+ *   O pino vai a '0' no início de cada byte e volta a '1' ao fim do
+ *   deslocamento, ou seja, gera uma borda de subida a cada byte transmitido.
+ *
+ *   @param[in]  pcs - pino de slave select do mesmo SPI.
+ *
+ *   @remarks    Siglas e páginas do Manual de Referência KL25:
+ *               - SPIx_C1: SPI Control Register 1. Pág. 657.
+ *               - SPIx_C2: SPI Control Register 2. Pág. 658.
+ */
+void mkl_SPI::enableSlaveSelectOutput(spi_PCSPin pcs) {
+  setupPin(pcs);
+  *addressSPIxC2 |= SPI_C2_MODFEN_MASK;
+  *addressSPIxC1 |= SPI_C1_SSOE_MASK;
+}
+
+/*!
+ *   @fn         enableTransmitDMA
+ *
+ *   @brief      Habilita as requisições de DMA com o buffer de transmissão
+ *               vazio (SPTEF).
+ *
+ *   @remarks    Siglas e páginas do Manual de Referência KL25:
+ *               - SPIx_C2: SPI Control Register 2. Pág. 658.
+ */
+void mkl_SPI::enableTransmitDMA() {
+  *addressSPIxC2 |= SPI_C2_TXDMAE_MASK;
+}
+
+/*!
+ *   @fn         enableReceiveDMA
+ *
+ *   @brief      Habilita as requisições de DMA com um byte recebido (SPRF).
+ *
+ *   A leitura do SPIx_D pelo DMA limpa o SPRF. Como o SPRF só sobe com o
+ *   fim do deslocamento, o fim do bloco do receptor marca o último bit
+ *   enviado.
+ *
+ *   @remarks    Siglas e páginas do Manual de Referência KL25:
+ *               - SPIx_C2: SPI Control Register 2. Pág. 658.
+ */
+void mkl_SPI::enableReceiveDMA() {
+  *addressSPIxC2 |= SPI_C2_RXDMAE_MASK;
+}
+
+/*!
+ *   @fn         enableReceiveInterrupt
+ *
+ *   @brief      Habilita a interrupção do SPI ao fim do deslocamento de
+ *               cada byte (SPRF) e a linha SPIx_IRQn no NVIC.
+ *
+ *   A rotina SPIx_IRQHandler deve ler o byte recebido (readData), o que
+ *   limpa o SPRF.
+ *
+ *   @remarks    Siglas e páginas do Manual de Referência KL25:
+ *               - SPIx_C1: SPI Control Register 1. Pág. 657.
+ */
+void mkl_SPI::enableReceiveInterrupt() {
+  uint32_t SPINumber =
+      (reinterpret_cast<uintptr_t>(addressSPIxC1) - SPI0_BASE) >> 12;
+  NVIC_EnableIRQ(static_cast<IRQn_Type>(SPI0_IRQn + SPINumber));
+  *addressSPIxC1 |= SPI_C1_SPIE_MASK;
+}
+
+/*!
+ *   @fn         disableReceiveInterrupt
+ *
+ *   @brief      Desabilita a interrupção do fim de cada byte (SPRF).
+ */
+void mkl_SPI::disableReceiveInterrupt() {
+  *addressSPIxC1 &= ~SPI_C1_SPIE_MASK;
+}
+
+/*!
+ *   @fn         dataRegister
+ *
+ *   @brief      Retorna o endereço do registrador de dados, destino das
+ *               transferências de DMA.
+ */
+volatile uint8_t *mkl_SPI::dataRegister() {
+  return addressSPIxD;
+}
+
+/*!
+ *   @fn         writeData
+ *
+ *   @brief      Escreve um byte no buffer de transmissão.
+ *
+ *   Aguarda o buffer de transmissão ficar vazio (SPTEF) e escreve o byte no
+ *   registrador D.
+ *
+ *   @remarks    Siglas e páginas do Manual de Referência KL25:
+ *               - SPIx_S: SPI Status Register. Pág. 661.
+ *               - SPIx_D: SPI Data Register. Pág. 663.
+ */
+void mkl_SPI::writeData(uint8_t data) {
+  while (!(*addressSPIxS & SPI_S_SPTEF_MASK)) {
+  }
+  *addressSPIxD = data;
+}
+
+/*!
+ *   @fn         readData
+ *
+ *   @brief      Lê o byte recebido.
+ *
+ *   Aguarda o fim do deslocamento de um byte (SPRF) e lê o registrador D,
+ *   o que limpa o SPRF.
+ *
+ *   @return     O byte recebido no MISO.
+ *
+ *   @remarks    Siglas e páginas do Manual de Referência KL25:
+ *               - SPIx_S: SPI Status Register. Pág. 661.
+ *               - SPIx_D: SPI Data Register. Pág. 663.
+ */
+uint8_t mkl_SPI::readData() {
+  while (!(*addressSPIxS & SPI_S_SPRF_MASK)) {
+  }
+  return *addressSPIxD;
+}
+
+/*!
+ *   @fn         isTransmitBufferEmpty
+ *
+ *   @brief      Verifica se o buffer de transmissão aceita um novo byte.
+ */
+bool mkl_SPI::isTransmitBufferEmpty() {
+  return (*addressSPIxS & SPI_S_SPTEF_MASK) != 0;
+}
+
+/*!
+ *   @fn         isReceiveBufferFull
+ *
+ *   @brief      Verifica se há um byte recebido a ser lido.
+ */
+bool mkl_SPI::isReceiveBufferFull() {
+  return (*addressSPIxS & SPI_S_SPRF_MASK) != 0;
+}
+
+/*!
+ *   @fn         bindPeripheral
+ *
+ *   @brief      Associa o objeto de software ao periférico de hardware.
+ *
+ *   SPI0 = 0x40076000 e SPI1 = 0x40077000.
+ */
+void mkl_SPI::bindPeripheral(uint8_t SPINumber) {
+  uint32_t baseAddress = SPI0_BASE + 0x1000*SPINumber;
+
+  addressSPIxC1 = (volatile uint8_t *)(baseAddress + 0x0);
+  addressSPIxC2 = (volatile uint8_t *)(baseAddress + 0x1);
+  addressSPIxBR = (volatile uint8_t *)(baseAddress + 0x2);
+  addressSPIxS = (volatile uint8_t *)(baseAddress + 0x3);
+  addressSPIxD = (volatile uint8_t *)(baseAddress + 0x5);
+}
+
+/*!
+ *   @fn         enablePeripheralClock
+ *
+ *   @brief      Habilita o clock do SPI.
+ *
+ *   @remarks    Siglas e páginas do Manual de Referência KL25:
+ *               - SIM_SCGC4: System Clock Gating Control Register 4. Pág. 204.
+ */
+void mkl_SPI::enablePeripheralClock(uint8_t SPINumber) {
+  SIM_SCGC4 |= SIM_SCGC4_SPI0_MASK << SPINumber;
+}
+
+/*!
+ *   @fn         setupPin
+ *
+ *   @brief      Habilita o clock do GPIO do pino e seleciona o seu mux.
+ *
+ *   @param[in]  pin - pino codificado como spi_SCKPin, spi_MOSIPin ou
+ *               spi_PCSPin.
+ *
+ *   @remarks    Siglas e páginas do Manual de Referência KL25:
+ *               - PortxPCRn: Pin Control Register. Pág. 183.
+ */
+void mkl_SPI::setupPin(uint32_t pin) {
+  uint8_t pinNumber = pin & 0x1F;
+  uint8_t GPIONumber = (pin >> 5) & 0x7;
+  uint8_t muxAlt = (pin >> 9) & 0x7;
+
+  SIM_SCGC5 |= SIM_SCGC5_PORTA_MASK << GPIONumber;
+  *(volatile uint32_t *)(PORTA_BASE + 0x1000*GPIONumber + 4*pinNumber) =
+      PORT_PCR_MUX(muxAlt);
+}
@@ -0,0 +1,229 @@
+/*!
+ * @copyright   © 2017 UFAM - Universidade Federal do Amazonas.
+ *
+ * @brief       Interface de programação de aplicações em C++ para o SPI no modo mestre.
+ *
+ * @file        mkl_SPI.h
+ * @version     1.3
+ * @date        17 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   SPI.
+ *              +compiler     Kinetis® Design Studio IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão (data): Descrição breve.
+ *                             ++ 1.0 (17 Outubro 2026): Versão inicial.
+ *                             ++ 1.1 (17 Outubro 2026): Saída do slave select (PCS0).
+ *                             ++ 1.2 (17 Outubro 2026): enableReceiveInterrupt/disableReceiveInterrupt (SPIE).
+ *                             ++ 1.3 (17 Outubro 2026): Requisição de DMA do receptor (enableReceiveDMA).
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas
+ *              +courses      Engenharia da Computação
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Versão inicial:
+ *                             ++ Patrick Chagas dos Santos <patrick.chagas@gmail.com>
+ *                             ++ Gabriel Montenegro Villacrez <gvmontenegro19@gmail.com>
+ *                             ++ Andrezza Bonfim <andrezzabonfiiim@gmail.com>
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ *              Este programa é um software livre; Você pode redistribuí-lo
+ *              e/ou modificá-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              versão 3 da licença, ou qualquer versão posterior.
+ *
+ *              Este programa é distribuído na esperança de que seja útil,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implícita de
+ *              COMERCIALIZAÇÃO OU USO PARA UM DETERMINADO PROPÓSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#ifndef MKL_SPI_H_
+#define MKL_SPI_H_
+
+#include <MKL25Z4.h>
+#include <stdint.h>
+
+/*!
+ * Enum associado à mascara do GPIO, SPI e alternativa do mux PCR.
+ */
+typedef enum {
+  spi_GPIOA = 0,
+  spi_GPIOB = 1 << 5,
+  spi_GPIOC = 2 << 5,
+  spi_GPIOD = 3 << 5,
+  spi_GPIOE = 4 << 5
+}spi_GPIOMask;
+
+typedef enum {
+  spi_SPI0 = 0,
+  spi_SPI1 = 1 << 8
+}spi_SPINumberMask;
+
+typedef enum {
+  spi_muxAlt2 = 2 << 9,
+  spi_muxAlt5 = 5 << 9
+}spi_muxAltMask;
+
+/*!
+ * Enum associado aos pinos de clock (SCK) do SPI.
+ */
+typedef enum {
+  spi_SCK_PTA15 = 15|spi_GPIOA|spi_SPI0|spi_muxAlt2,
+  spi_SCK_PTC5 = 5|spi_GPIOC|spi_SPI0|spi_muxAlt2,
+  spi_SCK_PTD1 = 1|spi_GPIOD|spi_SPI0|spi_muxAlt2,
+  spi_SCK_PTB11 = 11|spi_GPIOB|spi_SPI1|spi_muxAlt2,
+  spi_SCK_PTD5 = 5|spi_GPIOD|spi_SPI1|spi_muxAlt2,
+  spi_SCK_PTE2 = 2|spi_GPIOE|spi_SPI1|spi_muxAlt2
+}spi_SCKPin;
+
+/*!
+ * Enum associado aos pinos de saída de dados (MOSI) do SPI.
+ */
+typedef enum {
+  spi_MOSI_PTA16 = 16|spi_GPIOA|spi_SPI0|spi_muxAlt2,
+  spi_MOSI_PTA17 = 17|spi_GPIOA|spi_SPI0|spi_muxAlt5,
+  spi_MOSI_PTC6 = 6|spi_GPIOC|spi_SPI0|spi_muxAlt2,
+  spi_MOSI_PTC7 = 7|spi_GPIOC|spi_SPI0|spi_muxAlt5,
+  spi_MOSI_PTD2 = 2|spi_GPIOD|spi_SPI0|spi_muxAlt2,
+  spi_MOSI_PTD3 = 3|spi_GPIOD|spi_SPI0|spi_muxAlt5,
+  spi_MOSI_PTB16 = 16|spi_GPIOB|spi_SPI1|spi_muxAlt2,
+  spi_MOSI_PTB17 = 17|spi_GPIOB|spi_SPI1|spi_muxAlt5,
+  spi_MOSI_PTD6 = 6|spi_GPIOD|spi_SPI1|spi_muxAlt2,
+  spi_MOSI_PTD7 = 7|spi_GPIOD|spi_SPI1|spi_muxAlt5,
+  spi_MOSI_PTE1 = 1|spi_GPIOE|spi_SPI1|spi_muxAlt2,
+  spi_MOSI_PTE3 = 3|spi_GPIOE|spi_SPI1|spi_muxAlt5
+}spi_MOSIPin;
+
+/*!
+ * Enum associado aos pinos de slave select (PCS0) do SPI.
+ */
+typedef enum {
+  spi_PCS_PTA14 = 14|spi_GPIOA|spi_SPI0|spi_muxAlt2,
+  spi_PCS_PTC4 = 4|spi_GPIOC|spi_SPI0|spi_muxAlt2,
+  spi_PCS_PTD0 = 0|spi_GPIOD|spi_SPI0|spi_muxAlt2,
+  spi_PCS_PTB10 = 10|spi_GPIOB|spi_SPI1|spi_muxAlt2,
+  spi_PCS_PTD4 = 4|spi_GPIOD|spi_SPI1|spi_muxAlt2,
+  spi_PCS_PTE4 = 4|spi_GPIOE|spi_SPI1|spi_muxAlt2
+}spi_PCSPin;
+
+/*!
+ * Enum associado ao pré-divisor (SPPR) do baud rate.
+ */
+typedef enum {
+  spi_prescaler1 = 0,
+  spi_prescaler2,
+  spi_prescaler3,
+  spi_prescaler4,
+  spi_prescaler5,
+  spi_prescaler6,
+  spi_prescaler7,
+  spi_prescaler8
+}spi_Prescaler;
+
+/*!
+ * Enum associado ao divisor (SPR) do baud rate.
+ */
+typedef enum {
+  spi_div2 = 0,
+  spi_div4,
+  spi_div8,
+  spi_div16,
+  spi_div32,
+  spi_div64,
+  spi_div128,
+  spi_div256,
+  spi_div512
+}spi_Div;
+
+/*!
+ * Enum associado à polaridade (CPOL) e à fase (CPHA) do clock.
+ */
+typedef enum {
+  spi_mode0 = 0,
+  spi_mode1 = SPI_C1_CPHA_MASK,
+  spi_mode2 = SPI_C1_CPOL_MASK,
+  spi_mode3 = SPI_C1_CPOL_MASK | SPI_C1_CPHA_MASK
+}spi_ClockMode;
+
+/*!
+ *  @class    mkl_SPI
+ *
+ *  @brief    A classe implementa o periférico SPI no modo mestre.
+ *
+ *  @details  Esta classe usa os periféricos on-chip SPI0 ou SPI1, de 8 bits,
+ *            apenas para transmissão (pinos SCK e MOSI). O byte recebido no
+ *            MISO, mesmo desconectado, é descartado com readData().
+ *
+ *            Baud rate = clock do barramento / (prescaler * divisor).
+ *
+ *  @section  EXAMPLES USAGE
+ *
+ *            Declaração e configuração.
+ *             +fn mkl_SPI spi(spi_SCK_PTC5, spi_MOSI_PTC7);
+ *             +fn spi.setBaudRate(spi_prescaler1, spi_div2);
+ *             +fn spi.setClockMode(spi_mode0);
+ *
+ *            Transmissão de um byte.
+ *             +fn spi.writeData(0xC0);
+ *             +fn spi.readData();
+ *            Transmissão por interrupção, um byte por SPRF.
+ *             +fn spi.enableReceiveInterrupt();
+ *             +fn spi.writeData(0xC0);
+ *             +fn void SPI0_IRQHandler() { spi.readData(); ... }
+ */
+class mkl_SPI {
+ public:
+  /*!
+   * Construtor padrão da classe.
+   */
+  mkl_SPI(spi_SCKPin sck, spi_MOSIPin mosi);
+
+  /*!
+   * Métodos de configuração do periférico.
+   */
+  void setBaudRate(spi_Prescaler prescaler, spi_Div divisor);
+  void setClockMode(spi_ClockMode mode);
+  void enableSPI();
+  void disableSPI();
+  void enableSlaveSelectOutput(spi_PCSPin pcs);
+  void enableTransmitDMA();
+  void enableReceiveDMA();
+  void enableReceiveInterrupt();
+  void disableReceiveInterrupt();
+  volatile uint8_t *dataRegister();
+
+  /*!
+   * Métodos de transmissão e recepção.
+   */
+  void writeData(uint8_t data);
+  uint8_t readData();
+  bool isTransmitBufferEmpty();
+  bool isReceiveBufferFull();
+
+ protected:
+  /*!
+   * Endereços dos registradores associados ao periférico SPI.
+   */
+  volatile uint8_t *addressSPIxC1;
+  volatile uint8_t *addressSPIxC2;
+  volatile uint8_t *addressSPIxBR;
+  volatile uint8_t *addressSPIxS;
+  volatile uint8_t *addressSPIxD;
+
+  /*!
+   * Métodos de inicialização do periférico e dos pinos.
+   */
+  void bindPeripheral(uint8_t SPINumber);
+  void enablePeripheralClock(uint8_t SPINumber);
+  void setupPin(uint32_t pin);
+};
+
+#endif  //  MKL_SPI_H_
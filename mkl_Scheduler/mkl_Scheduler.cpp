@@ -0,0 +1,163 @@
+/*!
+ * @copyright   © 2017 UFAM - Universidade Federal do Amazonas.
+ *
+ * @brief       Escalonador cooperativo de tarefas, executadas até o fim, com filas por prioridade.
+ *
+ * @file        mkl_Scheduler.cpp
+ * @version     1.0
+ * @date        17 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   Núcleo Cortex-M0+ (PRIMASK e WFI).
+ *              +compiler     Kinetis® Design Studio IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão (data): Descrição breve.
+ *                             ++ 1.0 (17 Outubro 2026): Versão inicial.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas
+ *              +courses      Engenharia da Computação
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Versão inicial:
+ *                             ++ Patrick Chagas dos Santos <patrick.chagas@gmail.com>
+ *                             ++ Gabriel Montenegro Villacrez <gvmontenegro19@gmail.com>
+ *                             ++ Andrezza Bonfim <andrezzabonfiiim@gmail.com>
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ *              Este programa é um software livre; Você pode redistribuí-lo
+ *              e/ou modificá-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              versão 3 da licença, ou qualquer versão posterior.
+ *
+ *              Este programa é distribuído na esperança de que seja útil,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implícita de
+ *              COMERCIALIZAÇÃO OU USO PARA UM DETERMINADO PROPÓSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include "mkl_Scheduler.h"
+#include <MKL25Z4.h>
+
+mkl_Task *mkl_Scheduler::queues[mkl_Scheduler::kPriorities];
+volatile uint8_t mkl_Scheduler::ready[mkl_Scheduler::kPriorities];
+
+/*!
+ *   @fn         mkl_Task
+ *
+ *   @brief      Associa a rotina, o contexto e a prioridade da tarefa.
+ */
+mkl_Task::mkl_Task(mkl_TaskFunction function, void *context,
+                   task_Priority priority)
+    : function(function), context(context), priority(priority), next(0),
+      posted(0) {
+}
+
+/*!
+ *   @fn         post
+ *
+ *   @brief      Marca a tarefa para execução. Pode ser chamado nas
+ *               interrupções.
+ *
+ *   A tarefa é marcada antes da prioridade: quando o laço vê o indicador
+ *   da prioridade, a marca da tarefa já está escrita.
+ */
+void mkl_Task::post() {
+  posted = 1;
+  mkl_Scheduler::ready[priority] = 1;
+}
+
+/*!
+ *   @fn         addTask
+ *
+ *   @brief      Coloca a tarefa no fim da fila da sua prioridade.
+ *
+ *   Chame antes de run(): as filas não são protegidas das interrupções,
+ *   só os indicadores.
+ */
+void mkl_Scheduler::addTask(mkl_Task &task) {
+  mkl_Task **link = &queues[task.priority];
+  while (*link) {
+    link = &(*link)->next;
+  }
+  task.next = 0;
+  *link = &task;
+  if (task.posted) {
+    ready[task.priority] = 1;
+  }
+}
+
+/*!
+ *   @fn         postTask
+ *
+ *   @brief      Posta a tarefa apontada por "task" (mkl_TimerCallback).
+ */
+void mkl_Scheduler::postTask(void *task) {
+  static_cast<mkl_Task *>(task)->post();
+}
+
+/*!
+ *   @fn         runOnce
+ *
+ *   @brief      Executa a tarefa postada de maior prioridade.
+ *
+ *   @return     false se não havia tarefa postada.
+ *
+ *   O indicador é religado após a tarefa, pois outra tarefa da mesma
+ *   prioridade pode estar postada mais adiante na fila.
+ */
+bool mkl_Scheduler::runOnce() {
+  for (uint8_t p = 0; p < kPriorities; p++) {
+    if (!ready[p]) {
+      continue;
+    }
+    ready[p] = 0;
+    for (mkl_Task *task = queues[p]; task; task = task->next) {
+      if (task->posted) {
+        task->posted = 0;
+        task->function(task->context);
+        ready[p] = 1;
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+/*!
+ *   @fn         idle
+ *
+ *   @brief      Dorme (WFI) até a próxima interrupção, se não houver
+ *               tarefa pronta.
+ */
+void mkl_Scheduler::idle() {
+  __disable_irq();
+  uint8_t pending = 0;
+  for (uint8_t p = 0; p < kPriorities; p++) {
+    pending |= ready[p];
+  }
+  if (!pending) {
+    __WFI();
+  }
+  __enable_irq();
+}
+
+/*!
+ *   @fn         run
+ *
+ *   @brief      Laço principal: executa as tarefas e dorme sem trabalho.
+ *               Não retorna.
+ */
+void mkl_Scheduler::run() {
+  while (true) {
+    while (runOnce()) {
+    }
+    idle();
+  }
+}
@@ -0,0 +1,141 @@
+/*!
+ * @copyright   © 2017 UFAM - Universidade Federal do Amazonas.
+ *
+ * @brief       Escalonador cooperativo de tarefas, executadas até o fim, com filas por prioridade.
+ *
+ * @file        mkl_Scheduler.h
+ * @version     1.0
+ * @date        17 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   Núcleo Cortex-M0+ (PRIMASK e WFI).
+ *              +compiler     Kinetis® Design Studio IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão (data): Descrição breve.
+ *                             ++ 1.0 (17 Outubro 2026): Versão inicial.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas
+ *              +courses      Engenharia da Computação
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Versão inicial:
+ *                             ++ Patrick Chagas dos Santos <patrick.chagas@gmail.com>
+ *                             ++ Gabriel Montenegro Villacrez <gvmontenegro19@gmail.com>
+ *                             ++ Andrezza Bonfim <andrezzabonfiiim@gmail.com>
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ *              Este programa é um software livre; Você pode redistribuí-lo
+ *              e/ou modificá-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              versão 3 da licença, ou qualquer versão posterior.
+ *
+ *              Este programa é distribuído na esperança de que seja útil,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implícita de
+ *              COMERCIALIZAÇÃO OU USO PARA UM DETERMINADO PROPÓSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#ifndef MKL_SCHEDULER_H_
+#define MKL_SCHEDULER_H_
+
+#include <stdint.h>
+
+/*!
+ *  Rotina de uma tarefa: executa até o fim, sem bloquear.
+ */
+typedef void (*mkl_TaskFunction)(void *context);
+
+/*!
+ *  Prioridades das tarefas, da maior para a menor.
+ */
+typedef enum {
+  task_high = 0,
+  task_normal = 1,
+  task_low = 2
+} task_Priority;
+
+/*!
+ *  @class    mkl_Task
+ *
+ *  @brief    Tarefa do mkl_Scheduler: uma rotina, o contexto dela e a
+ *            prioridade.
+ *
+ *  @details  O objeto é o próprio nó da fila (sem alocação) e deve existir
+ *            enquanto estiver no escalonador. Uma tarefa postada várias
+ *            vezes antes de executar roda uma só vez.
+ */
+class mkl_Task {
+ public:
+  mkl_Task(mkl_TaskFunction function, void *context, task_Priority priority);
+  void post();
+  bool isPosted() const { return posted != 0; }
+
+ private:
+  friend class mkl_Scheduler;
+  mkl_TaskFunction function;
+  void *context;
+  task_Priority priority;
+  mkl_Task *next;
+  volatile uint8_t posted;
+};
+
+/*!
+ *  @class    mkl_Scheduler
+ *
+ *  @brief    Escalonador cooperativo: executa as tarefas postadas, da maior
+ *            para a menor prioridade, e dorme (WFI) quando não há nenhuma.
+ *
+ *  @details  Cada prioridade tem a sua fila de tarefas e um indicador de
+ *            tarefa pronta. A postagem (mkl_Task::post) é livre de trava:
+ *            apenas dois stores de byte, primeiro o da tarefa e depois o da
+ *            prioridade, e pode ser feita nas rotinas de serviço de
+ *            interrupção (PIT, GPIO) e nas próprias tarefas. O Cortex-M0+ não
+ *            tem LDREX/STREX; os stores de byte são atômicos, e nenhum
+ *            indicador precisa de leitura-modificação-escrita.
+ *
+ *            O laço limpa o indicador da prioridade antes de percorrer a
+ *            fila: uma postagem feita durante a varredura volta a ligá-lo e
+ *            não se perde. Após cada tarefa, a busca recomeça pela maior
+ *            prioridade, então uma tarefa urgente postada por uma
+ *            interrupção espera no máximo o fim da tarefa em curso.
+ *
+ *            Sem tarefas prontas, o laço desabilita as interrupções, confere
+ *            os indicadores de novo e executa o WFI: a interrupção que chega
+ *            entre a conferência e o WFI acorda o núcleo mesmo com o PRIMASK
+ *            ligado e é atendida ao reabilitá-las.
+ *
+ *            postTask tem a assinatura de mkl_TimerCallback: um
+ *            mkl_SoftTimer pode postar uma tarefa no estouro.
+ *
+ *  @section  EXAMPLES USAGE
+ *
+ *             +fn mkl_Task keyTask(readKeys, 0, task_high);
+ *             +fn mkl_Scheduler::addTask(keyTask);
+ *             +fn timer.setCallback(mkl_Scheduler::postTask, &keyTask);
+ *             +fn void PORTA_IRQHandler() { keyTask.post(); }
+ *             +fn mkl_Scheduler::run();
+ */
+class mkl_Scheduler {
+ public:
+  static const uint8_t kPriorities = 3;
+
+  static void addTask(mkl_Task &task);
+  static void postTask(void *task);
+  static bool runOnce();
+  static void idle();
+  static void run();
+
+ private:
+  friend class mkl_Task;
+  static mkl_Task *queues[kPriorities];
+  static volatile uint8_t ready[kPriorities];
+};
+
+#endif  //  MKL_SCHEDULER_H_
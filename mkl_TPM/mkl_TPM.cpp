@@ -1,194 +1,235 @@
-/*!
- * @copyright   GNU General Public License (GNU GPL)
- *
- * @brief       Implementao da classe me "mkl_TPM".
- *
- * @file        mkl_TPM.cpp
- * @version     1.0
- * @date        02 Agosto 2017
- *
- * @section     HARDWARES & SOFTWARES
- *              +board        FRDM-KL25Z da NXP.
- *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
- *              +compiler     Kinetis Design Studio IDE.
- *              +manual       L25P80M48SF0RM, Rev.3, September 2012.
- *              +revisions    Verso (data): Descrio breve.
- *                             ++ 1.0 (02 Agosto 2017): Verso inicial.
- *
- * @section     AUTHORS & DEVELOPERS
- *              +institution  Universidade Federal do Amazonas.
- *              +courses      Engenharia da Computao / Engenharia Eltrica.
- *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
- *              +student      Verso inicial:
- *                             ++ Hamilton Nascimento <hdan_neto@hotmail.com>
- *
- * @section     LICENSE
- *
- *              GNU General Public License (GNU GPL).
- *
- *              Este programa  um software livre; Voc pode redistribu-lo
- *              e/ou modific-lo de acordo com os termos do "GNU General Public
- *              License" como publicado pela Free Software Foundation; Seja a
- *              verso 3 da licena, ou qualquer verso posterior.
- *
- *              Este programa  distribudo na esperana de que seja til,
- *              mas SEM QUALQUER GARANTIA; Sem a garantia implcita de
- *              COMERCIALIZAO OU USO PARA UM DETERMINADO PROPSITO.
- *              Veja o site da "GNU General Public License" para mais detalhes.
- *
- * @htmlonly    http://www.gnu.org/copyleft/gpl.html
- */
-#include "mkl_TPM.h"
-
-/*!
- *   @fn         bindPeripheral
- *
- *   @brief      Associa o objeto de software ao perifrico de hardware.
- *
- *   Este mtodo associa ao objeto de software o perifrico de hardware,
- *   utilizando a inicializao dos ponteiros para os endereos de memria
- *   dos registradores correspondentes.
- *
- *   @param[in]  baseAddress - o endereo base do perifrico TPM.
- *
- *   @remarks    Sigla e pagina do Manual de Referencia KL25:
- *               - TPMxSC: Status Control Register. Pg. 552.
- *               - TPMxCNT: Counter Register. Pg.554.
- *               - TPMxMOD: Modulo Register. Pg. 554.
- */
-
-void mkl_TPM::bindPeripheral(uint8_t *baseAddress) {
-  addressTPMxSC = (volatile uint32_t *)(baseAddress);
-  addressTPMxCNT = (volatile uint32_t *)(baseAddress + 0x4);
-  addressTPMxMOD = (volatile uint32_t *)(baseAddress + 0x8);
-}
-
-/*!
- *   @fn         bindChannel
- *
- *   @brief      Associa o canal do objeto de software ao hardware
- *
- *   Este mtodo associa os atributos do canal do objeto de software ao
- *   seu correspondente do perifrico hardware.
- *
- *   @param[in]  baseAddress - o endereo base do perifrico TPM.
- *               chnNumber - o nmero do canal do perifrico TPM.
- *
- *   @remarks    Sigla e pagina do Manual de Referencia KL25:
- *               - TPMxCnV: Channel Value Register. Pg.557.
- *               - TPMxCnSC: Channel Status Control Register. Pg.555.
- */
-void mkl_TPM::bindChannel(uint8_t *baseAddress,
-                                        uint8_t chnNumber) {
-  addressTPMxCnV = (volatile uint32_t *)(baseAddress + 0x10 + 8*chnNumber);
-  addressTPMxCnSC = (volatile uint32_t *)(baseAddress + 0xC + 8*chnNumber);
-}
-
- /*!
-  *   @fn         bindPin
-  *
-  *   @brief      Associa o pino do objeto ao perifrico de hardare.
-  *
-  *   Este mtodo associa o pino do objeto de software ao pino do perifrico.
-  *
-  *   @param[in]  pinNumber - o nmero do pino do objeto de software.
-  *
-  *   @remarks    Sigla e pagina do Manual de Referencia KL25:
-  *               - PCR: Pin Control Register. Pg.183.
-  */
-void mkl_TPM::bindPin(uint8_t GPIONumber, uint8_t pinNumber) {
-  addressPortxPCRn = (volatile uint32_t *)(0x40049000
-                                          + 0x1000*GPIONumber + 4*pinNumber);
-}
-
-/*!
- *   @fn         enablePeripheralClock
- *
- *   @brief      Habilita o clock do perifrico de hardware.
- *
- *   Este mtodo habilita o clock do perifrico TPM solicitado.
- *
- *   @remarks    Sigla e pagina do Manual de Referencia KL25:
- *               - SCGC6: System Control Gating Clock Register 6. Pg.207.
- *               - SOPT2: System Options Register 2. Pg.195.
- */
-void mkl_TPM::enablePeripheralClock(uint8_t TPMNumber) {
-  SIM_SCGC6 |= SIM_SCGC6_TPM0_MASK << TPMNumber;
-  SIM_SOPT2 |= SIM_SOPT2_TPMSRC(1);
-}
-
-/*!
- *   @fn         enableGPIOClock
- *
- *   @brief      Habilita o clock do GPIO do pino.
- *
- *   Este mtodo habilita o clock do perifrico GPIO do pino passado por
- *   parmetro.
- *
- *   @param[in]  GPIONumber - o nmero do GPIO correspondente ao pino.
- *
- *   @remarks    Sigla e pagina do Manual de Referencia KL25:
- *               - SCGC5: System Control Gating Clock Register 5. Pg.199.
- */
-void mkl_TPM::enableGPIOClock(uint8_t GPIONumber) {
-  SIM_SCGC5 |= SIM_SCGC5_PORTA_MASK << GPIONumber;
-}
-
-/*!
- *   @fn         selectMuxAlternative
- *
- *   @brief      Seleciona a alternativa de trabalho do pino.
- *
- *   Este mtodo seleciona o modo de operao do pino correspondente para o
- *   modo de operao TPM.
- *
- *   @param[in]  muxAlt - alternativa de operao do pino para o canal e TPM
- *                        especificados.
- *
- *   @remarks    Sigla e pagina do Manual de Referencia KL25:
- *               - PCR: Pin Control Register. Pg.183.
- */
-void mkl_TPM::selectMuxAlternative(uint8_t muxAlt) {
-  *addressPortxPCRn = PORT_PCR_MUX(muxAlt);
-}
-
-/*!
- *   @fn         setTPMParameters
- *
- *   @brief      Ajusta os parmetros do TPM.
- *
- *   Este mtodo ajusta os parmetros do TPM (nmeros de pino, GPIO,
- *   canal, TPM) e a mscara de seleo do mux, de acordo com o membro
- *   da enum passado no construtor da classe filha.
- *
- *   @param[in]  pin - pino passado para o construtor da classe filha.
- *               pinNumber - nmero do pino.
- *               GPIONumber - nmero do GPIO.
- *               chnNumber - nmero do canal.
- *               TPMNumber - nmero do TPM.
- *               muxAltMask - mscara de seleo do mux.
- */
-void mkl_TPM::setTPMParameters(tpm_Pin pin, uint8_t &pinNumber,
-                                   uint8_t &GPIONumber, uint8_t &chnNumber,
-                                   uint8_t &TPMNumber, uint8_t &muxAltMask) {
-  pinNumber = pin & 0x1F;
-  GPIONumber = (pin >> 5) & 0x7;
-  chnNumber = (pin >> 8) & 0x7;
-  TPMNumber = (pin >> 11) & 0x3;
-  muxAltMask = (pin >> 13) & 0x7;
-}
-
-/*!
- *   @fn         setBaseAddress
- *
- *   @brief      Ajusta o endereo base do TPM.
- *
- *   Este mtodo ajusta o endereo base do TPM a partir do nmero do
- *   TPM.
- *
- *   @param[in]  TPMNumber - nmero do TPM.
- *               baseAddress - ponteiro para o endereo base do TPM.
- */
-void mkl_TPM::setBaseAddress (uint8_t TPMNumber, uint8_t **baseAddress) {
-  *baseAddress = (uint8_t *)(TPM0_BASE + 0x1000*TPMNumber);
-}
+/*!
+ * @copyright   GNU General Public License (GNU GPL)
+ *
+ * @brief       Implementação da classe mãe "mkl_TPM".
+ *
+ * @file        mkl_TPM.cpp
+ * @version     1.1
+ * @date        02 Agosto 2017
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +compiler     Kinetis® Design Studio IDE.
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012.
+ *              +revisions    Versão (data): Descrição breve.
+ *                             ++ 1.0 (02 Agosto 2017): Versão inicial.
+ *                             ++ 1.1 (17 Outubro 2026): claimPeripheral/releasePeripheral: reserva do TPM entre os drivers.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas.
+ *              +courses      Engenharia da Computação / Engenharia Elétrica.
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Versão inicial:
+ *                             ++ Hamilton Nascimento <hdan_neto@hotmail.com>
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ *              Este programa é um software livre; Você pode redistribuí-lo
+ *              e/ou modificá-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              versão 3 da licença, ou qualquer versão posterior.
+ *
+ *              Este programa é distribuído na esperança de que seja útil,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implícita de
+ *              COMERCIALIZAÇÃO OU USO PARA UM DETERMINADO PROPÓSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+#include "mkl_TPM.h"
+
+const void *mkl_TPM::peripheralOwners[3] = {0, 0, 0};
+
+/*!
+ *   @fn         bindPeripheral
+ *
+ *   @brief      Associa o objeto de software ao periférico de hardware.
+ *
+ *   Este método associa ao objeto de software o periférico de hardware,
+ *   utilizando a inicialização dos ponteiros para os endereços de memória
+ *   dos registradores correspondentes.
+ *
+ *   @param[in]  baseAddress - o endereço base do periférico TPM.
+ *
+ *   @remarks    Sigla e pagina do Manual de Referencia KL25:
+ *               - TPMxSC: Status Control Register. Pág. 552.
+ *               - TPMxCNT: Counter Register. Pág.554.
+ *               - TPMxMOD: Modulo Register. Pág. 554.
+ */
+
+void mkl_TPM::bindPeripheral(uint8_t *baseAddress) {
+  addressTPMxSC = (volatile uint32_t *)(baseAddress);
+  addressTPMxCNT = (volatile uint32_t *)(baseAddress + 0x4);
+  addressTPMxMOD = (volatile uint32_t *)(baseAddress + 0x8);
+}
+
+/*!
+ *   @fn         bindChannel
+ *
+ *   @brief      Associa o canal do objeto de software ao hardware
+ *
+ *   Este método associa os atributos do canal do objeto de software ao
+ *   seu correspondente do periférico hardware.
+ *
+ *   @param[in]  baseAddress - o endereço base do periférico TPM.
+ *               chnNumber - o número do canal do periférico TPM.
+ *
+ *   @remarks    Sigla e pagina do Manual de Referencia KL25:
+ *               - TPMxCnV: Channel Value Register. Pág.557.
+ *               - TPMxCnSC: Channel Status Control Register. Pág.555.
+ */
+void mkl_TPM::bindChannel(uint8_t *baseAddress,
+                                        uint8_t chnNumber) {
+  addressTPMxCnV = (volatile uint32_t *)(baseAddress + 0x10 + 8*chnNumber);
+  addressTPMxCnSC = (volatile uint32_t *)(baseAddress + 0xC + 8*chnNumber);
+}
+
+ /*!
+  *   @fn         bindPin
+  *
+  *   @brief      Associa o pino do objeto ao periférico de hardare.
+  *
+  *   Este método associa o pino do objeto de software ao pino do periférico.
+  *
+  *   @param[in]  pinNumber - o número do pino do objeto de software.
+  *
+  *   @remarks    Sigla e pagina do Manual de Referencia KL25:
+  *               - PCR: Pin Control Register. Pág.183.
+  */
+void mkl_TPM::bindPin(uint8_t GPIONumber, uint8_t pinNumber) {
+  addressPortxPCRn = (volatile uint32_t *)(0x40049000
+                                          + 0x1000*GPIONumber + 4*pinNumber);
+}
+
+/*!
+ *   @fn         enablePeripheralClock
+ *
+ *   @brief      Habilita o clock do periférico de hardware.
+ *
+ *   Este método habilita o clock do periférico TPM solicitado.
+ *
+ *   @remarks    Sigla e pagina do Manual de Referencia KL25:
+ *               - SCGC6: System Control Gating Clock Register 6. Pág.207.
+ *               - SOPT2: System Options Register 2. Pág.195.
+ */
+void mkl_TPM::enablePeripheralClock(uint8_t TPMNumber) {
+  SIM_SCGC6 |= SIM_SCGC6_TPM0_MASK << TPMNumber;
+  SIM_SOPT2 |= SIM_SOPT2_TPMSRC(1);
+}
+
+/*!
+ *   @fn         enableGPIOClock
+ *
+ *   @brief      Habilita o clock do GPIO do pino.
+ *
+ *   Este método habilita o clock do periférico GPIO do pino passado por
+ *   parâmetro.
+ *
+ *   @param[in]  GPIONumber - o número do GPIO correspondente ao pino.
+ *
+ *   @remarks    Sigla e pagina do Manual de Referencia KL25:
+ *               - SCGC5: System Control Gating Clock Register 5. Pág.199.
+ */
+void mkl_TPM::enableGPIOClock(uint8_t GPIONumber) {
+  SIM_SCGC5 |= SIM_SCGC5_PORTA_MASK << GPIONumber;
+}
+
+/*!
+ *   @fn         selectMuxAlternative
+ *
+ *   @brief      Seleciona a alternativa de trabalho do pino.
+ *
+ *   Este método seleciona o modo de operação do pino correspondente para o
+ *   modo de operação TPM.
+ *
+ *   @param[in]  muxAlt - alternativa de operação do pino para o canal e TPM
+ *                        especificados.
+ *
+ *   @remarks    Sigla e pagina do Manual de Referencia KL25:
+ *               - PCR: Pin Control Register. Pág.183.
+ */
+void mkl_TPM::selectMuxAlternative(uint8_t muxAlt) {
+  *addressPortxPCRn = PORT_PCR_MUX(muxAlt);
+}
+
+/*!
+ *   @fn         setTPMParameters
+ *
+ *   @brief      Ajusta os parâmetros do TPM.
+ *
+ *   Este método ajusta os parâmetros do TPM (números de pino, GPIO,
+ *   canal, TPM) e a máscara de seleção do mux, de acordo com o membro
+ *   da enum passado no construtor da classe filha.
+ *
+ *   @param[in]  pin - pino passado para o construtor da classe filha.
+ *               pinNumber - número do pino.
+ *               GPIONumber - número do GPIO.
+ *               chnNumber - número do canal.
+ *               TPMNumber - número do TPM.
+ *               muxAltMask - máscara de seleção do mux.
+ */
+void mkl_TPM::setTPMParameters(tpm_Pin pin, uint8_t &pinNumber,
+                                   uint8_t &GPIONumber, uint8_t &chnNumber,
+                                   uint8_t &TPMNumber, uint8_t &muxAltMask) {
+  pinNumber = pin & 0x1F;
+  GPIONumber = (pin >> 5) & 0x7;
+  chnNumber = (pin >> 8) & 0x7;
+  TPMNumber = (pin >> 11) & 0x3;
+  muxAltMask = (pin >> 13) & 0x7;
+}
+
+/*!
+ *   @fn         setBaseAddress
+ *
+ *   @brief      Ajusta o endereço base do TPM.
+ *
+ *   Este método ajusta o endereço base do TPM a partir do número do
+ *   TPM.
+ *
+ *   @param[in]  TPMNumber - número do TPM.
+ *               baseAddress - ponteiro para o endereço base do TPM.
+ */
+void mkl_TPM::setBaseAddress (uint8_t TPMNumber, uint8_t **baseAddress) {
+  *baseAddress = (uint8_t *)(TPM0_BASE + 0x1000*TPMNumber);
+}
+
+/*!
+ *   @fn         claimPeripheral
+ *
+ *   @brief      Reserva o TPM do objeto para a chave "owner".
+ *
+ *   As reservas são feitas na configuração, fora das interrupções.
+ *
+ *   @param[in]  owner - chave do driver: o próprio objeto, ou uma chave
+ *                       comum aos objetos que compartilham o TPM.
+ *
+ *   @return     true se o TPM estava livre ou já era da chave; false se
+ *               outro driver o reservou.
+ */
+bool mkl_TPM::claimPeripheral(const void *owner) {
+  const void *&current =
+      peripheralOwners[((uintptr_t)addressTPMxSC - TPM0_BASE) >> 12];
+
+  if (current && current != owner) {
+    return false;
+  }
+  current = owner;
+  return true;
+}
+
+/*!
+ *   @fn         releasePeripheral
+ *
+ *   @brief      Libera o TPM, se ele foi reservado pela chave "owner".
+ */
+void mkl_TPM::releasePeripheral(const void *owner) {
+  const void *&current =
+      peripheralOwners[((uintptr_t)addressTPMxSC - TPM0_BASE) >> 12];
+
+  if (current == owner) {
+    current = 0;
+  }
+}
@@ -1,184 +1,286 @@
-/*!
- * @copyright    2017 Universidade Federal do Amazonas.
- *
- * @brief       Interface da classe me "mkl_TPM".
- *
- * @file        mkl_TPM.h
- * @version     1.0
- * @date        02 Agosto 2017
- *
- * @section     HARDWARES & SOFTWARES
- *              +board        FRDM-KL25Z da NXP.
- *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
- *              +compiler     Kinetis Design Studio IDE.
- *              +manual       L25P80M48SF0RM, Rev.3, September 2012.
- *              +revisions    Verso (data): Descrio breve.
- *                             ++ 1.0 (02 Agosto 2017): Verso inicial.
- *
- * @section     AUTHORS & DEVELOPERS
- *              +institution  Universidade Federal do Amazonas.
- *              +courses      Engenharia da Computao / Engenharia Eltrica.
- *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
- *              +student      Verso inicial:
- *                             ++ Hamilton Nascimento <hdan_neto@hotmail.com>
- *
- * @section     LICENSE
- *
- *              GNU General Public License (GNU GPL).
- *
- *              Este programa  um software livre; Voc pode redistribu-lo
- *              e/ou modific-lo de acordo com os termos do "GNU General Public
- *              License" como publicado pela Free Software Foundation; Seja a
- *              verso 3 da licena, ou qualquer verso posterior.
- *
- *              Este programa  distribudo na esperana de que seja til,
- *              mas SEM QUALQUER GARANTIA; Sem a garantia implcita de
- *              COMERCIALIZAO OU USO PARA UM DETERMINADO PROPSITO.
- *              Veja o site da "GNU General Public License" para mais detalhes.
- *
- * @htmlonly    http://www.gnu.org/copyleft/gpl.html
- */
-
-#ifndef MKL_TPM_H_
-#define MKL_TPM_H_
-
-#include <MKL25Z4.h>
-#include <stdint.h>
-
-/*!
- * Enum associado  mascara do GPIO, canal, TPM e alternativa do mux PCR.
- */
-typedef enum {
-  tpm_GPIOA = 0,
-  tpm_GPIOB = 1 << 5,
-  tpm_GPIOC = 2 << 5,
-  tpm_GPIOD = 3 << 5,
-  tpm_GPIOE = 4 << 5
-}tpm_GPIOMask;
-
-typedef enum {
-  tpm_CH0 = 0,
-  tpm_CH1 = 1 << 8,
-  tpm_CH2 = 2 << 8,
-  tpm_CH3 = 3 << 8,
-  tpm_CH4 = 4 << 8,
-  tpm_CH5 = 5 << 8
-}tpm_ChnMask;
-
-typedef enum {
-  tpm_TPM0 = 0,
-  tpm_TPM1 = 1 << 11,
-  tpm_TPM2 = 2 << 11
-}tpm_TPMNumberMask;
-
-typedef enum {
-  tpm_muxAlt3 = 3 << 13,
-  tpm_muxAlt4 = 4 << 13
-}tpm_muxAltMask;
-
-/*!
- * Enum associado ao fator de diviso do divisor de frequncia.
- */
-typedef enum {
-  tpm_div1 = 0,
-  tpm_div2,
-  tpm_div4,
-  tpm_div8,
-  tpm_div16,
-  tpm_div32,
-  tpm_div64,
-  tpm_div128
-}tpm_Div;
-
-/*!
- * Enum associado  borda de transio de deteco.
- */
-typedef enum {
-  tpm_falling = 1,
-  tpm_rising,
-  tpm_both
-}tpm_Edge;
-
-/*!
- * Enum associado ao perifrico TPM e seus pinos correspondentes.
- */
-typedef enum {
-  tpm_PTA0 = 0|tpm_GPIOA|tpm_CH5|tpm_TPM0|tpm_muxAlt3,
-  tpm_PTA4 = 4|tpm_GPIOA|tpm_CH1|tpm_TPM0|tpm_muxAlt3,
-  tpm_PTA5 = 5|tpm_GPIOA|tpm_CH2|tpm_TPM0|tpm_muxAlt3,
-  tpm_PTC1 = 1|tpm_GPIOC|tpm_CH0|tpm_TPM0|tpm_muxAlt4,
-  tpm_PTC2 = 2|tpm_GPIOC|tpm_CH1|tpm_TPM0|tpm_muxAlt4,
-  tpm_PTC3 = 3|tpm_GPIOC|tpm_CH2|tpm_TPM0|tpm_muxAlt4,
-  tpm_PTC4 = 4|tpm_GPIOC|tpm_CH3|tpm_TPM0|tpm_muxAlt4,
-  tpm_PTC8 = 8|tpm_GPIOC|tpm_CH4|tpm_TPM0|tpm_muxAlt3,
-  tpm_PTC9 = 9|tpm_GPIOC|tpm_CH5|tpm_TPM0|tpm_muxAlt3,
-  tpm_PTD0 = 0|tpm_GPIOD|tpm_CH0|tpm_TPM0|tpm_muxAlt4,
-  tpm_PTD1 = 1|tpm_GPIOD|tpm_CH1|tpm_TPM0|tpm_muxAlt4,
-  tpm_PTD2 = 2|tpm_GPIOD|tpm_CH2|tpm_TPM0|tpm_muxAlt4,
-  tpm_PTD3 = 3 |tpm_GPIOD|tpm_CH3|tpm_TPM0|tpm_muxAlt4,
-  tpm_PTD4 = 4|tpm_GPIOD|tpm_CH4|tpm_TPM0|tpm_muxAlt4,
-  tpm_PTD5 = 5|tpm_GPIOD|tpm_CH5|tpm_TPM0|tpm_muxAlt4,
-  tpm_PTE29 = 29|tpm_GPIOE|tpm_CH2|tpm_TPM0|tpm_muxAlt3,
-  tpm_PTE30 = 30|tpm_GPIOE|tpm_CH3|tpm_TPM0|tpm_muxAlt3,
-  tpm_PTA12 = 12|tpm_GPIOA|tpm_CH0|tpm_TPM1|tpm_muxAlt3,
-  tpm_PTA13 = 13|tpm_GPIOA|tpm_CH1|tpm_TPM1|tpm_muxAlt3,
-  tpm_PTB0 = 0|tpm_GPIOB|tpm_CH0|tpm_TPM1|tpm_muxAlt3,
-  tpm_PTB1 = 1|tpm_GPIOB|tpm_CH1|tpm_TPM1|tpm_muxAlt3,
-  tpm_PTE20 = 20|tpm_GPIOE|tpm_CH0|tpm_TPM1|tpm_muxAlt3,
-  tpm_PTE21 = 21|tpm_GPIOE|tpm_CH1|tpm_TPM1|tpm_muxAlt3,
-  tpm_PTA1 = 1|tpm_GPIOA|tpm_CH0|tpm_TPM2|tpm_muxAlt3,
-  tpm_PTA2 = 2|tpm_GPIOA|tpm_CH1|tpm_TPM2|tpm_muxAlt3,
-  tpm_PTE22 = 22|tpm_GPIOE|tpm_CH0|tpm_TPM2|tpm_muxAlt3,
-  tpm_PTE23 = 23|tpm_GPIOE|tpm_CH1|tpm_TPM2|tpm_muxAlt3
-}tpm_Pin;
-
-/*!
- *  @class    mkl_TPM.
- *
- *  @brief    A classe me "mkl_TPM" representa o perifrico TPM.
- *
- *  @details  Esta classe  utilizada como classe me para os perifricos que
- *            esto associados ao TPM, como o mkl_TPMDelay, mkl_TPMMeasure,
- *            mkl_TPMEventCounter, mkl_TPMPWM.
- */
-class mkl_TPM {
- protected:
-  /*!
-   * Endereos dos registradores associados ao perifrico TPM e seus canais.
-   */
-  volatile uint32_t *addressTPMxSC;
-  volatile uint32_t *addressTPMxMOD;
-  volatile uint32_t *addressTPMxCNT;
-  volatile uint32_t *addressTPMxCnV;
-  volatile uint32_t *addressTPMxCnSC;
-  volatile uint32_t *addressPortxPCRn;
-
-  /*!
-   * Mtodos de bind do perifrico, dos seus canais e do pino escolhido.
-   */
-  void bindPeripheral(uint8_t *baseAddress);
-  void bindChannel(uint8_t *baseAddress, uint8_t chnNumber);
-  void bindPin(uint8_t GPIONumber, uint8_t TPMNumber);
-
-  /*!
-   * Mtodos de habilitao de clock do perifrico e da porta.
-   */
-  void enablePeripheralClock(uint8_t TPMNumber);
-  void enableGPIOClock(uint8_t GPIONumber);
-
-  /*!
-   * Mtodo de seleo do mux do pino.
-   */
-  void selectMuxAlternative(uint8_t muxAlt);
-
-  /*!
-   * Mtodos de ajuste de parmetros e endereo base.
-   */
-  void setTPMParameters(tpm_Pin pin, uint8_t &pinNumber,
-                        uint8_t &GPIONumber, uint8_t &chnNumber,
-                        uint8_t &TPMNumber, uint8_t &muxAltMask);
-
-  void setBaseAddress (uint8_t TPMNumber, uint8_t **baseAddress);
-};
-
-#endif  //  MKL_TPM_H_
+/*!
+ * @copyright   © 2017 Universidade Federal do Amazonas.
+ *
+ * @brief       Interface da classe mãe "mkl_TPM".
+ *
+ * @file        mkl_TPM.h
+ * @version     1.3
+ * @date        02 Agosto 2017
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +compiler     Kinetis® Design Studio IDE.
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012.
+ *              +revisions    Versão (data): Descrição breve.
+ *                             ++ 1.0 (02 Agosto 2017): Versão inicial.
+ *                             ++ 1.1 (17 Outubro 2026): TPM_CLOCK, frequência do clock do TPM.
+ *                             ++ 1.2 (17 Outubro 2026): mkl_TPMTiming: divisor e módulo calculados de uma duração do std::chrono.
+ *                             ++ 1.3 (17 Outubro 2026): claimPeripheral/releasePeripheral: reserva do TPM entre os drivers.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas.
+ *              +courses      Engenharia da Computação / Engenharia Elétrica.
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Versão inicial:
+ *                             ++ Hamilton Nascimento <hdan_neto@hotmail.com>
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ *              Este programa é um software livre; Você pode redistribuí-lo
+ *              e/ou modificá-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              versão 3 da licença, ou qualquer versão posterior.
+ *
+ *              Este programa é distribuído na esperança de que seja útil,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implícita de
+ *              COMERCIALIZAÇÃO OU USO PARA UM DETERMINADO PROPÓSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#ifndef MKL_TPM_H_
+#define MKL_TPM_H_
+
+#include <MKL25Z4.h>
+#include <stdint.h>
+#include "mkl_Duration/mkl_Duration.h"
+
+/*!
+ *  Frequência do clock do TPM: MCGFLLCLK, selecionado em SIM_SOPT2_TPMSRC(1)
+ *  (modo FEI, padrão após o reset).
+ */
+#ifndef TPM_CLOCK
+#define TPM_CLOCK 20971520u
+#endif
+
+/*!
+ * Enum associado à mascara do GPIO, canal, TPM e alternativa do mux PCR.
+ */
+typedef enum {
+  tpm_GPIOA = 0,
+  tpm_GPIOB = 1 << 5,
+  tpm_GPIOC = 2 << 5,
+  tpm_GPIOD = 3 << 5,
+  tpm_GPIOE = 4 << 5
+}tpm_GPIOMask;
+
+typedef enum {
+  tpm_CH0 = 0,
+  tpm_CH1 = 1 << 8,
+  tpm_CH2 = 2 << 8,
+  tpm_CH3 = 3 << 8,
+  tpm_CH4 = 4 << 8,
+  tpm_CH5 = 5 << 8
+}tpm_ChnMask;
+
+typedef enum {
+  tpm_TPM0 = 0,
+  tpm_TPM1 = 1 << 11,
+  tpm_TPM2 = 2 << 11
+}tpm_TPMNumberMask;
+
+typedef enum {
+  tpm_muxAlt3 = 3 << 13,
+  tpm_muxAlt4 = 4 << 13
+}tpm_muxAltMask;
+
+/*!
+ * Enum associado ao fator de divisão do divisor de frequência.
+ */
+typedef enum {
+  tpm_div1 = 0,
+  tpm_div2,
+  tpm_div4,
+  tpm_div8,
+  tpm_div16,
+  tpm_div32,
+  tpm_div64,
+  tpm_div128
+}tpm_Div;
+
+/*!
+ *  @class    mkl_TPMTiming
+ *
+ *  @brief    Divisor e módulo do TPM para uma duração do std::chrono.
+ *
+ *  @details  from() escolhe o menor divisor (a melhor resolução) em que a
+ *            duração cabe nas 65536 contagens do contador, e o módulo
+ *            correspondente, arredondado: o estouro (TOF) ocorre após
+ *            "modulo" + 1 contagens de TPM_CLOCK/2^div. errorNs é a
+ *            diferença, em nanossegundos, entre a duração obtida e a pedida.
+ *
+ *            Em uma variável constexpr, o cálculo é feito na compilação, e
+ *            uma duração fora do alcance (abaixo de uma contagem ou acima de
+ *            65536*128 contagens, cerca de 400 ms) é um erro de compilação:
+ *            a chamada a durationOutOfRange, que não é constexpr. Fora de
+ *            uma expressão constante, from() faz as divisões em tempo de
+ *            execução e, fora do alcance, retorna o maior delay com
+ *            errorNs = kOutOfRange.
+ *
+ *  @section  EXAMPLES USAGE
+ *
+ *             +fn constexpr mkl_TPMTiming kDebounce =
+ *                   mkl_TPMTiming::from(std::chrono::milliseconds(30));
+ *             +fn delay.waitDelay(kDebounce);
+ */
+struct mkl_TPMTiming {
+  static const int32_t kOutOfRange = INT32_MAX;
+
+  tpm_Div div;
+  uint16_t modulo;
+  int32_t errorNs;
+
+  template <class Rep, class Period>
+  static constexpr mkl_TPMTiming from(std::chrono::duration<Rep, Period> d) {
+    return select(d, selectShift(d, 0));
+  }
+
+  static mkl_TPMTiming durationOutOfRange() {
+    return mkl_TPMTiming{tpm_div128, 0xFFFF, kOutOfRange};
+  }
+
+ private:
+  template <class Rep, class Period>
+  static constexpr uint8_t selectShift(std::chrono::duration<Rep, Period> d,
+                                       uint8_t shift) {
+    return (shift == tpm_div128 ||
+            mkl_Duration::ticks(d, TPM_CLOCK, shift) <= 0x10000)
+               ? shift
+               : selectShift(d, shift + 1);
+  }
+
+  template <class Rep, class Period>
+  static constexpr mkl_TPMTiming select(std::chrono::duration<Rep, Period> d,
+                                        uint8_t shift) {
+    return select(d, shift, mkl_Duration::ticks(d, TPM_CLOCK, shift));
+  }
+
+  template <class Rep, class Period>
+  static constexpr mkl_TPMTiming select(std::chrono::duration<Rep, Period> d,
+                                        uint8_t shift, uint64_t ticks) {
+    return (mkl_Duration::fits(d, TPM_CLOCK) && ticks >= 1 &&
+            ticks <= 0x10000)
+               ? mkl_TPMTiming{
+                     (tpm_Div)shift, (uint16_t)(ticks - 1),
+                     (int32_t)(mkl_Duration::ticksToNanoseconds(
+                                   ticks, TPM_CLOCK, shift) -
+                               mkl_Duration::nanoseconds(d))}
+               : durationOutOfRange();
+  }
+};
+
+/*!
+ * Enum associado à borda de transição de detecção.
+ */
+typedef enum {
+  tpm_falling = 1,
+  tpm_rising,
+  tpm_both
+}tpm_Edge;
+
+/*!
+ * Enum associado ao periférico TPM e seus pinos correspondentes.
+ */
+typedef enum {
+  tpm_PTA0 = 0|tpm_GPIOA|tpm_CH5|tpm_TPM0|tpm_muxAlt3,
+  tpm_PTA4 = 4|tpm_GPIOA|tpm_CH1|tpm_TPM0|tpm_muxAlt3,
+  tpm_PTA5 = 5|tpm_GPIOA|tpm_CH2|tpm_TPM0|tpm_muxAlt3,
+  tpm_PTC1 = 1|tpm_GPIOC|tpm_CH0|tpm_TPM0|tpm_muxAlt4,
+  tpm_PTC2 = 2|tpm_GPIOC|tpm_CH1|tpm_TPM0|tpm_muxAlt4,
+  tpm_PTC3 = 3|tpm_GPIOC|tpm_CH2|tpm_TPM0|tpm_muxAlt4,
+  tpm_PTC4 = 4|tpm_GPIOC|tpm_CH3|tpm_TPM0|tpm_muxAlt4,
+  tpm_PTC8 = 8|tpm_GPIOC|tpm_CH4|tpm_TPM0|tpm_muxAlt3,
+  tpm_PTC9 = 9|tpm_GPIOC|tpm_CH5|tpm_TPM0|tpm_muxAlt3,
+  tpm_PTD0 = 0|tpm_GPIOD|tpm_CH0|tpm_TPM0|tpm_muxAlt4,
+  tpm_PTD1 = 1|tpm_GPIOD|tpm_CH1|tpm_TPM0|tpm_muxAlt4,
+  tpm_PTD2 = 2|tpm_GPIOD|tpm_CH2|tpm_TPM0|tpm_muxAlt4,
+  tpm_PTD3 = 3 |tpm_GPIOD|tpm_CH3|tpm_TPM0|tpm_muxAlt4,
+  tpm_PTD4 = 4|tpm_GPIOD|tpm_CH4|tpm_TPM0|tpm_muxAlt4,
+  tpm_PTD5 = 5|tpm_GPIOD|tpm_CH5|tpm_TPM0|tpm_muxAlt4,
+  tpm_PTE29 = 29|tpm_GPIOE|tpm_CH2|tpm_TPM0|tpm_muxAlt3,
+  tpm_PTE30 = 30|tpm_GPIOE|tpm_CH3|tpm_TPM0|tpm_muxAlt3,
+  tpm_PTA12 = 12|tpm_GPIOA|tpm_CH0|tpm_TPM1|tpm_muxAlt3,
+  tpm_PTA13 = 13|tpm_GPIOA|tpm_CH1|tpm_TPM1|tpm_muxAlt3,
+  tpm_PTB0 = 0|tpm_GPIOB|tpm_CH0|tpm_TPM1|tpm_muxAlt3,
+  tpm_PTB1 = 1|tpm_GPIOB|tpm_CH1|tpm_TPM1|tpm_muxAlt3,
+  tpm_PTE20 = 20|tpm_GPIOE|tpm_CH0|tpm_TPM1|tpm_muxAlt3,
+  tpm_PTE21 = 21|tpm_GPIOE|tpm_CH1|tpm_TPM1|tpm_muxAlt3,
+  tpm_PTA1 = 1|tpm_GPIOA|tpm_CH0|tpm_TPM2|tpm_muxAlt3,
+  tpm_PTA2 = 2|tpm_GPIOA|tpm_CH1|tpm_TPM2|tpm_muxAlt3,
+  tpm_PTE22 = 22|tpm_GPIOE|tpm_CH0|tpm_TPM2|tpm_muxAlt3,
+  tpm_PTE23 = 23|tpm_GPIOE|tpm_CH1|tpm_TPM2|tpm_muxAlt3
+}tpm_Pin;
+
+/*!
+ *  @class    mkl_TPM.
+ *
+ *  @brief    A classe mãe "mkl_TPM" representa o periférico TPM.
+ *
+ *  @details  Esta classe é utilizada como classe mãe para os periféricos que
+ *            estão associados ao TPM, como o mkl_TPMDelay, mkl_TPMMeasure,
+ *            mkl_TPMEventCounter, mkl_TPMPWM.
+ *
+ *            O contador, o MOD e o divisor são comuns aos canais do TPM: os
+ *            drivers reservam o TPM (claimPeripheral) antes de programá-lo,
+ *            com uma chave. Objetos com a mesma chave (os canais PWM, os
+ *            canais de captura) compartilham o TPM; outra chave é recusada
+ *            até releasePeripheral.
+ */
+class mkl_TPM {
+ public:
+  /*!
+   * Métodos de reserva do TPM entre os drivers.
+   */
+  bool claimPeripheral(const void *owner);
+  void releasePeripheral(const void *owner);
+
+ protected:
+  /*!
+   * Endereços dos registradores associados ao periférico TPM e seus canais.
+   */
+  volatile uint32_t *addressTPMxSC;
+  volatile uint32_t *addressTPMxMOD;
+  volatile uint32_t *addressTPMxCNT;
+  volatile uint32_t *addressTPMxCnV;
+  volatile uint32_t *addressTPMxCnSC;
+  volatile uint32_t *addressPortxPCRn;
+
+  /*!
+   * Métodos de bind do periférico, dos seus canais e do pino escolhido.
+   */
+  void bindPeripheral(uint8_t *baseAddress);
+  void bindChannel(uint8_t *baseAddress, uint8_t chnNumber);
+  void bindPin(uint8_t GPIONumber, uint8_t TPMNumber);
+
+  /*!
+   * Métodos de habilitação de clock do periférico e da porta.
+   */
+  void enablePeripheralClock(uint8_t TPMNumber);
+  void enableGPIOClock(uint8_t GPIONumber);
+
+  /*!
+   * Método de seleção do mux do pino.
+   */
+  void selectMuxAlternative(uint8_t muxAlt);
+
+  /*!
+   * Métodos de ajuste de parâmetros e endereço base.
+   */
+  void setTPMParameters(tpm_Pin pin, uint8_t &pinNumber,
+                        uint8_t &GPIONumber, uint8_t &chnNumber,
+                        uint8_t &TPMNumber, uint8_t &muxAltMask);
+
+  void setBaseAddress (uint8_t TPMNumber, uint8_t **baseAddress);
+
+ private:
+  /*!
+   * Chave do driver que reservou cada TPM (0 = livre).
+   */
+  static const void *peripheralOwners[3];
+};
+
+#endif  //  MKL_TPM_H_
@@ -1,206 +1,380 @@
-/*!
- * @copyright    2017 Universidade Federal do Amazonas.
- *
- * @brief       Implementao da API em C++ para o TPM, no modo delay.
- *
- * @file        mkl_TPMDelay.h
- * @version     1.0
- * @date        31 Julho 2017
- *
- * @section     HARDWARES & SOFTWARES
- *              +board        FRDM-KL25Z da NXP.
- *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
- *              +compiler     Kinetis Design Studio IDE.
- *              +manual       L25P80M48SF0RM, Rev.3, September 2012.
- *              +revisions    Verso (data): Descrio breve.
- *                             ++ 1.0 (6 Julho 2017): Verso inicial.
- *
- * @section     AUTHORS & DEVELOPERS
- *              +institution  Universidade Federal do Amazonas.
- *              +courses      Engenharia da Computao / Engenharia Eltrica.
- *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
- *              +student      Verso inicial:
- *                             ++ Hamilton Nascimento <hdan_neto@hotmail.com>
- *
- * @section     LICENSE
- *
- *              GNU General Public License (GNU GPL).
- *
- *              Este programa  um software livre; Voc pode redistribu-lo
- *              e/ou modific-lo de acordo com os termos do "GNU General Public
- *              License" como publicado pela Free Software Foundation; Seja a
- *              verso 3 da licena, ou qualquer verso posterior.
- *
- *              Este programa  distribudo na esperana de que seja til,
- *              mas SEM QUALQUER GARANTIA; Sem a garantia implcita de
- *              COMERCIALIZAO OU USO PARA UM DETERMINADO PROPSITO.
- *              Veja o site da "GNU General Public License" para mais detalhes.
- *
- * @htmlonly    http://www.gnu.org/copyleft/gpl.html
- */
-
-#include <stdint.h>
-#include "mkl_TPMDelay.h"
-
-  /*!
-   *   @fn       mkl_TPMDelay
-   *
-   *   @brief    Mtodo construtor da classe.
-   *
-   *   Mtodo construtor da classe, que inicializa os atributos do objeto.
-   *
-   *   @param[in]  tpm - perifrico TPM a ser associado ao objeto de software.
-   */
-mkl_TPMDelay::mkl_TPMDelay(tpm_TPMNumberMask tpmMask) {
-  uint8_t *baseAddress;
-  uint8_t tpm;
-
-  tpm = tpmMask << 11;
-  baseAddress = (uint8_t *)(TPM0_BASE + 0x1000*tpm);
-  bindPeripheral(baseAddress);
-  enablePeripheralClock(tpm);
-}
-
-  /*!
-   *   @fn       setFrequency
-   *
-   *   @brief    Mtodo de ajuste da frequncia de operao.
-   *
-   *   Mtodo que ajusta a frequncia de operao do delay.
-   *
-   *   @param[in]  divBase - constante de diviso do divisor de frequncia.
-   */
-void mkl_TPMDelay::setFrequency(tpm_Div divBase) {
-  cancelDelay();
-  *addressTPMxSC = divBase;
-}
-
-  /*!
-   *   @fn       startDelay
-   *
-   *   @brief    Inicia a operao do perifrico TPM no modo delay.
-   *
-   *   Mtodo que inicia um delay de durao especificada.
-   *
-   *   @param[in] cycles - nmero de ciclos de relgio da operao.
-   *
-   *   @details   Este mtodo no "prende", i.e., o mtodo apenas inicia a
-   *              contagem do temporizador.
-   *
-   *              O parmetro "cycles" no corresponde ao tempo, em segundos,
-   *              da temporizao iniciada.
-   *              A equao que relaciona o parmetro "cycles" ao tempo,
-   *              em segundos,  dada por:
-   *
-   *              cycles = T*(20.97*10^6)/divBase,
-   *
-   *              onde:
-   *              - T       : tempo em segundos;
-   *              - divBase : fator de diviso configurado no mtodo
-   *                          setFrequency;
-   *              - cycles  : ciclos de relgio.
-   *
-   *              Note o maior valor do parmetro dever ser de 65535, que
-   *               o maior valor em decimal que se obtm com 16 bits.
-   *              65535  o fundo de escala do registrador TPMCNT.
-   */
-void mkl_TPMDelay::startDelay(uint16_t cycles) {
-  /*!
-  * Desabilita a contagem.
-  */
-  *addressTPMxSC &= ~0x08;
-  /*!
-  * Reseta o contador CNT.
-  */
-  *addressTPMxCNT = 0;
-  /*!
-  * Ajusta o fundo de escala do registrador "Modulo".
-  */
-  *addressTPMxMOD = cycles;
-  /*!
-  * Limpa a flag de trmino TOF do registrador Status Counter.
-  */
-  *addressTPMxSC |= 0x80;
-  /*!
-  * Habilita a contagem.
-  */
-  *addressTPMxSC |= 0x08;
-}
-
-  /*!
-   *   @fn       timeoutDelay
-   *
-   *   @brief    Indica a ocorrncia do trmino de temporizao.
-   *
-   *   Mtodo que indica se o tempo especificado pelo
-   *
-   *   @param[in]  divBase - constante de diviso do divisor de frequncia.
-   */
-int mkl_TPMDelay::timeoutDelay() {
-  if (*addressTPMxSC & 0x80) {
-    return 1;
-  }
-  return 0;
-}
-
-  /*!
-   *   @fn       waitDelay
-   *
-   *   @brief    Inicia a operao do perifrico TPM no modo delay.
-   *
-   *   Mtodo que inicia um delay de durao especificada.
-   *
-   *   @param[in] cycles - nmero de ciclos de relgio da operao.
-   *
-   *   @details   Este mtodo aguarda at que o valor de temporizao desejado
-   *              se esgote.
-   *
-   *              O parmetro "cycles" no corresponde ao tempo, em segundos,
-   *              da temporizao iniciada.
-   *              A equao que relaciona o parmetro "cycles" ao tempo,
-   *              em segundos,  dada por:
-   *
-   *              cycles = T*(20.97*10^6)/divBase,
-   *
-   *              onde:
-   *              - T       : tempo em segundos;
-   *              - divBase : fator de diviso configurado no mtodo
-   *                          setFrequency;
-   *              - cycles  : ciclos de relgio.
-   *
-   *              Note o maior valor do parmetro dever ser de 65535, que
-   *               o maior valor em decimal que se obtm com 16 bits.
-   *              65535  o fundo de escala do registrador TPMCNT.
-   */
-void mkl_TPMDelay::waitDelay(uint16_t cycles) {
-  startDelay(cycles);
-  do {} while (timeoutDelay() != 1);
-}
-
-  /*!
-   *   @fn       cancelDelay
-   *
-   *   @brief    Cancela uma temporizao em andamento.
-   *
-   *   Mtodo que cancela uma temporizao iniciada, parando o contador.
-   */
-void mkl_TPMDelay::cancelDelay() {
-  /*!
-  * Desabilita a contagem.
-  */
-  *addressTPMxSC &= ~0x08;
-}
-
-  /*!
-   *   @fn       getCounter
-   *
-   *   @brief    Mtodo que informa o valor atual da contagem.
-   *
-   *   Mtodo que informa o valor atual do contador do temporizador.
-   *
-   *   @param[in]  value - varivel passada por referncia que ser atualizada
-   *                       com o valor corrente do contador do temporizador.
-   */
-void mkl_TPMDelay::getCounter(uint16_t *value) {
-  *value = *addressTPMxCNT;
-}
+/*!
+ * @copyright   © 2017 Universidade Federal do Amazonas.
+ *
+ * @brief       Implementação da API em C++ para o TPM, no modo delay.
+ *
+ * @file        mkl_TPMDelay.h
+ * @version     1.4
+ * @date        31 Julho 2017
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +compiler     Kinetis® Design Studio IDE.
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012.
+ *              +revisions    Versão (data): Descrição breve.
+ *                             ++ 1.0 (6 Julho 2017): Versão inicial.
+ *                             ++ 1.1 (17 Outubro 2026): Delay assíncrono, com rotina chamada na interrupção do TPM; correção do deslocamento do número do TPM.
+ *                             ++ 1.2 (17 Outubro 2026): waitDelay e startDelay com um mkl_TPMTiming.
+ *                             ++ 1.3 (17 Outubro 2026): startPeriodic: temporização periódica com o contador livre.
+ *                             ++ 1.4 (17 Outubro 2026): Os métodos de temporização reservam o TPM (claimPeripheral) e retornam false se ele é de outro driver.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas.
+ *              +courses      Engenharia da Computação / Engenharia Elétrica.
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Versão inicial:
+ *                             ++ Hamilton Nascimento <hdan_neto@hotmail.com>
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ *              Este programa é um software livre; Você pode redistribuí-lo
+ *              e/ou modificá-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              versão 3 da licença, ou qualquer versão posterior.
+ *
+ *              Este programa é distribuído na esperança de que seja útil,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implícita de
+ *              COMERCIALIZAÇÃO OU USO PARA UM DETERMINADO PROPÓSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include <stdint.h>
+#include "mkl_TPMDelay.h"
+
+mkl_TPMDelay *mkl_TPMDelay::delays[3];
+
+  /*!
+   *   @fn       mkl_TPMDelay
+   *
+   *   @brief    Método construtor da classe.
+   *
+   *   Método construtor da classe, que inicializa os atributos do objeto.
+   *
+   *   @param[in]  tpm - periférico TPM a ser associado ao objeto de software.
+   */
+mkl_TPMDelay::mkl_TPMDelay(tpm_TPMNumberMask tpmMask)
+    : callback(0), context(0), periodic(false), pending(0) {
+  uint8_t *baseAddress;
+
+  TPMNumber = tpmMask >> 11;
+  baseAddress = (uint8_t *)(TPM0_BASE + 0x1000*TPMNumber);
+  bindPeripheral(baseAddress);
+  enablePeripheralClock(TPMNumber);
+}
+
+  /*!
+   *   @fn       setFrequency
+   *
+   *   @brief    Método de ajuste da frequência de operação.
+   *
+   *   Método que ajusta a frequência de operação do delay.
+   *
+   *   @param[in]  divBase - constante de divisão do divisor de frequência.
+   */
+bool mkl_TPMDelay::setFrequency(tpm_Div divBase) {
+  if (!claimPeripheral(this)) {
+    return false;
+  }
+  cancelDelay();
+  *addressTPMxSC = divBase;
+  return true;
+}
+
+  /*!
+   *   @fn       startDelay
+   *
+   *   @brief    Inicia a operação do periférico TPM no modo delay.
+   *
+   *   Método que inicia um delay de duração especificada.
+   *
+   *   @param[in] cycles - número de ciclos de relógio da operação.
+   *
+   *   @details   Este método não "prende", i.e., o método apenas inicia a
+   *              contagem do temporizador.
+   *
+   *              O parâmetro "cycles" não corresponde ao tempo, em segundos,
+   *              da temporização iniciada.
+   *              A equação que relaciona o parâmetro "cycles" ao tempo,
+   *              em segundos, é dada por:
+   *
+   *              cycles = T*(20.97*10^6)/divBase,
+   *
+   *              onde:
+   *              - T       : tempo em segundos;
+   *              - divBase : fator de divisão configurado no método
+   *                          setFrequency;
+   *              - cycles  : ciclos de relógio.
+   *
+   *              Note o maior valor do parâmetro deverá ser de 65535, que
+   *              é o maior valor em decimal que se obtém com 16 bits.
+   *              65535 é o fundo de escala do registrador TPMCNT.
+   */
+bool mkl_TPMDelay::startDelay(uint16_t cycles) {
+  if (!claimPeripheral(this)) {
+    return false;
+  }
+  /*!
+  * Desabilita a contagem e a interrupção de um delay assíncrono anterior.
+  */
+  *addressTPMxSC &= ~(0x08 | TPM_SC_TOIE_MASK);
+  pending = 0;
+  /*!
+  * Reseta o contador CNT.
+  */
+  *addressTPMxCNT = 0;
+  /*!
+  * Ajusta o fundo de escala do registrador "Modulo".
+  */
+  *addressTPMxMOD = cycles;
+  /*!
+  * Limpa a flag de término TOF do registrador Status Counter.
+  */
+  *addressTPMxSC |= 0x80;
+  /*!
+  * Habilita a contagem.
+  */
+  *addressTPMxSC |= 0x08;
+  return true;
+}
+
+  /*!
+   *   @fn       startDelay
+   *
+   *   @brief    Inicia um delay assíncrono, que chama "callback" ao terminar.
+   *
+   *   Método que arma o contador e retorna em seguida. O estouro (TOF) gera
+   *   a interrupção do TPM, em que handleInterrupt para o contador e chama
+   *   callback(context), uma única vez.
+   *
+   *   @param[in] cycles   - número de ciclos de relógio da operação, como
+   *                         no delay que "não prende".
+   *   @param[in] callback - rotina chamada na interrupção.
+   *   @param[in] context  - argumento passado à rotina.
+   *
+   *   @details   A rotina e o contexto são gravados antes da habilitação da
+   *              interrupção (TOIE), com o contador parado. Um novo delay no
+   *              mesmo TPM, assíncrono ou não, substitui o anterior.
+   *
+   *   @remarks   Sigla e pagina do Manual de Referencia KL25:
+   *              - TPMxSC: Status and Control. Pág. 553.
+   */
+bool mkl_TPMDelay::startDelay(uint16_t cycles, mkl_TPMDelayCallback callback,
+                              void *context) {
+  return arm(cycles, callback, context, false);
+}
+
+  /*!
+   *   @fn       startPeriodic
+   *
+   *   @brief    Inicia uma temporização periódica, que chama "callback" a
+   *             cada "cycles" + 1 contagens.
+   *
+   *   Método que deixa o contador livre: o TPM recomeça do zero ao passar do
+   *   MOD, sem recarga por software, e o período não acumula a latência da
+   *   interrupção. A temporização segue até cancelDelay ou um novo delay.
+   *
+   *   @param[in] cycles   - módulo do contador, como no startDelay.
+   *   @param[in] callback - rotina chamada na interrupção, a cada período.
+   *   @param[in] context  - argumento passado à rotina.
+   */
+bool mkl_TPMDelay::startPeriodic(uint16_t cycles, mkl_TPMDelayCallback callback,
+                                 void *context) {
+  return arm(cycles, callback, context, true);
+}
+
+  /*!
+   *   @fn       startPeriodic
+   *
+   *   @brief    Inicia uma temporização periódica com o divisor e o módulo
+   *             de "timing".
+   */
+bool mkl_TPMDelay::startPeriodic(const mkl_TPMTiming &timing,
+                                 mkl_TPMDelayCallback callback, void *context) {
+  return setFrequency(timing.div) &&
+         arm(timing.modulo, callback, context, true);
+}
+
+  /*!
+   *   @fn       arm
+   *
+   *   @brief    Arma o contador com a interrupção de estouro (TOIE).
+   *
+   *   A rotina, o contexto e o modo são gravados com o contador parado,
+   *   antes da habilitação da interrupção.
+   */
+bool mkl_TPMDelay::arm(uint16_t cycles, mkl_TPMDelayCallback callback,
+                       void *context, bool periodic) {
+  if (!claimPeripheral(this)) {
+    return false;
+  }
+  *addressTPMxSC &= ~(0x08 | TPM_SC_TOIE_MASK);
+  this->callback = callback;
+  this->context = context;
+  this->periodic = periodic;
+  delays[TPMNumber] = this;
+  pending = 1;
+  *addressTPMxCNT = 0;
+  *addressTPMxMOD = cycles;
+  *addressTPMxSC |= 0x80;
+  NVIC_EnableIRQ((IRQn_Type)(TPM0_IRQn + TPMNumber));
+  *addressTPMxSC |= TPM_SC_TOIE_MASK | 0x08;
+  return true;
+}
+
+  /*!
+   *   @fn       startDelay
+   *
+   *   @brief    Inicia um delay com o divisor e o módulo de "timing".
+   *
+   *   @param[in] timing - resultado de mkl_TPMTiming::from(duração), de
+   *                       preferência em uma variável constexpr: ajusta o
+   *                       divisor (setFrequency) e o módulo sem divisões.
+   */
+bool mkl_TPMDelay::startDelay(const mkl_TPMTiming &timing) {
+  return setFrequency(timing.div) && startDelay(timing.modulo);
+}
+
+  /*!
+   *   @fn       startDelay
+   *
+   *   @brief    Inicia um delay assíncrono com o divisor e o módulo de
+   *             "timing", que chama "callback" ao terminar.
+   */
+bool mkl_TPMDelay::startDelay(const mkl_TPMTiming &timing,
+                              mkl_TPMDelayCallback callback, void *context) {
+  return setFrequency(timing.div) &&
+         startDelay(timing.modulo, callback, context);
+}
+
+  /*!
+   *   @fn       waitDelay
+   *
+   *   @brief    Inicia um delay com o divisor e o módulo de "timing" e
+   *             aguarda o seu fim.
+   */
+bool mkl_TPMDelay::waitDelay(const mkl_TPMTiming &timing) {
+  return setFrequency(timing.div) && waitDelay(timing.modulo);
+}
+
+  /*!
+   *   @fn       handleInterrupt
+   *
+   *   @brief    Atende o estouro de um delay assíncrono do TPM.
+   *
+   *   Método que, com uma leitura e uma escrita do SC, apaga o TOF (w1c),
+   *   para o contador e desabilita a interrupção; em seguida chama a rotina
+   *   do delay. A rotina pode iniciar um novo delay no mesmo TPM. Na
+   *   temporização periódica, a escrita só apaga o TOF, e o contador
+   *   segue.
+   *
+   *   @param[in]  tpm - tpm_TPM0, tpm_TPM1 ou tpm_TPM2.
+   */
+void mkl_TPMDelay::handleInterrupt(tpm_TPMNumberMask tpm) {
+  mkl_TPMDelay *delay = delays[tpm >> 11];
+  uint32_t status;
+
+  if (!delay) {
+    return;
+  }
+  status = *delay->addressTPMxSC;
+  if (!(status & 0x80)) {
+    return;
+  }
+  if (delay->periodic && delay->pending) {
+    *delay->addressTPMxSC = status;
+  } else {
+    *delay->addressTPMxSC = status & ~(0x08 | TPM_SC_TOIE_MASK);
+    if (!delay->pending) {
+      return;
+    }
+    delay->pending = 0;
+  }
+  delay->callback(delay->context);
+}
+
+  /*!
+   *   @fn       timeoutDelay
+   *
+   *   @brief    Indica a ocorrência do término de temporização.
+   *
+   *   Método que indica se o tempo especificado pelo
+   *
+   *   @param[in]  divBase - constante de divisão do divisor de frequência.
+   */
+int mkl_TPMDelay::timeoutDelay() {
+  if (*addressTPMxSC & 0x80) {
+    return 1;
+  }
+  return 0;
+}
+
+  /*!
+   *   @fn       waitDelay
+   *
+   *   @brief    Inicia a operação do periférico TPM no modo delay.
+   *
+   *   Método que inicia um delay de duração especificada.
+   *
+   *   @param[in] cycles - número de ciclos de relógio da operação.
+   *
+   *   @details   Este método aguarda até que o valor de temporização desejado
+   *              se esgote.
+   *
+   *              O parâmetro "cycles" não corresponde ao tempo, em segundos,
+   *              da temporização iniciada.
+   *              A equação que relaciona o parâmetro "cycles" ao tempo,
+   *              em segundos, é dada por:
+   *
+   *              cycles = T*(20.97*10^6)/divBase,
+   *
+   *              onde:
+   *              - T       : tempo em segundos;
+   *              - divBase : fator de divisão configurado no método
+   *                          setFrequency;
+   *              - cycles  : ciclos de relógio.
+   *
+   *              Note o maior valor do parâmetro deverá ser de 65535, que
+   *              é o maior valor em decimal que se obtém com 16 bits.
+   *              65535 é o fundo de escala do registrador TPMCNT.
+   */
+bool mkl_TPMDelay::waitDelay(uint16_t cycles) {
+  if (!startDelay(cycles)) {
+    return false;
+  }
+  do {} while (timeoutDelay() != 1);
+  return true;
+}
+
+  /*!
+   *   @fn       cancelDelay
+   *
+   *   @brief    Cancela uma temporização em andamento.
+   *
+   *   Método que cancela uma temporização iniciada, parando o contador.
+   */
+void mkl_TPMDelay::cancelDelay() {
+  /*!
+  * Desabilita a contagem e a interrupção do delay assíncrono.
+  */
+  *addressTPMxSC &= ~(0x08 | TPM_SC_TOIE_MASK);
+  pending = 0;
+}
+
+  /*!
+   *   @fn       getCounter
+   *
+   *   @brief    Método que informa o valor atual da contagem.
+   *
+   *   Método que informa o valor atual do contador do temporizador.
+   *
+   *   @param[in]  value - variável passada por referência que será atualizada
+   *                       com o valor corrente do contador do temporizador.
+   */
+void mkl_TPMDelay::getCounter(uint16_t *value) {
+  *value = *addressTPMxCNT;
+}
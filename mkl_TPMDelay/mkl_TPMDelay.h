@@ -1,89 +1,163 @@
-/*!
- * @copyright    2017 Universidade Federal do Amazonas.
- *
- * @brief       API em C++ para o perifrico TPM, no modo delay.
- *
- * @file        mkl_TPMDelay.h
- * @version     1.0
- * @date        31 Julho 2017
- *
- * @section     HARDWARES & SOFTWARES
- *              +board        FRDM-KL25Z da NXP.
- *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
- *              +compiler     Kinetis Design Studio IDE.
- *              +manual       L25P80M48SF0RM, Rev.3, September 2012.
- *              +revisions    Verso (data): Descrio breve.
- *                             ++ 1.0 (6 Julho 2017): Verso inicial.
- *
- * @section     AUTHORS & DEVELOPERS
- *              +institution  Universidade Federal do Amazonas.
- *              +courses      Engenharia da Computao / Engenharia Eltrica.
- *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
- *              +student      Verso inicial:
- *                             ++ Hamilton Nascimento <hdan_neto@hotmail.com>
- *
- * @section     LICENSE
- *
- *              GNU General Public License (GNU GPL).
- *
- *              Este programa  um software livre; Voc pode redistribu-lo
- *              e/ou modific-lo de acordo com os termos do "GNU General Public
- *              License" como publicado pela Free Software Foundation; Seja a
- *              verso 3 da licena, ou qualquer verso posterior.
- *
- *              Este programa  distribudo na esperana de que seja til,
- *              mas SEM QUALQUER GARANTIA; Sem a garantia implcita de
- *              COMERCIALIZAO OU USO PARA UM DETERMINADO PROPSITO.
- *              Veja o site da "GNU General Public License" para mais detalhes.
- *
- * @htmlonly    http://www.gnu.org/copyleft/gpl.html
- */
-
-#ifndef MKL_DELAY_OCP
-#define MKL_DELAY_OCP
-
-#include <stdint.h>
-#include <MKL25Z4.h>
-#include "mkl_TPM/mkl_TPM.h"
-
-/*!
- *  @class    mkl_TPMDelay.
- *
- *  @brief    A classe implementa o modo de operao delay, do perifrico TPM.
- *
- *  @details  Esta classe  derivada da classe me "dsf_TPMPeripheral_ocp" e
- *            implementa o modo de operao delay, podendo o usurio escolher
- *            entre um delay que "prende" e um delay que "no prende".
- *
- *
- */
-class mkl_TPMDelay : public mkl_TPM {
- public:
-  /*!
-   * Construtor padro da classe.
-   */
-  explicit mkl_TPMDelay(tpm_TPMNumberMask pin);
-  /*!
-   * Mtodo de configurao da classe.
-   */
-  void setFrequency(tpm_Div divBase);
-
-  /*!
-   * Mtodos de inicializao de temporizao.
-   */
-  void waitDelay(uint16_t cycles);
-  void startDelay(uint16_t cycles);
-
-  /*!
-   * Mtodos de checagem da temporizao.
-   */
-  int timeoutDelay();
-  void getCounter(uint16_t *value);
-
-  /*!
-   * Mtodo de cancelamento de temporizao.
-   */
-  void cancelDelay();
-};
-
-#endif
+/*!
+ * @copyright   © 2017 Universidade Federal do Amazonas.
+ *
+ * @brief       API em C++ para o periférico TPM, no modo delay.
+ *
+ * @file        mkl_TPMDelay.h
+ * @version     1.4
+ * @date        31 Julho 2017
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +compiler     Kinetis® Design Studio IDE.
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012.
+ *              +revisions    Versão (data): Descrição breve.
+ *                             ++ 1.0 (6 Julho 2017): Versão inicial.
+ *                             ++ 1.1 (17 Outubro 2026): Delay assíncrono, com rotina chamada na interrupção do TPM.
+ *                             ++ 1.2 (17 Outubro 2026): waitDelay e startDelay com um mkl_TPMTiming, calculado de uma duração do std::chrono.
+ *                             ++ 1.3 (17 Outubro 2026): startPeriodic: temporização periódica com o contador livre.
+ *                             ++ 1.4 (17 Outubro 2026): Os métodos de temporização reservam o TPM (claimPeripheral) e retornam false se ele é de outro driver.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas.
+ *              +courses      Engenharia da Computação / Engenharia Elétrica.
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Versão inicial:
+ *                             ++ Hamilton Nascimento <hdan_neto@hotmail.com>
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ *              Este programa é um software livre; Você pode redistribuí-lo
+ *              e/ou modificá-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              versão 3 da licença, ou qualquer versão posterior.
+ *
+ *              Este programa é distribuído na esperança de que seja útil,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implícita de
+ *              COMERCIALIZAÇÃO OU USO PARA UM DETERMINADO PROPÓSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#ifndef MKL_DELAY_OCP
+#define MKL_DELAY_OCP
+
+#include <stdint.h>
+#include <MKL25Z4.h>
+#include "mkl_TPM/mkl_TPM.h"
+
+/*!
+ *  Rotina chamada na interrupção do TPM, ao fim de um delay assíncrono.
+ */
+typedef void (*mkl_TPMDelayCallback)(void *context);
+
+/*!
+ *  @class    mkl_TPMDelay.
+ *
+ *  @brief    A classe implementa o modo de operação delay, do periférico TPM.
+ *
+ *  @details  Esta classe é derivada da classe mãe "dsf_TPMPeripheral_ocp" e
+ *            implementa o modo de operação delay, podendo o usuário escolher
+ *            entre um delay que "prende" e um delay que "não prende".
+ *
+ *            O delay assíncrono, startDelay(cycles, callback, context),
+ *            retorna logo após armar o contador; o estouro (TOF) gera a
+ *            interrupção do TPM, que para o contador e chama a rotina. A
+ *            rotina TPMx_IRQHandler deve chamar handleInterrupt(tpm_TPMx).
+ *            Cada TPM tem o seu próprio contador: até três delays
+ *            assíncronos simultâneos, um por TPM, enquanto a CPU dorme ou
+ *            executa outras tarefas. startPeriodic deixa o contador livre
+ *            e chama a rotina a cada estouro, até cancelDelay. Como a
+ *            interrupção apaga o TOF, o término do delay assíncrono é
+ *            consultado em isPending, e não em timeoutDelay.
+ *
+ *            A rotina é chamada com a interrupção em curso: deve ser curta,
+ *            por exemplo postar uma mkl_Task, e pode iniciar um novo delay
+ *            no mesmo TPM.
+ *
+ *            setFrequency e os métodos de temporização reservam o TPM para
+ *            o objeto (mkl_TPM::claimPeripheral) e retornam false, sem
+ *            tocar no TPM, se ele é de um PWM, de uma captura ou de outro
+ *            delay.
+ *
+ *  @section  EXAMPLES USAGE
+ *
+ *            Debounce de 30 ms sem prender o laço principal; o divisor
+ *            (tpm_div16) e o módulo (39321) são calculados na compilação.
+ *             +fn mkl_TPMDelay delay(tpm_TPM2);
+ *             +fn constexpr mkl_TPMTiming kDebounce =
+ *                   mkl_TPMTiming::from(std::chrono::milliseconds(30));
+ *             +fn delay.startDelay(kDebounce, mkl_Scheduler::postTask,
+ *                                  &keyTask);
+ *             +fn void TPM2_IRQHandler() {
+ *                   mkl_TPMDelay::handleInterrupt(tpm_TPM2); }
+ */
+class mkl_TPMDelay : public mkl_TPM {
+ public:
+  /*!
+   * Construtor padrão da classe.
+   */
+  explicit mkl_TPMDelay(tpm_TPMNumberMask pin);
+  /*!
+   * Método de configuração da classe.
+   */
+  bool setFrequency(tpm_Div divBase);
+
+  /*!
+   * Métodos de inicialização de temporização.
+   */
+  bool waitDelay(uint16_t cycles);
+  bool startDelay(uint16_t cycles);
+  bool startDelay(uint16_t cycles, mkl_TPMDelayCallback callback,
+                  void *context = 0);
+
+  /*!
+   * Métodos de temporização com divisor e módulo já calculados.
+   */
+  bool waitDelay(const mkl_TPMTiming &timing);
+  bool startDelay(const mkl_TPMTiming &timing);
+  bool startDelay(const mkl_TPMTiming &timing, mkl_TPMDelayCallback callback,
+                  void *context = 0);
+
+  /*!
+   * Métodos de temporização periódica, com a rotina chamada a cada estouro.
+   */
+  bool startPeriodic(uint16_t cycles, mkl_TPMDelayCallback callback,
+                     void *context = 0);
+  bool startPeriodic(const mkl_TPMTiming &timing,
+                     mkl_TPMDelayCallback callback, void *context = 0);
+
+  /*!
+   * Métodos de checagem da temporização.
+   */
+  int timeoutDelay();
+  void getCounter(uint16_t *value);
+  bool isPending() const { return pending != 0; }
+
+  /*!
+   * Método de cancelamento de temporização.
+   */
+  void cancelDelay();
+
+  /*!
+   * Método de atendimento da interrupção, chamado em TPMx_IRQHandler.
+   */
+  static void handleInterrupt(tpm_TPMNumberMask tpm);
+
+ private:
+  static mkl_TPMDelay *delays[3];
+  uint8_t TPMNumber;
+  mkl_TPMDelayCallback callback;
+  void *context;
+  bool periodic;
+  volatile uint8_t pending;
+
+  bool arm(uint16_t cycles, mkl_TPMDelayCallback callback, void *context,
+           bool periodic);
+};
+
+#endif
@@ -0,0 +1,255 @@
+/*!
+ * @copyright   © 2017 UFAM - Universidade Federal do Amazonas.
+ *
+ * @brief       Implementação da classe de captura de entrada (input capture) do TPM.
+ *
+ * @file        mkl_TPMInputCapture.cpp
+ * @version     1.1
+ * @date        17 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   TPM (Timer/PWM Module).
+ *              +compiler     Kinetis® Design Studio IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão (data): Descrição breve.
+ *                             ++ 1.0 (17 Outubro 2026): Versão inicial.
+ *                             ++ 1.1 (17 Outubro 2026): setFrequency e enableCapture reservam o TPM (claimPeripheral).
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas
+ *              +courses      Engenharia da Computação
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Versão inicial:
+ *                             ++ Patrick Chagas dos Santos <patrick.chagas@gmail.com>
+ *                             ++ Gabriel Montenegro Villacrez <gvmontenegro19@gmail.com>
+ *                             ++ Andrezza Bonfim <andrezzabonfiiim@gmail.com>
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ *              Este programa é um software livre; Você pode redistribuí-lo
+ *              e/ou modificá-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              versão 3 da licença, ou qualquer versão posterior.
+ *
+ *              Este programa é distribuído na esperança de que seja útil,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implícita de
+ *              COMERCIALIZAÇÃO OU USO PARA UM DETERMINADO PROPÓSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include "mkl_TPMInputCapture.h"
+
+mkl_TPMInputCapture *mkl_TPMInputCapture::channels[3][6];
+uint16_t mkl_TPMInputCapture::overflows[3];
+
+/*!
+ *  Chave comum dos canais de captura na reserva do TPM.
+ */
+static const uint8_t captureOwner = 0;
+
+/*!
+ *   @fn         mkl_TPMInputCapture
+ *
+ *   @brief      Construtor padrão da classe.
+ *
+ *   O construtor obtém do pino os números do GPIO, do canal e do TPM,
+ *   associa o objeto aos registradores do TPM e do canal, habilita os
+ *   clocks e seleciona a alternativa do mux do pino ligada ao canal.
+ *
+ *   @param[in]  pin - pino do canal do TPM.
+ */
+mkl_TPMInputCapture::mkl_TPMInputCapture(tpm_Pin pin)
+    : tickHz(TPM_CLOCK), lastStamp(0), hasLast(false), head(0), tail(0),
+      overruns(0) {
+  uint8_t pinNumber;
+  uint8_t GPIONumber;
+  uint8_t muxAlt;
+  uint8_t *baseAddress;
+
+  setTPMParameters(pin, pinNumber, GPIONumber, chnNumber, TPMNumber, muxAlt);
+  setBaseAddress(TPMNumber, &baseAddress);
+  bindPeripheral(baseAddress);
+  bindChannel(baseAddress, chnNumber);
+  bindPin(GPIONumber, pinNumber);
+  enablePeripheralClock(TPMNumber);
+  enableGPIOClock(GPIONumber);
+  selectMuxAlternative(muxAlt);
+}
+
+/*!
+ *   @fn         setFrequency
+ *
+ *   @brief      Põe o contador do TPM livre (MOD = 0xFFFF), com a
+ *               interrupção de estouro, na frequência TPM_CLOCK/divBase.
+ *
+ *   @param[in]  divBase - fator de divisão do divisor de frequência.
+ *
+ *   @remarks    Sigla e pagina do Manual de Referencia KL25:
+ *               - TPMxSC: Status Control Register. Pág. 552.
+ *               - TPMxMOD: Modulo Register. Pág. 554.
+ */
+bool mkl_TPMInputCapture::setFrequency(tpm_Div divBase) {
+  if (!claimPeripheral(&captureOwner)) {
+    return false;
+  }
+  tickHz = TPM_CLOCK >> divBase;
+  *addressTPMxSC = 0;
+  *addressTPMxCNT = 0;
+  *addressTPMxMOD = 0xFFFF;
+  *addressTPMxSC = TPM_SC_TOF_MASK | TPM_SC_TOIE_MASK | TPM_SC_CMOD(1)
+                   | divBase;
+  NVIC_EnableIRQ(static_cast<IRQn_Type>(TPM0_IRQn + TPMNumber));
+  return true;
+}
+
+/*!
+ *   @fn         enableCapture
+ *
+ *   @brief      Coloca o canal em captura na borda escolhida, com
+ *               interrupção.
+ *
+ *   @param[in]  edge - tpm_rising, tpm_falling ou tpm_both.
+ *
+ *   @remarks    Sigla e pagina do Manual de Referencia KL25:
+ *               - TPMxCnSC: Channel Status Control Register. Pág.555.
+ */
+bool mkl_TPMInputCapture::enableCapture(tpm_Edge edge) {
+  uint32_t elsMask;
+
+  if (!claimPeripheral(&captureOwner)) {
+    return false;
+  }
+
+  /*!
+   * ELSB:ELSA = 01 na subida, 10 na descida e 11 nas duas.
+   */
+  if (edge == tpm_rising) {
+    elsMask = TPM_CnSC_ELSA_MASK;
+  } else if (edge == tpm_falling) {
+    elsMask = TPM_CnSC_ELSB_MASK;
+  } else {
+    elsMask = TPM_CnSC_ELSA_MASK | TPM_CnSC_ELSB_MASK;
+  }
+  hasLast = false;
+  channels[TPMNumber][chnNumber] = this;
+  *addressTPMxCnSC = 0;
+  *addressTPMxCnSC = TPM_CnSC_CHF_MASK | TPM_CnSC_CHIE_MASK | elsMask;
+  return true;
+}
+
+/*!
+ *   @fn         disableCapture
+ *
+ *   @brief      Desliga a captura do canal.
+ */
+void mkl_TPMInputCapture::disableCapture() {
+  *addressTPMxCnSC = 0;
+  channels[TPMNumber][chnNumber] = 0;
+}
+
+/*!
+ *   @fn         readPeriods
+ *
+ *   @brief      Retira do buffer até "max" períodos, do mais antigo ao mais
+ *               novo, em contagens do TPM.
+ *
+ *   @return     O número de períodos copiados.
+ */
+uint8_t mkl_TPMInputCapture::readPeriods(uint32_t *periods, uint8_t max) {
+  uint8_t count = 0;
+  uint8_t index = tail;
+
+  while (count < max && index != head) {
+    periods[count++] = this->periods[index];
+    index = (index + 1) & (kBufferSize - 1);
+  }
+  tail = index;
+  return count;
+}
+
+/*!
+ *   @fn         readOverruns
+ *
+ *   @brief      Retorna o número acumulado de períodos perdidos com o
+ *               buffer cheio (módulo 256).
+ */
+uint8_t mkl_TPMInputCapture::readOverruns() {
+  return overruns;
+}
+
+/*!
+ *   @fn         toCentiHertz
+ *
+ *   @brief      Converte um período, em contagens, para a frequência em
+ *               centésimos de Hz, só com aritmética de 32 bits.
+ */
+uint32_t mkl_TPMInputCapture::toCentiHertz(uint32_t period) {
+  if (period == 0) {
+    return 0;
+  }
+  return (tickHz*100 + period/2)/period;
+}
+
+/*!
+ *   @fn         handleInterrupt
+ *
+ *   @brief      Atende o estouro e as capturas de um TPM.
+ *
+ *   As flags são lidas e apagadas (w1c) com um load e um store no STATUS.
+ *
+ *   @param[in]  tpm - tpm_TPM0, tpm_TPM1 ou tpm_TPM2.
+ *
+ *   @remarks    Sigla e pagina do Manual de Referencia KL25:
+ *               - TPMxSTATUS: Capture and Compare Status. Pág. 558.
+ *               - TPMxCnV: Channel Value Register. Pág.557.
+ */
+void mkl_TPMInputCapture::handleInterrupt(tpm_TPMNumberMask tpm) {
+  uint8_t n = tpm >> 11;
+  TPM_Type *regs = (TPM_Type *)(TPM0_BASE + 0x1000*n);
+  uint32_t status = regs->STATUS;
+  bool overflow = (status & TPM_STATUS_TOF_MASK) != 0;
+
+  regs->STATUS = status;
+  for (uint8_t ch = 0; ch < 6; ch++) {
+    mkl_TPMInputCapture *channel = channels[n][ch];
+    if (!(status & (1u << ch)) || !channel) {
+      continue;
+    }
+    uint16_t value = regs->CONTROLS[ch].CnV;
+    uint16_t high = overflows[n];
+    if (overflow && value < 0x8000) {
+      high++;
+    }
+    channel->record(((uint32_t)high << 16) | value);
+  }
+  if (overflow) {
+    overflows[n]++;
+  }
+}
+
+/*!
+ *   @fn         record
+ *
+ *   @brief      Põe no buffer o período desde a marca anterior.
+ *
+ *   O período é escrito antes do avanço do "head", que o publica.
+ */
+void mkl_TPMInputCapture::record(uint32_t stamp) {
+  if (hasLast) {
+    uint8_t next = (head + 1) & (kBufferSize - 1);
+    if (next == tail) {
+      overruns++;
+    } else {
+      periods[head] = stamp - lastStamp;
+      head = next;
+    }
+  }
+  lastStamp = stamp;
+  hasLast = true;
+}
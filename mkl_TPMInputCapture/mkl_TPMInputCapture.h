@@ -0,0 +1,148 @@
+/*!
+ * @copyright   © 2017 UFAM - Universidade Federal do Amazonas.
+ *
+ * @brief       Interface da classe de captura de entrada (input capture) do TPM.
+ *
+ * @file        mkl_TPMInputCapture.h
+ * @version     1.1
+ * @date        17 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   TPM (Timer/PWM Module).
+ *              +compiler     Kinetis® Design Studio IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão (data): Descrição breve.
+ *                             ++ 1.0 (17 Outubro 2026): Versão inicial.
+ *                             ++ 1.1 (17 Outubro 2026): setFrequency e enableCapture reservam o TPM (claimPeripheral).
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas
+ *              +courses      Engenharia da Computação
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Versão inicial:
+ *                             ++ Patrick Chagas dos Santos <patrick.chagas@gmail.com>
+ *                             ++ Gabriel Montenegro Villacrez <gvmontenegro19@gmail.com>
+ *                             ++ Andrezza Bonfim <andrezzabonfiiim@gmail.com>
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ *              Este programa é um software livre; Você pode redistribuí-lo
+ *              e/ou modificá-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              versão 3 da licença, ou qualquer versão posterior.
+ *
+ *              Este programa é distribuído na esperança de que seja útil,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implícita de
+ *              COMERCIALIZAÇÃO OU USO PARA UM DETERMINADO PROPÓSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#ifndef MKL_TPMINPUTCAPTURE_H_
+#define MKL_TPMINPUTCAPTURE_H_
+
+#include <stdint.h>
+#include <MKL25Z4.h>
+#include "mkl_TPM/mkl_TPM.h"
+
+/*!
+ *  @class    mkl_TPMInputCapture.
+ *
+ *  @brief    A classe implementa o modo de captura de entrada de um canal
+ *            do periférico TPM, para medir período e frequência.
+ *
+ *  @details  Esta classe é derivada da classe mãe "mkl_TPM". A borda é
+ *            marcada pelo hardware: o TPM copia o contador para o CnV, sem
+ *            atraso de software. O contador do TPM roda livre (MOD =
+ *            0xFFFF) e os seus estouros (TOF) são contados na interrupção,
+ *            estendendo as marcas para 32 bits: períodos de até 2^32
+ *            contagens, 204 s com tpm_div1.
+ *
+ *            A rotina TPMx_IRQHandler deve chamar handleInterrupt(tpm_TPMx),
+ *            que atende, com uma leitura e uma escrita do STATUS, o estouro
+ *            e as capturas de todos os canais do TPM. Uma captura com CnV
+ *            pequeno e o TOF ainda pendente ocorreu após o estouro e recebe
+ *            a contagem seguinte.
+ *
+ *            O período entre duas bordas seguidas é posto em um buffer
+ *            circular de kBufferSize entradas: a interrupção escreve só o
+ *            índice "head" e a aplicação só o "tail" (um produtor e um
+ *            consumidor, sem trava). readPeriods lê os períodos em lote;
+ *            com o buffer cheio, os novos períodos são descartados e
+ *            contados em readOverruns.
+ *
+ *            setFrequency configura o contador, compartilhado pelos canais
+ *            do TPM: o TPM não pode ser usado ao mesmo tempo pelo
+ *            mkl_TPMDelay ou pelo mkl_TPMPulseWidthModulation. setFrequency
+ *            e enableCapture reservam o TPM para a captura
+ *            (mkl_TPM::claimPeripheral) e retornam false, sem tocar no
+ *            TPM, se ele é de outro driver.
+ *
+ *  @section  EXAMPLES USAGE
+ *
+ *            Tacômetro do ventilador no TPM1, canal 0.
+ *             +fn mkl_TPMInputCapture tach(tpm_PTA12);
+ *             +fn tach.setFrequency(tpm_div16);
+ *             +fn tach.enableCapture(tpm_rising);
+ *             +fn void TPM1_IRQHandler() {
+ *                   mkl_TPMInputCapture::handleInterrupt(tpm_TPM1); }
+ *             +fn n = tach.readPeriods(periods, 8);
+ *             +fn hz100 = tach.toCentiHertz(periods[n - 1]);
+ */
+class mkl_TPMInputCapture : public mkl_TPM {
+ public:
+  static const uint8_t kBufferSize = 16;
+
+  /*!
+   * Construtor padrão da classe.
+   */
+  explicit mkl_TPMInputCapture(tpm_Pin pin = tpm_PTA12);
+  /*!
+   * Métodos de configuração do contador e do canal.
+   */
+  bool setFrequency(tpm_Div divBase);
+  bool enableCapture(tpm_Edge edge);
+  void disableCapture();
+  /*!
+   * Métodos de leitura das medidas.
+   */
+  uint8_t readPeriods(uint32_t *periods, uint8_t max);
+  uint8_t readOverruns();
+  uint32_t toCentiHertz(uint32_t period);
+  /*!
+   * Método da rotina de serviço de interrupção do TPM.
+   */
+  static void handleInterrupt(tpm_TPMNumberMask tpm);
+
+ private:
+  uint8_t TPMNumber;
+  uint8_t chnNumber;
+  uint32_t tickHz;
+  /*!
+   * Última marca de tempo, estendida para 32 bits.
+   */
+  uint32_t lastStamp;
+  bool hasLast;
+  /*!
+   * Buffer circular dos períodos.
+   */
+  volatile uint32_t periods[kBufferSize];
+  volatile uint8_t head;
+  volatile uint8_t tail;
+  volatile uint8_t overruns;
+
+  void record(uint32_t stamp);
+
+  /*!
+   * Canais em captura e contagem de estouros de cada TPM.
+   */
+  static mkl_TPMInputCapture *channels[3][6];
+  static uint16_t overflows[3];
+};
+
+#endif  //  MKL_TPMINPUTCAPTURE_H_
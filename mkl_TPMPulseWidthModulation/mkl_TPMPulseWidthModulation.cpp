@@ -0,0 +1,176 @@
+/*!
+ * @copyright   © 2017 UFAM - Universidade Federal do Amazonas.
+ *
+ * @brief       Implementação da classe de modulação por largura de pulso (PWM) do TPM.
+ *
+ * @file        mkl_TPMPulseWidthModulation.cpp
+ * @version     1.1
+ * @date        17 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   TPM (Timer/PWM Module).
+ *              +compiler     Kinetis® Design Studio IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão (data): Descrição breve.
+ *                             ++ 1.0 (17 Outubro 2026): Versão inicial.
+ *                             ++ 1.1 (17 Outubro 2026): setFrequency e enableOutput reservam o TPM (claimPeripheral).
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas
+ *              +courses      Engenharia da Computação
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Versão inicial:
+ *                             ++ Patrick Chagas dos Santos <patrick.chagas@gmail.com>
+ *                             ++ Gabriel Montenegro Villacrez <gvmontenegro19@gmail.com>
+ *                             ++ Andrezza Bonfim <andrezzabonfiiim@gmail.com>
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ *              Este programa é um software livre; Você pode redistribuí-lo
+ *              e/ou modificá-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              versão 3 da licença, ou qualquer versão posterior.
+ *
+ *              Este programa é distribuído na esperança de que seja útil,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implícita de
+ *              COMERCIALIZAÇÃO OU USO PARA UM DETERMINADO PROPÓSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include "mkl_TPMPulseWidthModulation.h"
+
+/*!
+ *  Chave comum dos canais PWM na reserva do TPM.
+ */
+static const uint8_t pwmOwner = 0;
+
+/*!
+ *   @fn         mkl_TPMPulseWidthModulation
+ *
+ *   @brief      Construtor padrão da classe.
+ *
+ *   O construtor obtém do pino os números do GPIO, do canal e do TPM,
+ *   associa o objeto aos registradores do TPM e do canal, habilita os
+ *   clocks e seleciona a alternativa do mux do pino ligada ao canal.
+ *
+ *   @param[in]  pin - pino do canal do TPM.
+ */
+mkl_TPMPulseWidthModulation::mkl_TPMPulseWidthModulation(tpm_Pin pin) {
+  uint8_t pinNumber;
+  uint8_t GPIONumber;
+  uint8_t chnNumber;
+  uint8_t TPMNumber;
+  uint8_t muxAlt;
+  uint8_t *baseAddress;
+
+  setTPMParameters(pin, pinNumber, GPIONumber, chnNumber, TPMNumber, muxAlt);
+  setBaseAddress(TPMNumber, &baseAddress);
+  bindPeripheral(baseAddress);
+  bindChannel(baseAddress, chnNumber);
+  bindPin(GPIONumber, pinNumber);
+  enablePeripheralClock(TPMNumber);
+  enableGPIOClock(GPIONumber);
+  selectMuxAlternative(muxAlt);
+}
+
+/*!
+ *   @fn         setFrequency
+ *
+ *   @brief      Ajusta o período do PWM, comum aos canais do TPM.
+ *
+ *   O contador é parado antes da troca do divisor e do alinhamento (o
+ *   TPMxSC só aceita a troca com CMOD = 0), zerado e religado.
+ *
+ *   @param[in]  divBase - fator de divisão do divisor de frequência.
+ *               modulo - fundo de escala do contador (MOD).
+ *               alignment - tpm_edgeAligned ou tpm_centerAligned.
+ *
+ *   @remarks    Sigla e pagina do Manual de Referencia KL25:
+ *               - TPMxSC: Status Control Register. Pág. 552.
+ *               - TPMxCNT: Counter Register. Pág.554.
+ *               - TPMxMOD: Modulo Register. Pág. 554.
+ */
+bool mkl_TPMPulseWidthModulation::setFrequency(tpm_Div divBase,
+                                               uint16_t modulo,
+                                               tpm_Alignment alignment) {
+  if (!claimPeripheral(&pwmOwner)) {
+    return false;
+  }
+  *addressTPMxSC = 0;
+  *addressTPMxCNT = 0;
+  *addressTPMxMOD = modulo;
+  *addressTPMxSC = alignment | TPM_SC_CMOD(1) | divBase;
+  return true;
+}
+
+/*!
+ *   @fn         enableOutput
+ *
+ *   @brief      Coloca o canal no modo PWM, com a polaridade escolhida.
+ *
+ *   O canal é desabilitado antes da troca de modo, como pede o manual.
+ *
+ *   @param[in]  polarity - tpm_highTrue (pulso em '1') ou tpm_lowTrue.
+ *
+ *   @remarks    Sigla e pagina do Manual de Referencia KL25:
+ *               - TPMxCnSC: Channel Status Control Register. Pág.555.
+ */
+bool mkl_TPMPulseWidthModulation::enableOutput(tpm_Polarity polarity) {
+  if (!claimPeripheral(&pwmOwner)) {
+    return false;
+  }
+  *addressTPMxCnSC = 0;
+  *addressTPMxCnSC = TPM_CnSC_MSB_MASK | polarity;
+  return true;
+}
+
+/*!
+ *   @fn         disableOutput
+ *
+ *   @brief      Desliga o canal: o pino deixa de ser acionado pelo TPM.
+ */
+void mkl_TPMPulseWidthModulation::disableOutput() {
+  *addressTPMxCnSC = 0;
+}
+
+/*!
+ *   @fn         setDutyCycle
+ *
+ *   @brief      Ajusta a largura do pulso, em contagens, com um store no
+ *               CnV.
+ *
+ *   Com o contador rodando, o novo valor vale a partir do próximo período.
+ *
+ *   @param[in]  width - largura do pulso: 0 a MOD + 1 contagens (0 a 100%).
+ *
+ *   @remarks    Sigla e pagina do Manual de Referencia KL25:
+ *               - TPMxCnV: Channel Value Register. Pág.557.
+ */
+void mkl_TPMPulseWidthModulation::setDutyCycle(uint16_t width) {
+  *addressTPMxCnV = width;
+}
+
+/*!
+ *   @fn         readDutyCycle
+ *
+ *   @brief      Retorna a largura do pulso lida do CnV.
+ */
+uint16_t mkl_TPMPulseWidthModulation::readDutyCycle() {
+  return *addressTPMxCnV;
+}
+
+/*!
+ *   @fn         readModulo
+ *
+ *   @brief      Retorna o fundo de escala do contador (MOD), para o
+ *               cálculo da largura em porcentagem.
+ */
+uint16_t mkl_TPMPulseWidthModulation::readModulo() {
+  return *addressTPMxMOD;
+}
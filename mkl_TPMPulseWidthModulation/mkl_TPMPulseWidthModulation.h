@@ -0,0 +1,125 @@
+/*!
+ * @copyright   © 2017 UFAM - Universidade Federal do Amazonas.
+ *
+ * @brief       Interface da classe de modulação por largura de pulso (PWM) do TPM.
+ *
+ * @file        mkl_TPMPulseWidthModulation.h
+ * @version     1.1
+ * @date        17 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   TPM (Timer/PWM Module).
+ *              +compiler     Kinetis® Design Studio IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão (data): Descrição breve.
+ *                             ++ 1.0 (17 Outubro 2026): Versão inicial.
+ *                             ++ 1.1 (17 Outubro 2026): setFrequency e enableOutput reservam o TPM (claimPeripheral).
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas
+ *              +courses      Engenharia da Computação
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Versão inicial:
+ *                             ++ Patrick Chagas dos Santos <patrick.chagas@gmail.com>
+ *                             ++ Gabriel Montenegro Villacrez <gvmontenegro19@gmail.com>
+ *                             ++ Andrezza Bonfim <andrezzabonfiiim@gmail.com>
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ *              Este programa é um software livre; Você pode redistribuí-lo
+ *              e/ou modificá-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              versão 3 da licença, ou qualquer versão posterior.
+ *
+ *              Este programa é distribuído na esperança de que seja útil,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implícita de
+ *              COMERCIALIZAÇÃO OU USO PARA UM DETERMINADO PROPÓSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#ifndef MKL_TPMPULSEWIDTHMODULATION_H_
+#define MKL_TPMPULSEWIDTHMODULATION_H_
+
+#include <stdint.h>
+#include <MKL25Z4.h>
+#include "mkl_TPM/mkl_TPM.h"
+
+/*!
+ * Enum associado ao alinhamento do pulso no período.
+ */
+typedef enum {
+  tpm_edgeAligned = 0,
+  tpm_centerAligned = TPM_SC_CPWMS_MASK
+}tpm_Alignment;
+
+/*!
+ * Enum associado ao nível ativo do pulso.
+ */
+typedef enum {
+  tpm_highTrue = TPM_CnSC_ELSB_MASK,
+  tpm_lowTrue = TPM_CnSC_ELSA_MASK
+}tpm_Polarity;
+
+/*!
+ *  @class    mkl_TPMPulseWidthModulation.
+ *
+ *  @brief    A classe implementa o modo PWM de um canal do periférico TPM.
+ *
+ *  @details  Esta classe é derivada da classe mãe "mkl_TPM". O pulso é
+ *            gerado pelo hardware, sem custo de CPU por período: um objeto
+ *            por canal, até 6 canais por TPM (TPM0) com o mesmo período.
+ *
+ *            setFrequency programa o divisor, o MOD e o alinhamento do
+ *            contador, compartilhados pelos canais do TPM: basta chamá-lo
+ *            em um dos canais, antes de habilitar as saídas. Os dois
+ *            reservam o TPM para o PWM (mkl_TPM::claimPeripheral) e
+ *            retornam false, sem tocar no TPM, se ele é de outro driver
+ *            (um mkl_TPMDelay, uma captura ou o mkl_TimerService).
+ *
+ *            Alinhado na borda, o período é (MOD + 1) contagens e a largura
+ *            do pulso é CnV contagens. Alinhado no centro, o período é
+ *            2*MOD contagens, a largura é 2*CnV e o pulso fica centrado no
+ *            início do período. CnV = 0 mantém a saída inativa, e
+ *            CnV > MOD a mantém ativa.
+ *
+ *            Sem glitches: com o contador rodando, a escrita do CnV
+ *            (setDutyCycle) e do MOD só é transferida ao comparador no fim
+ *            do período, e um período nunca mistura a largura antiga com a
+ *            nova.
+ *
+ *  @section  EXAMPLES USAGE
+ *
+ *            Ventilador a 20 kHz com 25% de ciclo ativo.
+ *             +fn mkl_TPMPulseWidthModulation fan(tpm_PTD4);
+ *             +fn fan.setFrequency(tpm_div1, 1047);   // 20,97 MHz/1048
+ *             +fn fan.enableOutput(tpm_highTrue);
+ *             +fn fan.setDutyCycle(262);
+ */
+class mkl_TPMPulseWidthModulation : public mkl_TPM {
+ public:
+  /*!
+   * Construtor padrão da classe.
+   */
+  explicit mkl_TPMPulseWidthModulation(tpm_Pin pin = tpm_PTD4);
+  /*!
+   * Métodos de configuração do período e da saída.
+   */
+  bool setFrequency(tpm_Div divBase, uint16_t modulo,
+                    tpm_Alignment alignment = tpm_edgeAligned);
+  bool enableOutput(tpm_Polarity polarity = tpm_highTrue);
+  void disableOutput();
+  /*!
+   * Métodos de ajuste e leitura da largura do pulso.
+   */
+  void setDutyCycle(uint16_t width);
+  uint16_t readDutyCycle();
+  uint16_t readModulo();
+};
+
+#endif  //  MKL_TPMPULSEWIDTHMODULATION_H_
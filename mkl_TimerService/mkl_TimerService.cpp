@@ -0,0 +1,390 @@
+/*!
+ * @copyright   © 2017 UFAM - Universidade Federal do Amazonas.
+ *
+ * @brief       Serviço de temporizadores virtuais sobre os canais do PIT e os TPM0, TPM1 e TPM2.
+ *
+ * @file        mkl_TimerService.cpp
+ * @version     1.2
+ * @date        17 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   PIT (canais 0 e 1) e TPM (TPM0, TPM1 e TPM2).
+ *              +compiler     Kinetis® Design Studio IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão (data): Descrição breve.
+ *                             ++ 1.0 (17 Outubro 2026): Versão inicial.
+ *                             ++ 1.1 (17 Outubro 2026): Reserva dos canais do PIT (mkl_PIT::claimChannel); start retorna false com o canal do tick ocupado.
+ *                             ++ 1.2 (17 Outubro 2026): Reserva dos TPM (claimPeripheral); start recusa o canal 0 com o canal 1 encadeado.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas
+ *              +courses      Engenharia da Computação
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Versão inicial:
+ *                             ++ Patrick Chagas dos Santos <patrick.chagas@gmail.com>
+ *                             ++ Gabriel Montenegro Villacrez <gvmontenegro19@gmail.com>
+ *                             ++ Andrezza Bonfim <andrezzabonfiiim@gmail.com>
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ *              Este programa é um software livre; Você pode redistribuí-lo
+ *              e/ou modificá-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              versão 3 da licença, ou qualquer versão posterior.
+ *
+ *              Este programa é distribuído na esperança de que seja útil,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implícita de
+ *              COMERCIALIZAÇÃO OU USO PARA UM DETERMINADO PROPÓSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include "mkl_TimerService.h"
+#include <MKL25Z4.h>
+
+/*!
+ *   @fn         mkl_VirtualTimer
+ *
+ *   @brief      Cria o temporizador fechado, sem recurso.
+ */
+mkl_VirtualTimer::mkl_VirtualTimer()
+    : callback(0), context(0), resource(timer_none), reload(0),
+      div(tpm_div1), resolutionNs(0), errorNs(0), periodic(false),
+      active(false) {
+}
+
+/*!
+ *   @fn         setCallback
+ *
+ *   @brief      Define a rotina chamada, na interrupção, a cada estouro.
+ */
+void mkl_VirtualTimer::setCallback(mkl_TimerCallback callback,
+                                   void *context) {
+  this->callback = callback;
+  this->context = context;
+  soft.setCallback(callback, context);
+}
+
+/*!
+ *   @fn         isActive
+ *
+ *   @brief      Indica se o temporizador está em contagem.
+ */
+bool mkl_VirtualTimer::isActive() const {
+  if (resource == timer_shared) {
+    return soft.isActive();
+  }
+  return active;
+}
+
+/*!
+ *   @fn         mkl_TimerService
+ *
+ *   @brief      Associa o tick compartilhado ao canal "tickChannel" do PIT;
+ *               o outro canal e os três TPM ficam livres.
+ */
+mkl_TimerService::mkl_TimerService(PIT_ChPIT tickChannel)
+    : wheel(tickChannel),
+      pit(tickChannel == PIT_Ch0 ? PIT_Ch1 : PIT_Ch0),
+      tpms{mkl_TPMDelay(tpm_TPM0), mkl_TPMDelay(tpm_TPM1),
+           mkl_TPMDelay(tpm_TPM2)},
+      owners(),
+      pitResource(tickChannel == PIT_Ch0 ? timer_PIT1 : timer_PIT0),
+      busy(1 << (tickChannel == PIT_Ch0 ? timer_PIT0 : timer_PIT1)),
+      tickNs(0) {
+}
+
+/*!
+ *   @fn         start
+ *
+ *   @brief      Inicia o tick compartilhado, de "tickHz" Hz, em modo sem tick.
+ *
+ *   @return     false se o canal do tick já foi reservado por outro driver,
+ *               ou se é o canal 0 e o canal 1 está encadeado a ele; o
+ *               serviço fica parado e openTimer retorna timer_none.
+ */
+bool mkl_TimerService::start(uint32_t tickHz) {
+  if (pitResource == timer_PIT1 &&
+      (PIT->CHANNEL[1].TCTRL & PIT_TCTRL_CHN_MASK)) {
+    return false;
+  }
+  if (!wheel.startTickless(tickHz)) {
+    return false;
+  }
+  tickNs = (1000000000u + tickHz/2)/tickHz;
+  return true;
+}
+
+/*!
+ *   @fn         reserve
+ *
+ *   @brief      Retira do serviço um recurso usado por outro driver.
+ */
+void mkl_TimerService::reserve(timer_Resource resource) {
+  if (resource < timer_shared) {
+    busy |= 1 << resource;
+  }
+}
+
+/*!
+ *   @fn         openTimer
+ *
+ *   @brief      Escolhe o recurso do temporizador e calcula a sua recarga.
+ *
+ *   @param[in]  periodNs     - período (ou duração), em nanossegundos.
+ *   @param[in]  resolutionNs - maior resolução aceitável, em nanossegundos.
+ *
+ *   @return     O recurso escolhido; timer_shared também quando não há
+ *               recurso dedicado livre que atenda a resolução, e timer_none
+ *               antes de start().
+ *
+ *   Um temporizador já aberto é fechado antes, liberando o seu recurso.
+ */
+timer_Resource mkl_TimerService::openTimer(mkl_VirtualTimer &timer,
+                                           uint64_t periodNs,
+                                           uint32_t resolutionNs) {
+  closeTimer(timer);
+  if (!tickNs) {
+    return timer_none;
+  }
+  if (resolutionNs >= tickNs) {
+    return openShared(timer, periodNs);
+  }
+
+  mkl_TPMTiming tpmTiming =
+      mkl_TPMTiming::from(std::chrono::nanoseconds(periodNs));
+  uint32_t tpmResolution =
+      mkl_Duration::ticksToNanoseconds(1, TPM_CLOCK, tpmTiming.div);
+  if (tpmTiming.errorNs != mkl_TPMTiming::kOutOfRange &&
+      tpmResolution <= resolutionNs) {
+    for (uint8_t r = timer_TPM0; r <= timer_TPM2; r++) {
+      mkl_TPMDelay &tpm = tpms[r - timer_TPM0];
+      if (isFree((timer_Resource)r) && tpm.claimPeripheral(&tpm)) {
+        timer.reload = tpmTiming.modulo;
+        timer.div = tpmTiming.div;
+        timer.resolutionNs = tpmResolution;
+        timer.errorNs = tpmTiming.errorNs;
+        take(timer, (timer_Resource)r);
+        return timer.resource;
+      }
+    }
+  }
+
+  mkl_PITTiming pitTiming =
+      mkl_PITTiming::from(std::chrono::nanoseconds(periodNs));
+  uint32_t pitResolution =
+      mkl_Duration::ticksToNanoseconds(1, PIT_BUS_CLOCK, 0);
+  if (pitTiming.errorNs != mkl_PITTiming::kOutOfRange &&
+      pitResolution <= resolutionNs && isFree(pitResource) &&
+      pit.claimChannel()) {
+    timer.reload = pitTiming.ldval;
+    timer.resolutionNs = pitResolution;
+    timer.errorNs = pitTiming.errorNs;
+    take(timer, pitResource);
+    return timer.resource;
+  }
+
+  return openShared(timer, periodNs);
+}
+
+/*!
+ *   @fn         closeTimer
+ *
+ *   @brief      Para o temporizador e devolve o seu recurso ao serviço.
+ */
+void mkl_TimerService::closeTimer(mkl_VirtualTimer &timer) {
+  if (timer.resource == timer_none) {
+    return;
+  }
+  cancelTimer(timer);
+  if (timer.resource == pitResource) {
+    pit.releaseChannel();
+  }
+  if (timer.resource >= timer_TPM0 && timer.resource <= timer_TPM2) {
+    mkl_TPMDelay &tpm = tpms[timer.resource - timer_TPM0];
+    tpm.releasePeripheral(&tpm);
+  }
+  if (timer.resource < timer_shared) {
+    busy &= ~(1 << timer.resource);
+    owners[timer.resource] = 0;
+  }
+  timer.resource = timer_none;
+}
+
+/*!
+ *   @fn         startTimer
+ *
+ *   @brief      Inicia a contagem, periódica ou de um único estouro.
+ *
+ *   Só escreve os valores calculados em openTimer: sem divisões.
+ */
+void mkl_TimerService::startTimer(mkl_VirtualTimer &timer, bool periodic) {
+  timer.periodic = periodic;
+  switch (timer.resource) {
+    case timer_shared:
+      wheel.startTimer(timer.soft, timer.reload, periodic ? timer.reload : 0);
+      break;
+
+    case timer_PIT0:
+    case timer_PIT1:
+      timer.active = true;
+      pit.disableTimer();
+      pit.setPeriod(timer.reload);
+      pit.clearInterruptFlag();
+      pit.enableInterruptRequests();
+      pit.enableTimer();
+      break;
+
+    case timer_TPM0:
+    case timer_TPM1:
+    case timer_TPM2: {
+      mkl_TPMTiming timing = {timer.div, (uint16_t)timer.reload, 0};
+      mkl_TPMDelay &tpm = tpms[timer.resource - timer_TPM0];
+      timer.active = true;
+      if (periodic) {
+        tpm.startPeriodic(timing, fire, &timer);
+      } else {
+        tpm.startDelay(timing, fire, &timer);
+      }
+      break;
+    }
+
+    default:
+      break;
+  }
+}
+
+/*!
+ *   @fn         cancelTimer
+ *
+ *   @brief      Para a contagem; o recurso continua do temporizador.
+ */
+void mkl_TimerService::cancelTimer(mkl_VirtualTimer &timer) {
+  switch (timer.resource) {
+    case timer_shared:
+      wheel.cancelTimer(timer.soft);
+      break;
+
+    case timer_PIT0:
+    case timer_PIT1:
+      pit.disableTimer();
+      pit.clearInterruptFlag();
+      timer.active = false;
+      break;
+
+    case timer_TPM0:
+    case timer_TPM1:
+    case timer_TPM2:
+      tpms[timer.resource - timer_TPM0].cancelDelay();
+      timer.active = false;
+      break;
+
+    default:
+      break;
+  }
+}
+
+/*!
+ *   @fn         handlePITInterrupt
+ *
+ *   @brief      Atende o canal dedicado do PIT e o tick compartilhado.
+ *
+ *   Se o canal dedicado foi reservado para outro uso, a rotina de serviço
+ *   trata a flag dele antes de chamar este método.
+ */
+void mkl_TimerService::handlePITInterrupt() {
+  mkl_VirtualTimer *timer = owners[pitResource];
+
+  if (timer && pit.isInterruptFlagSet()) {
+    pit.clearInterruptFlag();
+    if (!timer->periodic) {
+      pit.disableTimer();
+    }
+    fire(timer);
+  }
+  wheel.handleInterrupt();
+}
+
+/*!
+ *   @fn         handleTPMInterrupt
+ *
+ *   @brief      Atende o estouro do TPM "tpm" (tpm_TPM0, tpm_TPM1 ou
+ *               tpm_TPM2).
+ */
+void mkl_TimerService::handleTPMInterrupt(tpm_TPMNumberMask tpm) {
+  mkl_TPMDelay::handleInterrupt(tpm);
+}
+
+/*!
+ *   @fn         isFree
+ *
+ *   @brief      Indica se o recurso de hardware não está em uso nem
+ *               reservado.
+ */
+bool mkl_TimerService::isFree(timer_Resource resource) const {
+  return !(busy & (1 << resource));
+}
+
+/*!
+ *   @fn         take
+ *
+ *   @brief      Entrega o recurso de hardware ao temporizador.
+ */
+void mkl_TimerService::take(mkl_VirtualTimer &timer,
+                            timer_Resource resource) {
+  busy |= 1 << resource;
+  owners[resource] = &timer;
+  timer.resource = resource;
+}
+
+/*!
+ *   @fn         openShared
+ *
+ *   @brief      Põe o temporizador no tick compartilhado, com o período
+ *               arredondado para ticks (no mínimo um).
+ */
+timer_Resource mkl_TimerService::openShared(mkl_VirtualTimer &timer,
+                                            uint64_t periodNs) {
+  uint64_t ticks = mkl_Duration::roundDiv(periodNs, tickNs);
+
+  if (ticks == 0) {
+    ticks = 1;
+  }
+  if (ticks > 0x7FFFFFFF) {
+    ticks = 0x7FFFFFFF;
+  }
+  int64_t error = (int64_t)(ticks*tickNs) - (int64_t)periodNs;
+  if (error > INT32_MAX) {
+    error = INT32_MAX;
+  }
+  if (error < INT32_MIN) {
+    error = INT32_MIN;
+  }
+  timer.reload = ticks;
+  timer.resolutionNs = tickNs;
+  timer.errorNs = error;
+  timer.resource = timer_shared;
+  return timer_shared;
+}
+
+/*!
+ *   @fn         fire
+ *
+ *   @brief      Estouro de um temporizador de hardware: marca o fim do
+ *               temporizador de um único estouro e chama a rotina dele.
+ */
+void mkl_TimerService::fire(void *context) {
+  mkl_VirtualTimer *timer = static_cast<mkl_VirtualTimer *>(context);
+
+  if (!timer->periodic) {
+    timer->active = false;
+  }
+  if (timer->callback) {
+    timer->callback(timer->context);
+  }
+}
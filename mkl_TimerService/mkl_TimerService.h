@@ -0,0 +1,216 @@
+/*!
+ * @copyright   © 2017 UFAM - Universidade Federal do Amazonas.
+ *
+ * @brief       Serviço de temporizadores virtuais sobre os canais do PIT e os TPM0, TPM1 e TPM2.
+ *
+ * @file        mkl_TimerService.h
+ * @version     1.2
+ * @date        17 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   PIT (canais 0 e 1) e TPM (TPM0, TPM1 e TPM2).
+ *              +compiler     Kinetis® Design Studio IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão (data): Descrição breve.
+ *                             ++ 1.0 (17 Outubro 2026): Versão inicial.
+ *                             ++ 1.1 (17 Outubro 2026): Reserva dos canais do PIT (mkl_PIT::claimChannel); start retorna false com o canal do tick ocupado.
+ *                             ++ 1.2 (17 Outubro 2026): Reserva dos TPM (claimPeripheral); start recusa o canal 0 com o canal 1 encadeado.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas
+ *              +courses      Engenharia da Computação
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Versão inicial:
+ *                             ++ Patrick Chagas dos Santos <patrick.chagas@gmail.com>
+ *                             ++ Gabriel Montenegro Villacrez <gvmontenegro19@gmail.com>
+ *                             ++ Andrezza Bonfim <andrezzabonfiiim@gmail.com>
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ *              Este programa é um software livre; Você pode redistribuí-lo
+ *              e/ou modificá-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              versão 3 da licença, ou qualquer versão posterior.
+ *
+ *              Este programa é distribuído na esperança de que seja útil,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implícita de
+ *              COMERCIALIZAÇÃO OU USO PARA UM DETERMINADO PROPÓSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#ifndef MKL_TIMERSERVICE_H_
+#define MKL_TIMERSERVICE_H_
+
+#include <stdint.h>
+#include "mkl_Duration/mkl_Duration.h"
+#include "mkl_PITTimerWheel/mkl_PITTimerWheel.h"
+#include "mkl_PITPeriodicInterrupt/mkl_PITPeriodicInterrupt.h"
+#include "mkl_TPMDelay/mkl_TPMDelay.h"
+
+/*!
+ *  Recursos que executam um temporizador virtual: os de hardware, um
+ *  temporizador por vez, e o tick compartilhado (roda por software).
+ */
+typedef enum {
+  timer_PIT0 = 0,
+  timer_PIT1 = 1,
+  timer_TPM0 = 2,
+  timer_TPM1 = 3,
+  timer_TPM2 = 4,
+  timer_shared = 5,
+  timer_none = 6
+} timer_Resource;
+
+/*!
+ *  @class    mkl_VirtualTimer
+ *
+ *  @brief    Temporizador do mkl_TimerService, com o recurso escolhido na
+ *            abertura (openTimer).
+ *
+ *  @details  O objeto guarda o recurso, o valor de recarga já calculado e a
+ *            resolução e o erro de período obtidos; deve existir enquanto
+ *            estiver aberto. A rotina é chamada na interrupção do recurso.
+ */
+class mkl_VirtualTimer {
+ public:
+  mkl_VirtualTimer();
+  void setCallback(mkl_TimerCallback callback, void *context);
+  bool isActive() const;
+  timer_Resource readResource() const { return resource; }
+  uint32_t readResolutionNs() const { return resolutionNs; }
+  int32_t readErrorNs() const { return errorNs; }
+
+ private:
+  friend class mkl_TimerService;
+  mkl_SoftTimer soft;
+  mkl_TimerCallback callback;
+  void *context;
+  timer_Resource resource;
+  uint32_t reload;
+  tpm_Div div;
+  uint32_t resolutionNs;
+  int32_t errorNs;
+  bool periodic;
+  volatile bool active;
+};
+
+/*!
+ *  @class    mkl_TimerService
+ *
+ *  @brief    Dono dos dois canais do PIT e dos três TPM: entrega
+ *            temporizadores virtuais com o período e a resolução pedidos.
+ *
+ *  @details  Um canal do PIT é o tick compartilhado: uma mkl_PITTimerWheel
+ *            sem tick (startTickless), que multiplexa por software qualquer
+ *            número de temporizadores. O outro canal e os TPM0, TPM1 e TPM2
+ *            são recursos dedicados, um temporizador cada.
+ *
+ *            openTimer escolhe o recurso mais barato que atende a resolução
+ *            pedida, nesta ordem:
+ *            - o tick compartilhado, se a resolução pedida é de um tick ou
+ *              mais: não ocupa hardware;
+ *            - um TPM livre, se o período cabe no contador de 16 bits (até
+ *              400 ms) com um divisor de resolução suficiente;
+ *            - o canal livre do PIT (32 bits, 48 ns, até 204 s), guardado
+ *              para o que só ele alcança.
+ *            Sem recurso dedicado livre, o temporizador vai para o tick
+ *            compartilhado, com a resolução de um tick:
+ *            readResource e readResolutionNs dizem o que foi obtido.
+ *
+ *            Os valores de recarga (MOD e divisor do TPM, LDVAL do PIT ou
+ *            ticks da roda) são calculados em openTimer, com divisões de 64
+ *            bits; startTimer e as interrupções só escrevem registradores.
+ *            Abra os temporizadores na inicialização.
+ *
+ *            Nos TPM, o temporizador periódico usa o contador livre
+ *            (mkl_TPMDelay::startPeriodic), e no PIT a recarga automática:
+ *            o período não acumula a latência da interrupção.
+ *
+ *            Os canais do PIT e os TPM são reservados com os mesmos
+ *            mecanismos dos drivers (mkl_PIT::claimChannel e
+ *            mkl_TPM::claimPeripheral): start() retorna false se o canal
+ *            do tick já tem dono, e um recurso dedicado só é aberto se
+ *            estiver livre. Um PWM, uma captura ou um dsf_DisplayDimmer
+ *            configurado antes tira o seu TPM do serviço; configurado
+ *            depois, ele é recusado pelo driver. reserve fica para um
+ *            periférico programado sem esses drivers (o disparo do DMA,
+ *            por exemplo).
+ *
+ *            O mkl_PITLifetimeTimer ocupa os dois canais do PIT e não pode
+ *            ser usado com o serviço: com o canal 1 encadeado ao canal 0,
+ *            start() recusa também o tick no canal 0, que o modo sem tick
+ *            reprograma a cada estouro.
+ *
+ *            As rotinas PIT_IRQHandler e TPMx_IRQHandler devem chamar
+ *            handlePITInterrupt e handleTPMInterrupt.
+ *
+ *  @section  EXAMPLES USAGE
+ *
+ *             +fn dsf_DisplayDimmer dimmer(tpm_PTC2);   // TPM0 fora
+ *             +fn mkl_TimerService timers(PIT_Ch1);
+ *             +fn mkl_VirtualTimer scan, poll;
+ *             +fn timers.start(1000);                   // tick de 1 ms
+ *             +fn timers.openTimer(scan, std::chrono::microseconds(312),
+ *                                  std::chrono::microseconds(1));
+ *             +fn timers.openTimer(poll, std::chrono::milliseconds(10),
+ *                                  std::chrono::milliseconds(1));
+ *             +fn scan.setCallback(refresh, 0);
+ *             +fn timers.startTimer(scan);
+ *             +fn void PIT_IRQHandler() { timers.handlePITInterrupt(); }
+ *             +fn void TPM1_IRQHandler() {
+ *                   timers.handleTPMInterrupt(tpm_TPM1); }
+ */
+class mkl_TimerService {
+ public:
+  explicit mkl_TimerService(PIT_ChPIT tickChannel = PIT_Ch1);
+
+  /*!
+   * Métodos de configuração do serviço.
+   */
+  bool start(uint32_t tickHz);
+  void reserve(timer_Resource resource);
+
+  /*!
+   * Métodos de abertura e de controle dos temporizadores.
+   */
+  timer_Resource openTimer(mkl_VirtualTimer &timer, uint64_t periodNs,
+                           uint32_t resolutionNs);
+  template <class Rep1, class Period1, class Rep2, class Period2>
+  timer_Resource openTimer(mkl_VirtualTimer &timer,
+                           std::chrono::duration<Rep1, Period1> period,
+                           std::chrono::duration<Rep2, Period2> resolution) {
+    return openTimer(timer, mkl_Duration::nanoseconds(period),
+                     mkl_Duration::nanoseconds(resolution));
+  }
+  void closeTimer(mkl_VirtualTimer &timer);
+  void startTimer(mkl_VirtualTimer &timer, bool periodic = true);
+  void cancelTimer(mkl_VirtualTimer &timer);
+
+  /*!
+   * Métodos de atendimento das interrupções.
+   */
+  void handlePITInterrupt();
+  void handleTPMInterrupt(tpm_TPMNumberMask tpm);
+
+ private:
+  mkl_PITTimerWheel wheel;
+  mkl_PITInterruptInterrupt pit;
+  mkl_TPMDelay tpms[3];
+  mkl_VirtualTimer *owners[timer_shared];
+  timer_Resource pitResource;
+  uint8_t busy;
+  uint32_t tickNs;
+
+  bool isFree(timer_Resource resource) const;
+  void take(mkl_VirtualTimer &timer, timer_Resource resource);
+  timer_Resource openShared(mkl_VirtualTimer &timer, uint64_t periodNs);
+  static void fire(void *context);
+};
+
+#endif  //  MKL_TIMERSERVICE_H_
@@ -0,0 +1,46 @@
+/*!
+ * @brief       mkl_PIT contra mkl_PITChannel: RAM por objeto e custo, no
+ *              mkl_HostSim, das operações usadas na rotina de serviço.
+ *
+ * @file        bench_PITChannel.cpp
+ *
+ * @details     As operações ficam em funções noinline para que o
+ *              compilador não as junte entre as iterações. O tamanho do
+ *              código das duas versões é comparado por size_PITChannel.
+ */
+#include <mkl_PITPeriodicInterrupt/mkl_PITPeriodicInterrupt.h>
+#include <mkl_PITChannel/mkl_PITChannel.h>
+#include "hostsim_bench.h"
+
+mkl_PITInterruptInterrupt pit(PIT_Ch1);
+mkl_PITChannel<PIT_Ch1> channel;
+
+__attribute__((noinline)) static uint32_t pitTick(uint32_t period) {
+  pit.setPeriod(period);
+  pit.clearInterruptFlag();
+  return pit.readCounter();
+}
+
+__attribute__((noinline)) static uint32_t channelTick(uint32_t period) {
+  channel.setPeriod(period);
+  channel.clearInterruptFlag();
+  return channel.readCounter();
+}
+
+int main() {
+  volatile uint32_t sink = 0;
+  uint32_t period = 1000;
+  bool ok = true;
+
+  printf("sizeof mkl_PIT=%u mkl_PITChannel=%u (objeto vazio)\n",
+         (unsigned)sizeof(pit), (unsigned)sizeof(channel));
+  CHECK(ok, sizeof(channel) == 1);
+  CHECK(ok, sizeof(pit) >= 4*sizeof(void *));
+
+  channel.enablePeripheralModule();
+  ok &= bench("mkl_PIT set+clear+read", 1000,
+              [&] { sink += pitTick(period++); });
+  ok &= bench("mkl_PITChannel set+clear+read", 1000,
+              [&] { sink += channelTick(period++); });
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,129 @@
+/*!
+ * @brief       Despertares por segundo e custo das interrupções da
+ *              mkl_PITTimerWheel com tick periódico e sem tick.
+ *
+ * @file        bench_PITTimerWheel.cpp
+ *
+ * @details     A carga é a do ar condicionado: um temporizador de 1 s e a
+ *              leitura das teclas a cada 50 ms, periódicos, e um de 60 s de
+ *              um único estouro. Cada modo roda por 20 s de tempo simulado,
+ *              com a CPU em WFI entre as interrupções. O relatório dá os
+ *              despertares por segundo e a fração do tempo em que a CPU
+ *              fica ocupada (ciclos das interrupções sobre os ciclos
+ *              simulados), com um limite para cada modo, e o custo das
+ *              interrupções por segundo; o teste também confere que cada
+ *              estouro ocorre no tick esperado e que o modo sem tick não
+ *              perde a fase dos ticks.
+ */
+#include <mkl_PITTimerWheel/mkl_PITTimerWheel.h>
+#include "hostsim_bench.h"
+
+static const uint32_t kTickHz = 1000;
+static const uint32_t kSeconds = 20;
+
+mkl_PITTimerWheel periodicWheel(PIT_Ch0);
+mkl_PITTimerWheel ticklessWheel(PIT_Ch1);
+static mkl_PITTimerWheel *wheel;
+
+static hostsim_BusStats isrStats;
+static uint32_t wakeups, lateFires;
+
+/*!
+ *  Temporizador da carga, com o tick em que deve estourar.
+ */
+struct LoadTimer {
+  mkl_SoftTimer timer;
+  uint32_t due;
+  uint32_t period;
+};
+
+static LoadTimer heartbeat, keyPoll, sleepTimer;
+
+static void onExpired(void *context) {
+  LoadTimer *load = static_cast<LoadTimer *>(context);
+  if (wheel->readTicks() != load->due) {
+    lateFires++;
+  }
+  load->due += load->period;
+}
+
+extern "C" void PIT_IRQHandler() {
+  hostsim_BusStats before;
+
+  mkl_HostSim::readBusStats(&before);
+  wheel->handleInterrupt();
+  accumulate(&isrStats, before);
+  wakeups++;
+}
+
+static void startLoad(LoadTimer &load, uint32_t ticks, uint32_t period) {
+  load.due = wheel->readTicks() + ticks;
+  load.period = period;
+  load.timer.setCallback(onExpired, &load);
+  wheel->startTimer(load.timer, ticks, period);
+}
+
+/*!
+ *  Roda a carga por kSeconds na roda "active" e compara os despertares por
+ *  segundo e a fração ocupada da CPU, em partes por milhão, com os limites,
+ *  e o custo das interrupções por segundo com a referência. As instruções
+ *  são contadas só no primeiro segundo, pois a contagem é lenta, e a carga
+ *  se repete a cada segundo.
+ */
+static bool run(const char *name, mkl_PITTimerWheel &active, bool tickless,
+                uint32_t maxWakeupsPerSecond, uint32_t maxBusyPpm) {
+  bool ok = true;
+
+  wheel = &active;
+  isrStats = hostsim_BusStats();
+  wakeups = lateFires = 0;
+  if (tickless) {
+    active.startTickless(kTickHz);
+  } else {
+    active.start(kTickHz);
+  }
+  uint32_t firstTick = active.readTicks();
+  uint64_t start = mkl_HostSim::cycles();
+  startLoad(heartbeat, 1000, 1000);
+  startLoad(keyPoll, 50, 50);
+  startLoad(sleepTimer, 60000, 0);
+  mkl_HostSim::countInstructions(true);
+  while (mkl_HostSim::cycles() - start < HOSTSIM_BUS_CLOCK) {
+    mkl_HostSim::waitForInterrupt();
+  }
+  mkl_HostSim::countInstructions(false);
+  while (mkl_HostSim::cycles() - start < kSeconds*(uint64_t)HOSTSIM_BUS_CLOCK) {
+    mkl_HostSim::waitForInterrupt();
+  }
+  active.cancelTimer(heartbeat.timer);
+  active.cancelTimer(keyPoll.timer);
+  active.cancelTimer(sleepTimer.timer);
+  active.disableTimer();
+
+  uint64_t elapsedTicks = (mkl_HostSim::cycles() - start)*kTickHz /
+                          HOSTSIM_BUS_CLOCK;
+  uint32_t ticks = active.readTicks() - firstTick;
+  uint32_t busyPpm = static_cast<uint32_t>(
+      isrStats.cycles*1000000/(mkl_HostSim::cycles() - start));
+  printf("%-28s wakeups/s=%u busy=%u.%04u%% ticks=%u esperado=%u\n", name,
+         (unsigned)(wakeups/kSeconds), (unsigned)(busyPpm/10000),
+         (unsigned)(busyPpm%10000), (unsigned)ticks,
+         (unsigned)elapsedTicks);
+  CHECK(ok, wakeups/kSeconds <= maxWakeupsPerSecond);
+  CHECK(ok, busyPpm <= maxBusyPpm);
+  CHECK(ok, lateFires == 0);
+  CHECK(ok, ticks + 1 >= elapsedTicks && ticks <= elapsedTicks + 1);
+  hostsim_BusStats none = hostsim_BusStats();
+  isrStats.instructions *= kSeconds;
+  ok &= report(name, none, isrStats, kSeconds);
+  return ok;
+}
+
+int main() {
+  bool ok = true;
+
+  mkl_HostSim::enableIrq();
+  ok &= run("wheel periodic isr/s", periodicWheel, false, 1001, 460);
+  ok &= run("wheel tickless isr/s", ticklessWheel, true, 21, 50);
+  return ok ? 0 : 1;
+}
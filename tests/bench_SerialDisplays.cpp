@@ -0,0 +1,46 @@
+/*!
+ * @brief       Custo, no mkl_HostSim, das rotinas do dsf_SerialDisplays e
+ *              do envio de um quadro pelos transportes.
+ *
+ * @file        bench_SerialDisplays.cpp
+ *
+ * @details     Os custos, em ciclos de barramento e em instruções, são
+ *              comparados com baseline_report.txt: uma mudança que deixe as
+ *              rotinas mais caras falha o ctest até que a referência seja
+ *              regravada.
+ *
+ *              O envio pelo SPI inclui as interrupções do fim de cada byte:
+ *              a chamada só escreve o primeiro byte, e a CPU dorme (WFI)
+ *              até o fim do quadro.
+ */
+#include <dsf_SerialDisplays.h>
+#include <dsf_BitBangTransport.h>
+#include <dsf_SPITransport.h>
+#include "hostsim_bench.h"
+
+dsf_BitBangTransport bitBang(gpio_PTC7, gpio_PTC0, gpio_PTC3);
+dsf_SPITransport spi(spi_MOSI_PTD2, spi_SCK_PTD1, gpio_PTD0);
+dsf_SerialDisplays disp(&bitBang);
+
+extern "C" void SPI0_IRQHandler() { spi.handleInterrupt(); }
+
+int main() {
+  static const uint8_t frame[2] = {0xC0, 0x01};
+  bool ok = true;
+  uint16_t value = 0;
+
+  mkl_HostSim::enableIrq();
+  disp.writeWord(0x1234);
+  ok &= bench("updateDisplays", 20, [] { disp.updateDisplays(); });
+  // Só escreve na memória: qualquer acesso a periférico é regressão.
+  ok &= bench("writeWord", 20, [&] { disp.writeWord(value++); });
+  ok &= bench("sendFrames bitbang 1", 20,
+              [] { bitBang.sendFrames(frame, 1); });
+  ok &= bench("sendFrames spi 1", 20, [] {
+    spi.sendFrames(frame, 1);
+    while (spi.isBusy()) {
+      mkl_HostSim::waitForInterrupt();
+    }
+  });
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,95 @@
+/*!
+ * @brief       Custo por temporizador do mkl_TimerService em cada recurso:
+ *              TPM, canal dedicado do PIT e tick compartilhado.
+ *
+ * @file        bench_TimerService.cpp
+ *
+ * @details     Cada medição roda 20 ms de tempo simulado com temporizadores
+ *              periódicos de 1 ms e divide os ciclos de barramento das
+ *              interrupções pelo número de estouros. No tick compartilhado,
+ *              os temporizadores de mesmo período são atendidos pela mesma
+ *              interrupção, e o custo por estouro cai com o número deles.
+ *              Antes, o teste confere a escolha do recurso para as
+ *              resoluções pedidas.
+ */
+#include <mkl_TimerService/mkl_TimerService.h>
+#include "hostsim_bench.h"
+
+using std::chrono::microseconds;
+using std::chrono::milliseconds;
+using std::chrono::seconds;
+
+mkl_TimerService timers(PIT_Ch1);
+
+extern "C" void PIT_IRQHandler() { timers.handlePITInterrupt(); }
+extern "C" void TPM0_IRQHandler() { timers.handleTPMInterrupt(tpm_TPM0); }
+extern "C" void TPM1_IRQHandler() { timers.handleTPMInterrupt(tpm_TPM1); }
+extern "C" void TPM2_IRQHandler() { timers.handleTPMInterrupt(tpm_TPM2); }
+
+static const int kTimers = 32;
+static mkl_VirtualTimer virtualTimers[kTimers];
+static uint32_t fires;
+
+static void onExpired(void *) {
+  fires++;
+}
+
+/*!
+ *  Abre e inicia "count" temporizadores de 1 ms com a resolução pedida,
+ *  mede 20 ms e os fecha.
+ */
+template <class Resolution>
+static bool measure(const char *name, int count, Resolution resolution,
+                    timer_Resource expected) {
+  hostsim_BusStats before, after;
+  bool ok = true;
+
+  for (int i = 0; i < count; i++) {
+    timers.openTimer(virtualTimers[i], milliseconds(1), resolution);
+    virtualTimers[i].setCallback(onExpired, 0);
+    CHECK(ok, virtualTimers[i].readResource() == expected);
+    timers.startTimer(virtualTimers[i]);
+  }
+  fires = 0;
+  mkl_HostSim::readBusStats(&before);
+  mkl_HostSim::run(HOSTSIM_BUS_CLOCK/50);
+  mkl_HostSim::readBusStats(&after);
+  for (int i = 0; i < count; i++) {
+    timers.closeTimer(virtualTimers[i]);
+  }
+  CHECK(ok, fires >= 19u*count && fires <= 20u*count);
+  return report(name, before, after, fires) && ok;
+}
+
+int main() {
+  mkl_VirtualTimer scan, poll, led;
+  bool ok = true;
+
+  mkl_HostSim::enableIrq();
+  mkl_HostSim::countInstructions(true);
+  timers.start(1000);
+
+  // Recurso mais barato que atende a resolução pedida.
+  timers.openTimer(scan, microseconds(312), microseconds(1));
+  timers.openTimer(poll, milliseconds(10), milliseconds(1));
+  timers.openTimer(led, seconds(2), microseconds(1));
+  CHECK(ok, scan.readResource() == timer_TPM0);
+  CHECK(ok, poll.readResource() == timer_shared);
+  CHECK(ok, led.readResource() == timer_PIT0);
+  timers.closeTimer(scan);
+  timers.closeTimer(poll);
+  timers.closeTimer(led);
+
+  ok &= measure("timer TPM per fire", 1, microseconds(1), timer_TPM0);
+  timers.reserve(timer_TPM0);
+  timers.reserve(timer_TPM1);
+  timers.reserve(timer_TPM2);
+  ok &= measure("timer PIT per fire", 1, microseconds(1), timer_PIT0);
+  ok &= measure("timer shared x1 per fire", 1, milliseconds(1),
+                timer_shared);
+  ok &= measure("timer shared x8 per fire", 8, milliseconds(1),
+                timer_shared);
+  ok &= measure("timer shared x32 per fire", 32, milliseconds(1),
+                timer_shared);
+  return ok ? 0 : 1;
+}
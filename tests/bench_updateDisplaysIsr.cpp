@@ -0,0 +1,137 @@
+/*!
+ * @brief       Custo, por interrupção do PIT, da varredura dos displays:
+ *              rotina original (antes do quadro pré-calculado) e atual.
+ *
+ * @file        bench_updateDisplaysIsr.cpp
+ *
+ * @details     A rotina original é reproduzida aqui: o envio bit a bit por
+ *              mkl_GPIOPort::writeBit (o mkl_GPIO atual), com o desvio em
+ *              "digit & 0x80", e o cálculo do quadro de cada dígito a cada
+ *              interrupção. Ela fica no relatório para a comparação com a
+ *              atual.
+ *
+ *              O custo é medido dentro da PIT_IRQHandler, com a limpeza da
+ *              flag, durante 20 interrupções de cada versão. Na varredura
+ *              pelo SPI, o custo das interrupções do SPI (uma por byte) é
+ *              somado ao da interrupção do PIT que iniciou o envio.
+ */
+#include <dsf_SerialDisplays.h>
+#include <dsf_BitBangTransport.h>
+#include <dsf_SPITransport.h>
+#include <mkl_GPIOPort/mkl_GPIOPort.h>
+#include <mkl_PITPeriodicInterrupt/mkl_PITPeriodicInterrupt.h>
+#include "hostsim_bench.h"
+
+/*!
+ *  Varredura original: quatro dígitos por interrupção, bit a bit.
+ */
+class LegacyDisplays {
+ public:
+  LegacyDisplays() : DIO(gpio_PTB0), SCLK(gpio_PTB1), RCLK(gpio_PTB2) {
+    DIO.setPortMode(gpio_output);
+    SCLK.setPortMode(gpio_output);
+    RCLK.setPortMode(gpio_output);
+    storeData[0] = 0xF9;
+    storeData[1] = 0xA4;
+    storeData[2] = 0xB0;
+    storeData[3] = 0x99;
+  }
+
+  void updateDisplays() {
+    for (int i = 0; i < 4; i++) {
+      sendNibble(storeData[i]);
+      sendNibble(1 << i);
+      RCLK.writeBit(0);
+      RCLK.writeBit(1);
+    }
+  }
+
+ private:
+  mkl_GPIOPort DIO, SCLK, RCLK;
+  uint8_t storeData[4];
+
+  void sendNibble(char digit) {
+    for (int t = 8; t >= 1; t--) {
+      if (digit & 0x80) {
+        DIO.writeBit(1);
+      } else {
+        DIO.writeBit(0);
+      }
+      digit <<= 1;
+      SCLK.writeBit(0);
+      SCLK.writeBit(1);
+    }
+  }
+};
+
+LegacyDisplays legacy;
+dsf_BitBangTransport bitBang(gpio_PTC7, gpio_PTC0, gpio_PTC3);
+dsf_SPITransport spi(spi_MOSI_PTD2, spi_SCK_PTD1, gpio_PTD0);
+dsf_SerialDisplays bitBangDisplays(&bitBang);
+dsf_SerialDisplays spiDisplays(&spi);
+dsf_DisplayDimmer dimmer(tpm_PTC2);
+mkl_PITInterruptInterrupt pit(PIT_Ch0);
+
+static void (*scan)();
+static hostsim_BusStats isrBefore, isrAfter;
+static uint32_t interrupts;
+
+extern "C" void PIT_IRQHandler() {
+  hostsim_BusStats before;
+
+  mkl_HostSim::readBusStats(&before);
+  scan();
+  pit.clearInterruptFlag();
+  accumulate(&isrAfter, before);
+  interrupts++;
+}
+
+extern "C" void SPI0_IRQHandler() {
+  hostsim_BusStats before;
+
+  mkl_HostSim::readBusStats(&before);
+  spi.handleInterrupt();
+  accumulate(&isrAfter, before);
+}
+
+/*!
+ *  Mede a rotina "routine" em 20 interrupções do PIT a 3200 Hz.
+ */
+static bool measure(const char *name, void (*routine)()) {
+  isrBefore = isrAfter = hostsim_BusStats();
+  interrupts = 0;
+  scan = routine;
+  pit.resetCounter();
+  pit.clearInterruptFlag();
+  pit.enableTimer();
+  while (interrupts < 20) {
+    mkl_HostSim::waitForInterrupt();
+  }
+  pit.disableTimer();
+  return report(name, isrBefore, isrAfter, interrupts);
+}
+
+int main() {
+  bool ok = true;
+
+  bitBangDisplays.writeWord(0x1234);
+  spiDisplays.writeWord(0x1234);
+  pit.enablePeripheralModule();
+  pit.setFrequency(3200);
+  pit.enableInterruptRequests();
+  mkl_HostSim::enableIrq();
+  mkl_HostSim::countInstructions(true);
+
+  ok &= measure("isr legacy bitbang", [] { legacy.updateDisplays(); });
+  ok &= measure("isr bitbang", [] { bitBangDisplays.updateDisplays(); });
+  ok &= measure("isr spi", [] { spiDisplays.updateDisplays(); });
+  bitBangDisplays.setScanMode(dsf_scanOneDigit);
+  ok &= measure("isr bitbang one digit",
+                [] { bitBangDisplays.updateDisplays(); });
+  // Brilho por dígito pelo OE: uma escrita no CnV por interrupção.
+  bitBangDisplays.attachDimmer(&dimmer);
+  bitBangDisplays.setDigitBrightness(1, 64);
+  ok &= measure("isr bitbang one digit dimmer",
+                [] { bitBangDisplays.updateDisplays(); });
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,22 @@
+# Compara o .text de dois programas com a ferramenta size (formato
+# Berkeley) e falha se o segundo (CHANNEL) for maior que o primeiro (PIT).
+#
+#   cmake -DSIZE=<size> -DPIT=<programa> -DCHANNEL=<programa> -P compare_size.cmake
+
+function(read_text program result)
+  execute_process(COMMAND ${SIZE} ${program}
+                  OUTPUT_VARIABLE output RESULT_VARIABLE failed)
+  if(failed)
+    message(FATAL_ERROR "${SIZE} ${program} falhou")
+  endif()
+  string(REGEX MATCH "\n[ \t]*([0-9]+)" line "${output}")
+  set(${result} ${CMAKE_MATCH_1} PARENT_SCOPE)
+endfunction()
+
+read_text(${PIT} pitText)
+read_text(${CHANNEL} channelText)
+math(EXPR saved "${pitText} - ${channelText}")
+message("text mkl_PIT=${pitText} mkl_PITChannel=${channelText} economia=${saved} bytes")
+if(channelText GREATER pitText)
+  message(FATAL_ERROR "mkl_PITChannel ficou maior que mkl_PIT")
+endif()
@@ -0,0 +1,141 @@
+/*!
+ * @brief       Medição do custo de um trecho de código no mkl_HostSim.
+ *
+ * @file        hostsim_bench.h
+ *
+ * @details     Cada teste é um executável: retorna 0 quando todas as
+ *              medições ficam dentro do orçamento e 1 quando alguma passa
+ *              dele (linha OVER no relatório), o que falha o ctest.
+ *
+ *              Os orçamentos vêm do relatório de referência
+ *              (baseline_report.txt, caminho em HOSTSIM_BASELINE): uma
+ *              linha por medição, com os ciclos de acesso ao barramento e
+ *              as instruções contadas por chamada. Os ciclos não podem
+ *              passar da referência, pois o tempo virtual é determinístico;
+ *              as instruções, contadas no host, têm uma folga de 20% para
+ *              variações do compilador. Uma medição sem referência falha.
+ *
+ *              Para regravar a referência após uma mudança intencional:
+ *                HOSTSIM_BASELINE_UPDATE=novo.txt ctest
+ *              acrescenta a novo.txt a linha de cada medição, sem
+ *              comparar; o arquivo é então revisado e copiado sobre
+ *              baseline_report.txt.
+ */
+#ifndef HOSTSIM_BENCH_H_
+#define HOSTSIM_BENCH_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <mkl_HostSim.h>
+
+/*!
+ *  Soma a "total" o custo medido desde "before", para as medições feitas
+ *  em várias partes (rotinas de interrupção).
+ */
+inline void accumulate(hostsim_BusStats *total,
+                       const hostsim_BusStats &before) {
+  hostsim_BusStats after;
+
+  mkl_HostSim::readBusStats(&after);
+  for (int r = 0; r < hostsim_Regions; r++) {
+    total->reads[r] += after.reads[r] - before.reads[r];
+    total->writes[r] += after.writes[r] - before.writes[r];
+  }
+  total->cycles += after.cycles - before.cycles;
+  total->instructions += after.instructions - before.instructions;
+}
+
+/*!
+ *  Procura a medição "name" no relatório de referência.
+ */
+inline bool readBaseline(const char *name, unsigned long long *cycles,
+                         unsigned long long *instructions) {
+  FILE *file = fopen(HOSTSIM_BASELINE, "r");
+  char line[256];
+  bool found = false;
+
+  if (!file) {
+    return false;
+  }
+  while (!found && fgets(line, sizeof(line), file)) {
+    char *fields = strstr(line, " cycles=");
+    if (line[0] == '#' || !fields) {
+      continue;
+    }
+    if (sscanf(fields, " cycles=%llu instr=%llu", cycles,
+               instructions) != 2) {
+      continue;
+    }
+    char *end = fields;
+    while (end > line && end[-1] == ' ') {
+      end--;
+    }
+    *end = '\0';
+    found = strcmp(line, name) == 0;
+  }
+  fclose(file);
+  return found;
+}
+
+/*!
+ *  Escreve a linha de relatório da medição e a compara com a referência.
+ */
+inline bool report(const char *name, const hostsim_BusStats &before,
+                   const hostsim_BusStats &after, uint32_t calls) {
+  const char *update = getenv("HOSTSIM_BASELINE_UPDATE");
+  unsigned long long cycles = 0, instructions = 0;
+
+  if (update) {
+    FILE *file = fopen(update, "a");
+    uint32_t n = calls ? calls : 1;
+    if (file) {
+      fprintf(file, "%-28s cycles=%llu instr=%llu\n", name,
+              (unsigned long long)((after.cycles - before.cycles)/n),
+              (unsigned long long)((after.instructions -
+                                    before.instructions)/n));
+      fclose(file);
+    }
+    return mkl_HostSim::writeReport(stdout, name, before, after, calls,
+                                    HOSTSIM_NO_BUDGET, HOSTSIM_NO_BUDGET);
+  }
+  if (!readBaseline(name, &cycles, &instructions)) {
+    printf("%-28s sem referencia em %s\n", name, HOSTSIM_BASELINE);
+    return false;
+  }
+  return mkl_HostSim::writeReport(stdout, name, before, after, calls,
+                                  cycles, instructions + instructions/5);
+}
+
+/*!
+ *  Executa "calls" vezes a função, com a contagem de instruções ligada, e
+ *  compara o custo médio por chamada com a referência.
+ */
+template <class Function>
+bool bench(const char *name, uint32_t calls, Function function) {
+  hostsim_BusStats before, after;
+  bool counting = mkl_HostSim::countInstructions(true);
+
+  mkl_HostSim::readBusStats(&before);
+  for (uint32_t i = 0; i < calls; i++) {
+    function();
+  }
+  mkl_HostSim::readBusStats(&after);
+  mkl_HostSim::countInstructions(counting);
+  return report(name, before, after, calls);
+}
+
+/*!
+ *  Verificação simples para os testes funcionais: imprime a falha e
+ *  acumula o resultado em "ok".
+ */
+#define CHECK(ok, condition)                                           \
+  do {                                                                 \
+    if (!(condition)) {                                                \
+      printf("%s:%d: falhou: %s\n", __FILE__, __LINE__, #condition);   \
+      (ok) = false;                                                    \
+    }                                                                  \
+  } while (0)
+
+#endif  // HOSTSIM_BENCH_H_
@@ -0,0 +1,33 @@
+/*!
+ * @brief       Programa mínimo usado só para medir o tamanho do código do
+ *              canal do PIT nas duas versões: compilado com SIZE_MKL_PIT usa
+ *              o mkl_PIT, senão o mkl_PITChannel.
+ *
+ * @file        size_PITChannel.cpp
+ *
+ * @details     Não é executado: os registradores ficam nos endereços da
+ *              KL25. compare_size.cmake compara o .text dos dois programas,
+ *              ligados com --gc-sections, de modo que só o que é usado
+ *              entra na conta.
+ */
+#include <mkl_PITPeriodicInterrupt/mkl_PITPeriodicInterrupt.h>
+#include <mkl_PITChannel/mkl_PITChannel.h>
+
+#ifdef SIZE_MKL_PIT
+mkl_PITInterruptInterrupt pit(PIT_Ch1);
+#else
+mkl_PITChannel<PIT_Ch1> pit;
+#endif
+
+volatile uint32_t sink;
+
+int main() {
+  pit.enablePeripheralModule();
+  pit.setFrequency(1000);
+  pit.enableInterruptRequests();
+  pit.enableTimer();
+  for (;;) {
+    pit.clearInterruptFlag();
+    sink = pit.readCounter();
+  }
+}
@@ -0,0 +1,132 @@
+/*!
+ * @brief       Envio dos quadros pelo dsf_DMATransport: canais do SPI Tx e
+ *              Rx, e o pulso do RCLK ao fim de cada quadro.
+ *
+ * @file        test_DMATransport.cpp
+ *
+ * @details     O observador do SPI e o dos pinos registram, na ordem do
+ *              tempo virtual, cada byte deslocado e cada borda de subida do
+ *              RCLK, e alimentam um modelo dos dois 74HC595 em cascata. Em 8
+ *              interrupções do PIT, na varredura de um dígito por chamada,
+ *              os bytes devem ser os 8 quadros na ordem, com o RCLK só após
+ *              cada par: as saídas nunca mostram um quadro pela metade.
+ *
+ *              O custo da CPU por quadro é o rearme na interrupção da
+ *              varredura e o pulso do RCLK na interrupção do DMA, medidos à
+ *              parte. Um bloco de 4 quadros numa só chamada também deve
+ *              copiar cada quadro inteiro.
+ */
+#include <dsf_SerialDisplays.h>
+#include <dsf_DMATransport.h>
+#include <mkl_PITPeriodicInterrupt/mkl_PITPeriodicInterrupt.h>
+#include "hostsim_bench.h"
+
+dsf_DMATransport dma(spi_MOSI_PTC7, spi_SCK_PTC5, gpio_PTC4, dma_ch0,
+                     dma_ch1);
+dsf_SerialDisplays disp(&dma);
+mkl_PITInterruptInterrupt pit(PIT_Ch1);
+
+static const uint32_t kRCLK = 1u << 4;
+
+static char events[64];
+static uint16_t latched[16];
+static uint32_t eventCount, latchCount, interrupts, dmaInterrupts;
+static uint16_t shiftRegister;
+static hostsim_BusStats isrStats, dmaStats;
+
+static void observeSpi(uint8_t, uint8_t data, uint64_t) {
+  shiftRegister = static_cast<uint16_t>(shiftRegister << 8 | data);
+  if (eventCount < sizeof(events)) {
+    events[eventCount++] = 'B';
+  }
+}
+
+static void observePins(uint8_t GPIONumber, uint32_t oldLevels,
+                        uint32_t newLevels, uint64_t) {
+  if (GPIONumber != 2 || !(~oldLevels & newLevels & kRCLK)) {
+    return;
+  }
+  if (latchCount < 16) {
+    latched[latchCount++] = shiftRegister;
+  }
+  if (eventCount < sizeof(events)) {
+    events[eventCount++] = 'L';
+  }
+}
+
+extern "C" void PIT_IRQHandler() {
+  hostsim_BusStats before;
+
+  mkl_HostSim::readBusStats(&before);
+  disp.updateDisplays();
+  pit.clearInterruptFlag();
+  accumulate(&isrStats, before);
+  interrupts++;
+}
+
+extern "C" void DMA1_IRQHandler() {
+  hostsim_BusStats before;
+
+  mkl_HostSim::readBusStats(&before);
+  dma.handleInterrupt();
+  accumulate(&dmaStats, before);
+  dmaInterrupts++;
+}
+
+static bool checkFrames(const uint16_t *expected, uint32_t frames) {
+  bool ok = true;
+
+  printf("eventos=%.*s\n", (int)eventCount, events);
+  CHECK(ok, eventCount == 3*frames);
+  for (uint32_t i = 0; i < eventCount; i++) {
+    CHECK(ok, events[i] == (i % 3 == 2 ? 'L' : 'B'));
+  }
+  CHECK(ok, latchCount == frames);
+  for (uint32_t i = 0; i < latchCount; i++) {
+    printf("quadro %u = %04X\n", (unsigned)i, latched[i]);
+    CHECK(ok, latched[i] == expected[i % 4]);
+  }
+  return ok;
+}
+
+int main() {
+  static const uint16_t kFrames[4] = {0x9901, 0xB002, 0xA404, 0xF908};
+  bool ok = true;
+
+  mkl_HostSim::setSpiObserver(observeSpi);
+  mkl_HostSim::setPinObserver(observePins);
+  disp.writeWord(1234);
+  disp.setScanMode(dsf_scanOneDigit);
+  pit.enablePeripheralModule();
+  pit.setFrequency(disp.scanFrequency(100));
+  pit.enableInterruptRequests();
+  pit.enableTimer();
+  mkl_HostSim::enableIrq();
+  mkl_HostSim::countInstructions(true);
+  while (interrupts < 8) {
+    mkl_HostSim::waitForInterrupt();
+  }
+  pit.disableTimer();
+  mkl_HostSim::run(HOSTSIM_BUS_CLOCK/1000);
+  ok &= checkFrames(kFrames, 8);
+  CHECK(ok, dmaInterrupts == 8);
+
+  hostsim_BusStats none = hostsim_BusStats();
+  ok &= report("isr dma one digit", none, isrStats, interrupts);
+  ok &= report("isr dma done", none, dmaStats, dmaInterrupts);
+  mkl_HostSim::countInstructions(false);
+
+  /*!
+   *  Varredura completa numa só chamada: um quadro por interrupção do DMA.
+   */
+  eventCount = latchCount = 0;
+  disp.setScanMode(dsf_scanAllDigits);
+  disp.updateDisplays();
+  CHECK(ok, dma.isBusy());
+  while (dma.isBusy()) {
+    mkl_HostSim::waitForInterrupt();
+  }
+  mkl_HostSim::run(HOSTSIM_BUS_CLOCK/1000);
+  ok &= checkFrames(kFrames, 4);
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,73 @@
+/*!
+ * @brief       Pressão longa e repetição do mkl_GPIOBusDebouncer com teclas
+ *              sobrepostas.
+ *
+ * @file        test_GPIOBusDebouncer.cpp
+ *
+ * @details     PTB8 é pressionada na amostra 0 e solta na 250; PTB10 é
+ *              pressionada na 50 e solta na 200, e PTB9 dá um toque curto
+ *              na 120. Cada tecla deve ter a pressão longa 100 amostras
+ *              após a sua própria pressão e as repetições a cada 20
+ *              amostras, sem ser reiniciada pelas outras.
+ */
+#include <mkl_GPIOBusDebouncer/mkl_GPIOBusDebouncer.h>
+#include "hostsim_bench.h"
+
+const uint32_t kPin8 = 1u << 8;
+const uint32_t kPin9 = 1u << 9;
+const uint32_t kPin10 = 1u << 10;
+
+mkl_GPIOBusDebouncer keys(gpio_GPIOB, kPin8 | kPin9 | kPin10);
+
+struct KeyLog {
+  int pressedAt;
+  int longAt;
+  int repeats;
+  int lastRepeat;
+  bool badRepeat;
+};
+
+void logKey(KeyLog *log, uint32_t bit, int s) {
+  if (keys.readPressed() & bit) log->pressedAt = s;
+  if (keys.readLongPressed() & bit) log->longAt = s;
+  if (keys.readRepeated() & bit) {
+    int from = log->repeats ? log->lastRepeat : log->longAt;
+    if (s - from != 20) log->badRepeat = true;
+    log->repeats++;
+    log->lastRepeat = s;
+  }
+}
+
+int main() {
+  bool ok = true;
+  KeyLog key8 = {-1, -1, 0, 0, false};
+  KeyLog key9 = {-1, -1, 0, 0, false};
+  KeyLog key10 = {-1, -1, 0, 0, false};
+
+  keys.setPortMode(gpio_input);
+  keys.setPullResistor(gpio_pullUpResistor);
+  keys.setHoldTimes(100, 20);
+  for (int s = 0; s < 300; s++) {
+    mkl_HostSim::setInputPin(1, 8, !(s < 250));
+    mkl_HostSim::setInputPin(1, 9, !(s >= 120 && s < 130));
+    mkl_HostSim::setInputPin(1, 10, !(s >= 50 && s < 200));
+    keys.sample();
+    logKey(&key8, kPin8, s);
+    logKey(&key9, kPin9, s);
+    logKey(&key10, kPin10, s);
+  }
+
+  printf("PTB8:  pressed=%d long=%d repeats=%d\n",
+         key8.pressedAt, key8.longAt, key8.repeats);
+  printf("PTB9:  pressed=%d long=%d repeats=%d\n",
+         key9.pressedAt, key9.longAt, key9.repeats);
+  printf("PTB10: pressed=%d long=%d repeats=%d\n",
+         key10.pressedAt, key10.longAt, key10.repeats);
+  CHECK(ok, key8.pressedAt >= 0 && key8.longAt - key8.pressedAt == 100);
+  CHECK(ok, key10.pressedAt >= 0 && key10.longAt - key10.pressedAt == 100);
+  CHECK(ok, key9.pressedAt >= 0 && key9.longAt < 0 && key9.repeats == 0);
+  CHECK(ok, !key8.badRepeat && !key10.badRepeat);
+  CHECK(ok, key8.repeats == (250 + 3 - key8.longAt - 1) / 20);
+  CHECK(ok, key10.repeats == (200 + 3 - key10.longAt - 1) / 20);
+  return ok ? 0 : 1;
+}
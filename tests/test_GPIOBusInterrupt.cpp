@@ -0,0 +1,57 @@
+/*!
+ * @brief       Interrupção de todos os pinos de um mkl_GPIOBus.
+ *
+ * @file        test_GPIOBusInterrupt.cpp
+ *
+ * @details     Um grupo com PTA12 e PTA13 (sem o pino 0 da porta) recebe a
+ *              rotina e a borda de descida: cada pino deve gerar a sua
+ *              chamada, e gpio_interruptDisabled deve desligar os dois.
+ */
+#include <mkl_GPIOBus/mkl_GPIOBus.h>
+#include "hostsim_bench.h"
+
+mkl_GPIOBus keys(gpio_GPIOA,
+                 mkl_GPIOBus::pinMask(gpio_PTA12) |
+                 mkl_GPIOBus::pinMask(gpio_PTA13));
+int edges;
+
+void onKey(void *) {
+  edges++;
+}
+
+extern "C" void PORTA_IRQHandler(void) {
+  mkl_GPIO::handleInterrupt(gpio_GPIOA);
+}
+
+void press(uint8_t pin) {
+  mkl_HostSim::setInputPin(0, pin, 0);
+  mkl_HostSim::run(100);
+  mkl_HostSim::setInputPin(0, pin, 1);
+  mkl_HostSim::run(100);
+}
+
+int main() {
+  bool ok = true;
+
+  keys.setPortMode(gpio_input);
+  keys.setPullResistor(gpio_pullUpResistor);
+  keys.attachInterrupt(onKey, 0);
+  keys.setInterruptMode(gpio_interruptFallingEdge);
+  mkl_HostSim::enableIrq();
+  mkl_HostSim::run(100);
+
+  press(12);
+  printf("PTA12: edges=%d\n", edges);
+  CHECK(ok, edges == 1);
+  press(13);
+  printf("PTA13: edges=%d\n", edges);
+  CHECK(ok, edges == 2);
+  CHECK(ok, (PORTA->PCR[0] & PORT_PCR_IRQC_MASK) == 0);
+
+  keys.setInterruptMode(gpio_interruptDisabled);
+  press(12);
+  press(13);
+  printf("disabled: edges=%d\n", edges);
+  CHECK(ok, edges == 2);
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,46 @@
+/*!
+ * @brief       Reserva dos canais do PIT entre mkl_PITLifetimeTimer,
+ *              mkl_PITTimerWheel e mkl_TimerService.
+ *
+ * @file        test_PITClaim.cpp
+ *
+ * @details     O mkl_PITLifetimeTimer reserva o canal 1 (e o canal 0, que
+ *              ele inicia); uma roda ou um serviço no canal 1 deve ser
+ *              recusado sem reprogramar o canal, e o canal volta a ficar
+ *              livre após stop().
+ */
+#include <mkl_PITLifetimeTimer/mkl_PITLifetimeTimer.h>
+#include <mkl_PITTimerWheel/mkl_PITTimerWheel.h>
+#include <mkl_TimerService/mkl_TimerService.h>
+#include "hostsim_bench.h"
+
+mkl_PITLifetimeTimer lifetime;
+mkl_PITTimerWheel wheel(PIT_Ch1);
+mkl_TimerService timers(PIT_Ch1);
+
+int main() {
+  bool ok = true;
+
+  CHECK(ok, lifetime.start());
+  mkl_HostSim::run(1000);
+  uint64_t before = lifetime.readTicks();
+
+  CHECK(ok, !wheel.start(1000));
+  CHECK(ok, !wheel.startTickless(1000));
+  CHECK(ok, !timers.start(1000));
+  CHECK(ok, (PIT->CHANNEL[1].TCTRL & PIT_TCTRL_CHN_MASK) != 0);
+  CHECK(ok, PIT->CHANNEL[1].LDVAL == 0xFFFFFFFF);
+  mkl_HostSim::run(1000);
+  uint64_t after = lifetime.readTicks();
+  printf("lifetime: %u ticks in 1000 cycles\n", (unsigned)(after - before));
+  CHECK(ok, after - before >= 1000 && after - before < 1100);
+
+  mkl_VirtualTimer timer;
+  CHECK(ok, timers.openTimer(timer, std::chrono::milliseconds(10),
+                             std::chrono::milliseconds(1)) == timer_none);
+
+  lifetime.stop();
+  CHECK(ok, wheel.start(1000));
+  CHECK(ok, !lifetime.start());
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,80 @@
+/*!
+ * @brief       Leitura de 64 bits e conversões do mkl_PITLifetimeTimer.
+ *
+ * @file        test_PITLifetimeTimer.cpp
+ *
+ * @details     O contador deve seguir os ciclos do tempo virtual, também
+ *              após o estouro dos 32 bits do canal 0; as conversões para µs
+ *              e ms devem ser iguais à divisão exata, arredondada para
+ *              baixo; e start() deve recusar o canal 0 já habilitado.
+ */
+#include <mkl_PITLifetimeTimer/mkl_PITLifetimeTimer.h>
+#include "hostsim_bench.h"
+
+mkl_PITLifetimeTimer lifetime;
+
+uint64_t exact(uint64_t ticks, uint64_t unitsPerSecond) {
+  return (uint64_t)((unsigned __int128)ticks * unitsPerSecond /
+                    HOSTSIM_BUS_CLOCK);
+}
+
+bool near(uint64_t measured, uint64_t expected) {
+  return measured >= expected && measured < expected + 64;
+}
+
+int main() {
+  bool ok = true;
+
+  CHECK(ok, lifetime.start());
+  uint64_t t0 = lifetime.readTicks();
+  mkl_HostSim::run(1000);
+  uint64_t t1 = lifetime.readTicks();
+  printf("1000 cycles: %llu ticks\n", (unsigned long long)(t1 - t0));
+  CHECK(ok, near(t1 - t0, 1000));
+
+  /*!
+   *  Passa do estouro do canal 0: a parte alta deve contar.
+   */
+  mkl_HostSim::run(0x100000000ull + 5000);
+  uint64_t t2 = lifetime.readTicks();
+  printf("2^32 + 5000 cycles: %llu ticks\n", (unsigned long long)(t2 - t1));
+  CHECK(ok, near(t2 - t1, 0x100000000ull + 5000));
+  CHECK(ok, (t2 >> 32) == 1);
+
+  uint64_t m0 = lifetime.readMilliseconds();
+  mkl_HostSim::run(HOSTSIM_BUS_CLOCK);
+  uint64_t m1 = lifetime.readMilliseconds();
+  printf("1 s: %llu ms\n", (unsigned long long)(m1 - m0));
+  CHECK(ok, m1 - m0 == 1000 || m1 - m0 == 1001);
+
+  const uint64_t samples[] = {
+    0, 1, 3124, 3125, 65535, 65536, 524287, 524288, HOSTSIM_BUS_CLOCK,
+    0xFFFFFFFFull, 0x100000000ull, 123456789012345ull, 0x7FFFFFFFFFFFFFFFull,
+    0xFFFFFFFFFFFFFFFFull
+  };
+  int errors = 0;
+  for (unsigned i = 0; i < sizeof(samples)/sizeof(samples[0]); i++) {
+    if (mkl_PITLifetimeTimer::ticksToMicroseconds(samples[i]) !=
+            exact(samples[i], 1000000) ||
+        mkl_PITLifetimeTimer::ticksToMilliseconds(samples[i]) !=
+            exact(samples[i], 1000)) {
+      printf("conversion of %llu differs\n", (unsigned long long)samples[i]);
+      errors++;
+    }
+  }
+  CHECK(ok, errors == 0);
+
+  /*!
+   *  Com o canal 0 habilitado por outro driver, start() recusa.
+   */
+  lifetime.stop();
+  mkl_PIT other;
+  other.bindChannel(PIT_Ch0);
+  other.setPeriod(20971);
+  other.enableTimer();
+  CHECK(ok, !lifetime.start());
+  other.disableTimer();
+  CHECK(ok, lifetime.start());
+  CHECK(ok, !other.claimChannel());
+  return ok ? 0 : 1;
+}
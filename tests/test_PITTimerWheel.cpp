@@ -0,0 +1,177 @@
+/*!
+ * @brief       Verificação aleatória da mkl_PITTimerWheel com 48
+ *              temporizadores, com tick periódico e sem tick.
+ *
+ * @file        test_PITTimerWheel.cpp
+ *
+ * @details     Um modelo guarda, para cada temporizador, o tick do próximo
+ *              estouro e o período. Uma sequência pseudoaleatória fixa
+ *              inicia, reinicia e cancela temporizadores, de um único
+ *              estouro e periódicos, e avança o tempo simulado. Cada
+ *              estouro deve ocorrer no tick do modelo, uma só vez; um
+ *              cancelado não estoura; e, após cada avanço, nenhum
+ *              temporizador ativo pode estar com o estouro no passado.
+ *
+ *              Um quarto dos temporizadores se reinicia na própria rotina,
+ *              com outra duração, e outro quarto cancela, também na rotina,
+ *              o temporizador seguinte: as duas operações são feitas dentro
+ *              da interrupção, no meio da lista da posição atual.
+ */
+#include <mkl_PITTimerWheel/mkl_PITTimerWheel.h>
+#include "hostsim_bench.h"
+
+static const uint32_t kTickHz = 1000;
+static const uint32_t kCyclesPerTick = HOSTSIM_BUS_CLOCK/kTickHz;
+static const int kTimers = 48;
+static const int kSteps = 3000;
+
+mkl_PITTimerWheel periodicWheel(PIT_Ch0);
+mkl_PITTimerWheel ticklessWheel(PIT_Ch1);
+static mkl_PITTimerWheel *wheel;
+
+/*!
+ *  Estado esperado de um temporizador: "due" = 0 se inativo.
+ */
+struct Model {
+  mkl_SoftTimer timer;
+  uint32_t due;
+  uint32_t period;
+  uint32_t fires;
+};
+
+static Model models[kTimers];
+static uint32_t seed, wrongTick, totalFires, rearms, cancels;
+
+static uint32_t random(uint32_t range) {
+  seed = seed*1664525u + 1013904223u;
+  return (seed >> 8) % range;
+}
+
+/*!
+ *  O tick pode avançar durante o próprio startTimer (no modo sem tick, com
+ *  o tempo simulado; no periódico, com a interrupção atendida ao fim da
+ *  seção crítica): se um tick passou entre as leituras, o estouro do
+ *  modelo é incerto, e o temporizador é reiniciado. O modelo é atualizado
+ *  antes, pois o estouro pode ocorrer dentro do startTimer.
+ */
+static void start(int i, uint32_t ticks, uint32_t period) {
+  uint32_t before, after;
+
+  do {
+    before = wheel->readTicks();
+    models[i].due = before + ticks;
+    models[i].period = period;
+    wheel->startTimer(models[i].timer, ticks, period);
+    after = wheel->readTicks();
+  } while (before != after);
+}
+
+static void cancel(int i) {
+  models[i].due = 0;
+  wheel->cancelTimer(models[i].timer);
+}
+
+static void onExpired(void *context) {
+  int i = static_cast<int>(reinterpret_cast<intptr_t>(context));
+  Model &m = models[i];
+
+  if (m.due == 0 || wheel->readTicks() != m.due) {
+    wrongTick++;
+  }
+  m.fires++;
+  totalFires++;
+  m.due = m.period ? m.due + m.period : 0;
+  if (i % 4 == 1) {
+    start(i, 1 + random(70), m.period);
+    rearms++;
+  } else if (i % 4 == 2 && models[i + 1].due) {
+    cancel(i + 1);
+    cancels++;
+  }
+}
+
+/*!
+ *  Temporizadores ativos no modelo e na roda devem coincidir, e nenhum
+ *  ativo pode ter o estouro no passado.
+ */
+static bool checkState() {
+  uint32_t ticks = wheel->readTicks();
+  bool ok = true;
+
+  for (int i = 0; i < kTimers; i++) {
+    bool active = models[i].due != 0;
+    CHECK(ok, models[i].timer.isActive() == active);
+    CHECK(ok, !active || static_cast<int32_t>(models[i].due - ticks) > 0);
+  }
+  return ok;
+}
+
+static bool run(const char *name, mkl_PITTimerWheel &active, bool tickless) {
+  bool ok = true;
+
+  wheel = &active;
+  seed = 12345;
+  wrongTick = totalFires = rearms = cancels = 0;
+  for (int i = 0; i < kTimers; i++) {
+    models[i].due = models[i].period = models[i].fires = 0;
+    models[i].timer.setCallback(onExpired,
+                                reinterpret_cast<void *>(intptr_t(i)));
+  }
+  CHECK(ok, tickless ? active.startTickless(kTickHz) : active.start(kTickHz));
+
+  for (int step = 0; step < kSteps && ok; step++) {
+    int i = static_cast<int>(random(kTimers));
+    switch (random(4)) {
+      case 0:
+        start(i, 1 + random(100), 0);
+        break;
+      case 1:
+        start(i, 1 + random(100), random(2) ? 1 + random(40) : 0);
+        break;
+      case 2:
+        cancel(i);
+        break;
+      default:
+        mkl_HostSim::run((1 + random(20))*kCyclesPerTick);
+        ok &= checkState();
+        break;
+    }
+  }
+
+  /*!
+   *  Sem novos inícios, os de um único estouro devem terminar.
+   */
+  for (int i = 0; i < kTimers; i++) {
+    if (models[i].period) {
+      cancel(i);
+    }
+  }
+  mkl_HostSim::run(200*kCyclesPerTick);
+  ok &= checkState();
+  for (int i = 0; i < kTimers; i++) {
+    if (models[i].due) {
+      cancel(i);
+    }
+  }
+  active.disableTimer();
+
+  printf("%-10s estouros=%u rearmes=%u cancelamentos=%u fora do tick=%u\n",
+         name, (unsigned)totalFires, (unsigned)rearms, (unsigned)cancels,
+         (unsigned)wrongTick);
+  CHECK(ok, wrongTick == 0);
+  CHECK(ok, totalFires > 1000 && rearms > 100 && cancels > 20);
+  return ok;
+}
+
+extern "C" void PIT_IRQHandler() {
+  wheel->handleInterrupt();
+}
+
+int main() {
+  bool ok = true;
+
+  mkl_HostSim::enableIrq();
+  ok &= run("periodico", periodicWheel, false);
+  ok &= run("sem tick", ticklessWheel, true);
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,37 @@
+/*!
+ * @brief       Medições do mkl_Profiler no SysTick do mkl_HostSim.
+ *
+ * @file        test_Profiler.cpp
+ *
+ * @details     Um trecho vazio, mais curto que o custo descontado, deve
+ *              contar 0 ciclos (sem underflow na soma); um trecho de 1000
+ *              ciclos deve ter média de 1000 ciclos.
+ */
+#include <mkl_Profiler/mkl_Profiler.h>
+#include "hostsim_bench.h"
+
+enum { probe_empty, probe_run };
+
+int main() {
+  bool ok = true;
+
+  mkl_Profiler::start();
+  for (int i = 0; i < 10; i++) {
+    mkl_ProfilerScope scope(probe_empty);
+  }
+  for (int i = 0; i < 10; i++) {
+    mkl_ProfilerScope scope(probe_run);
+    mkl_HostSim::run(1000);
+  }
+
+  printf("empty: count=%u total=%u\n",
+         (unsigned)mkl_Profiler::probes[probe_empty].count,
+         (unsigned)mkl_Profiler::probes[probe_empty].total);
+  printf("run 1000: mean=%u\n", (unsigned)mkl_Profiler::readMean(probe_run));
+  CHECK(ok, mkl_Profiler::probes[probe_empty].count == 10);
+  CHECK(ok, mkl_Profiler::probes[probe_empty].total < 10*8);
+  CHECK(ok, mkl_Profiler::probes[probe_run].count == 10);
+  CHECK(ok, mkl_Profiler::readMean(probe_run) >= 1000 &&
+            mkl_Profiler::readMean(probe_run) <= 1008);
+  return ok ? 0 : 1;
+}
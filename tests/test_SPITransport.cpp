@@ -0,0 +1,106 @@
+/*!
+ * @brief       Envio dos quadros pelo dsf_SPITransport, um byte por
+ *              interrupção do SPI: ordem dos bytes e do pulso do RCLK.
+ *
+ * @file        test_SPITransport.cpp
+ *
+ * @details     O observador do SPI e o dos pinos registram, na ordem do
+ *              tempo virtual, cada byte deslocado e cada borda de subida do
+ *              RCLK, e alimentam um modelo dos dois 74HC595 em cascata: o
+ *              registrador de deslocamento de 16 bits e as saídas copiadas
+ *              na subida do RCLK. Uma varredura completa deve deslocar os 8
+ *              bytes dos quatro quadros, com o RCLK após cada par, e as
+ *              saídas devem mostrar cada quadro inteiro (segmentos, dígito).
+ *
+ *              sendFrames deve retornar antes de qualquer byte terminar, e
+ *              a CPU não espera o SPI: cada byte custa só as leituras do S
+ *              e do D e a escrita do byte seguinte na interrupção. Uma
+ *              chamada com o bloco ainda em envio é ignorada.
+ */
+#include <dsf_SerialDisplays.h>
+#include <dsf_SPITransport.h>
+#include "hostsim_bench.h"
+
+dsf_SPITransport spi(spi_MOSI_PTC7, spi_SCK_PTC5, gpio_PTC3);
+dsf_SerialDisplays disp(&spi);
+
+static const uint32_t kRCLK = 1u << 3;
+
+static char events[64];
+static uint16_t latched[16];
+static uint32_t eventCount, latchCount;
+static uint16_t shiftRegister;
+
+static void observeSpi(uint8_t, uint8_t data, uint64_t) {
+  shiftRegister = static_cast<uint16_t>(shiftRegister << 8 | data);
+  if (eventCount < sizeof(events)) {
+    events[eventCount++] = 'B';
+  }
+}
+
+static void observePins(uint8_t GPIONumber, uint32_t oldLevels,
+                        uint32_t newLevels, uint64_t) {
+  if (GPIONumber != 2 || !(~oldLevels & newLevels & kRCLK)) {
+    return;
+  }
+  if (latchCount < 16) {
+    latched[latchCount++] = shiftRegister;
+  }
+  if (eventCount < sizeof(events)) {
+    events[eventCount++] = 'L';
+  }
+}
+
+extern "C" void SPI0_IRQHandler() { spi.handleInterrupt(); }
+
+int main() {
+  static const uint16_t kFrames[4] = {0x9901, 0xB002, 0xA404, 0xF908};
+  static const uint8_t kOther[2] = {0xFF, 0x0F};
+  bool ok = true;
+
+  mkl_HostSim::setSpiObserver(observeSpi);
+  mkl_HostSim::setPinObserver(observePins);
+  mkl_HostSim::enableIrq();
+  disp.writeWord(1234);
+
+  hostsim_BusStats before, after;
+  mkl_HostSim::readBusStats(&before);
+  disp.updateDisplays();
+  CHECK(ok, eventCount == 0);
+  CHECK(ok, spi.isBusy());
+  spi.sendFrames(kOther, 1);
+  while (spi.isBusy()) {
+    mkl_HostSim::waitForInterrupt();
+  }
+  mkl_HostSim::readBusStats(&after);
+  mkl_HostSim::run(HOSTSIM_BUS_CLOCK/1000);
+
+  printf("eventos=%.*s\n", (int)eventCount, events);
+  CHECK(ok, eventCount == 12);
+  for (uint32_t i = 0; i < eventCount; i++) {
+    CHECK(ok, events[i] == (i % 3 == 2 ? 'L' : 'B'));
+  }
+  CHECK(ok, latchCount == 4);
+  for (uint32_t i = 0; i < latchCount; i++) {
+    printf("quadro %u = %04X\n", (unsigned)i, latched[i]);
+    CHECK(ok, latched[i] == kFrames[i]);
+  }
+
+  /*!
+   *  Sem espera ativa: por byte, duas leituras do S, uma do D e a escrita
+   *  do D.
+   */
+  uint64_t spiReads = after.reads[hostsim_SPI] - before.reads[hostsim_SPI];
+  printf("leituras do SPI=%llu\n", (unsigned long long)spiReads);
+  CHECK(ok, spiReads <= 3*8);
+
+  /*!
+   *  Com o SPI livre, um novo bloco é enviado.
+   */
+  spi.sendFrames(kOther, 1);
+  while (spi.isBusy()) {
+    mkl_HostSim::waitForInterrupt();
+  }
+  CHECK(ok, latchCount == 5 && latched[4] == 0xFF0F);
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,163 @@
+/*!
+ * @brief       mkl_Scheduler no tempo simulado: ordem das prioridades,
+ *              tecla roteirizada e despertar do WFI por uma interrupção.
+ *
+ * @file        test_Scheduler.cpp
+ *
+ * @details     Primeiro, sem interrupções, as tarefas postadas devem rodar
+ *              da maior para a menor prioridade, na ordem da fila dentro
+ *              de uma prioridade, uma só vez por postagem, e uma tarefa
+ *              urgente postada por outra deve passar à frente das que já
+ *              estavam prontas. idle() não pode dormir com tarefa pronta.
+ *
+ *              Depois, o laço do escalonador roda 100 ms de tempo simulado:
+ *              o PIT a 100 Hz posta a tarefa do tick, que posta uma de baixa
+ *              prioridade, e um pulso em PTA12 aos 25 ms, a tecla, gera a
+ *              interrupção da porta, que posta a tarefa da tecla. Entre as
+ *              interrupções a CPU deve dormir (um despertar por
+ *              interrupção), e a tarefa da tecla deve rodar logo após a
+ *              borda, vinda do WFI.
+ */
+#include <string.h>
+#include <mkl_Scheduler/mkl_Scheduler.h>
+#include <mkl_GPIOPort/mkl_GPIOPort.h>
+#include <mkl_PITPeriodicInterrupt/mkl_PITPeriodicInterrupt.h>
+#include "hostsim_bench.h"
+
+static const uint64_t kPressCycles = HOSTSIM_BUS_CLOCK/40;
+
+static char order[32];
+static uint32_t orderCount;
+
+static void record(void *context) {
+  if (orderCount < sizeof(order)) {
+    order[orderCount++] = *static_cast<const char *>(context);
+  }
+}
+
+static mkl_Task highTask(record, (void *)"H", task_high);
+static mkl_Task normalTask(record, (void *)"N", task_normal);
+static mkl_Task secondNormalTask(record, (void *)"M", task_normal);
+static mkl_Task lowTask(record, (void *)"L", task_low);
+
+/*!
+ *  Tarefa normal que posta a urgente: a urgente roda antes da outra normal
+ *  já pronta.
+ */
+static void postUrgent(void *) {
+  record((void *)"P");
+  highTask.post();
+}
+
+static mkl_Task postingTask(postUrgent, 0, task_normal);
+
+mkl_GPIOPort key(gpio_PTA12);
+mkl_PITInterruptInterrupt pit(PIT_Ch0);
+
+static uint32_t ticks, backgroundRuns, keyRuns, wakeups, interrupts;
+static uint64_t keyCycle;
+
+static void onTick(void *) { ticks++; }
+static void onBackground(void *) { backgroundRuns++; }
+static void onKey(void *) {
+  keyRuns++;
+  keyCycle = mkl_HostSim::cycles();
+}
+
+static mkl_Task tickTask(onTick, 0, task_normal);
+static mkl_Task backgroundTask(onBackground, 0, task_low);
+static mkl_Task keyTask(onKey, 0, task_high);
+
+static void postTick(void *) {
+  tickTask.post();
+  backgroundTask.post();
+}
+
+static void onKeyEdge(void *task) {
+  mkl_Scheduler::postTask(task);
+}
+
+extern "C" void PIT_IRQHandler() {
+  interrupts++;
+  pit.clearInterruptFlag();
+  postTick(0);
+}
+
+extern "C" void PORTA_IRQHandler() {
+  interrupts++;
+  mkl_GPIO::handleInterrupt(gpio_GPIOA);
+}
+
+static bool checkPriorities() {
+  bool ok = true;
+
+  mkl_Scheduler::addTask(highTask);
+  mkl_Scheduler::addTask(postingTask);
+  mkl_Scheduler::addTask(normalTask);
+  mkl_Scheduler::addTask(secondNormalTask);
+  mkl_Scheduler::addTask(lowTask);
+
+  lowTask.post();
+  secondNormalTask.post();
+  normalTask.post();
+  normalTask.post();
+  highTask.post();
+  while (mkl_Scheduler::runOnce()) {
+  }
+  printf("ordem=%.*s\n", (int)orderCount, order);
+  CHECK(ok, orderCount == 4 && memcmp(order, "HNML", 4) == 0);
+
+  orderCount = 0;
+  lowTask.post();
+  secondNormalTask.post();
+  postingTask.post();
+  uint64_t before = mkl_HostSim::cycles();
+  mkl_Scheduler::idle();
+  CHECK(ok, mkl_HostSim::cycles() - before < 100);
+  while (mkl_Scheduler::runOnce()) {
+  }
+  printf("ordem=%.*s\n", (int)orderCount, order);
+  CHECK(ok, orderCount == 4 && memcmp(order, "PHML", 4) == 0);
+  return ok;
+}
+
+int main() {
+  bool ok = true;
+
+  ok &= checkPriorities();
+
+  mkl_Scheduler::addTask(keyTask);
+  mkl_Scheduler::addTask(tickTask);
+  mkl_Scheduler::addTask(backgroundTask);
+  key.setPortMode(gpio_input);
+  key.attachInterrupt(onKeyEdge, &keyTask);
+  key.setInterruptMode(gpio_interruptRisingEdge);
+  pit.enablePeripheralModule();
+  pit.setFrequency(100);
+  pit.enableInterruptRequests();
+  mkl_HostSim::enableIrq();
+
+  uint64_t start = mkl_HostSim::cycles();
+  mkl_HostSim::startPulseTrain(0, 12, kPressCycles, kPressCycles/5, 1);
+  pit.enableTimer();
+  while (mkl_HostSim::cycles() - start < HOSTSIM_BUS_CLOCK/10) {
+    while (mkl_Scheduler::runOnce()) {
+    }
+    mkl_Scheduler::idle();
+    wakeups++;
+  }
+  pit.disableTimer();
+  while (mkl_Scheduler::runOnce()) {
+  }
+
+  uint64_t latency = keyCycle - (start + kPressCycles);
+  printf("ticks=%u baixa=%u tecla=%u latencia=%llu despertares=%u "
+         "interrupcoes=%u\n", (unsigned)ticks, (unsigned)backgroundRuns,
+         (unsigned)keyRuns, (unsigned long long)latency, (unsigned)wakeups,
+         (unsigned)interrupts);
+  CHECK(ok, ticks == 10 && backgroundRuns == 10);
+  CHECK(ok, keyRuns == 1);
+  CHECK(ok, keyCycle > start + kPressCycles && latency < 200);
+  CHECK(ok, wakeups == interrupts);
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,162 @@
+/*!
+ * @brief       Delays assíncronos do mkl_TPMDelay: delay único com rotina,
+ *              temporização periódica, cancelamento e delays simultâneos
+ *              nos três TPMs.
+ *
+ * @file        test_TPMDelay.cpp
+ *
+ * @details     Cada rotina anota o ciclo do simulador em que foi chamada.
+ *              O TOF sobe na passagem de MOD para zero, i.e., "cycles" + 1
+ *              contagens depois do início, e cada contagem vale divBase
+ *              ciclos do barramento.
+ *
+ *              O delay único deve chamar a rotina uma vez, no ciclo
+ *              esperado; o periódico, uma vez por período, sem acumular a
+ *              latência, até o cancelDelay; um delay cancelado não chama a
+ *              rotina; e os delays de durações diferentes no TPM0, no TPM1
+ *              e no TPM2 terminam cada um no seu ciclo.
+ */
+#include <mkl_TPMDelay/mkl_TPMDelay.h>
+#include "hostsim_bench.h"
+
+static const uint32_t kMaxFires = 16;
+
+/*!
+ *  Ciclos do simulador em que a rotina de um delay foi chamada.
+ */
+struct Fires {
+  uint64_t cycle[kMaxFires];
+  uint32_t count;
+};
+
+mkl_TPMDelay delay0(tpm_TPM0);
+mkl_TPMDelay delay1(tpm_TPM1);
+mkl_TPMDelay delay2(tpm_TPM2);
+
+extern "C" void TPM0_IRQHandler() {
+  mkl_TPMDelay::handleInterrupt(tpm_TPM0);
+}
+
+extern "C" void TPM1_IRQHandler() {
+  mkl_TPMDelay::handleInterrupt(tpm_TPM1);
+}
+
+extern "C" void TPM2_IRQHandler() {
+  mkl_TPMDelay::handleInterrupt(tpm_TPM2);
+}
+
+static void onFire(void *context) {
+  Fires *fires = static_cast<Fires *>(context);
+
+  if (fires->count < kMaxFires) {
+    fires->cycle[fires->count] = mkl_HostSim::cycles();
+  }
+  fires->count++;
+}
+
+/*!
+ *  Verifica que o disparo "index" ocorreu "expected" ciclos depois de
+ *  "start", com a tolerância de latência da interrupção.
+ */
+static bool firedAt(const Fires &fires, uint32_t index, uint64_t start,
+                    uint64_t expected) {
+  if (index >= fires.count || index >= kMaxFires) {
+    return false;
+  }
+  uint64_t elapsed = fires.cycle[index] - start;
+  return elapsed >= expected && elapsed < expected + 100;
+}
+
+static bool checkOneShot() {
+  Fires fires = {{0}, 0};
+  bool ok = true;
+
+  CHECK(ok, delay0.setFrequency(tpm_div4));
+  uint64_t start = mkl_HostSim::cycles();
+  CHECK(ok, delay0.startDelay(999, onFire, &fires));
+  CHECK(ok, delay0.isPending());
+  mkl_HostSim::run(3*1000*4);
+
+  printf("delay unico: disparos=%u ciclos=%u\n", (unsigned)fires.count,
+         (unsigned)(fires.cycle[0] - start));
+  CHECK(ok, fires.count == 1);
+  CHECK(ok, firedAt(fires, 0, start, 1000*4));
+  CHECK(ok, !delay0.isPending());
+  return ok;
+}
+
+static bool checkPeriodic() {
+  Fires fires = {{0}, 0};
+  bool ok = true;
+
+  CHECK(ok, delay1.setFrequency(tpm_div1));
+  uint64_t start = mkl_HostSim::cycles();
+  CHECK(ok, delay1.startPeriodic(4999, onFire, &fires));
+  mkl_HostSim::run(10*5000 + 2500);
+  delay1.cancelDelay();
+  uint32_t count = fires.count;
+  mkl_HostSim::run(5*5000);
+
+  printf("periodico: disparos=%u depois do cancelamento=%u\n",
+         (unsigned)count, (unsigned)(fires.count - count));
+  CHECK(ok, count == 10);
+  for (uint32_t i = 0; i < count; i++) {
+    CHECK(ok, firedAt(fires, i, start, (i + 1)*5000));
+  }
+  CHECK(ok, fires.count == count);
+  CHECK(ok, !delay1.isPending());
+  return ok;
+}
+
+static bool checkCancel() {
+  Fires fires = {{0}, 0};
+  bool ok = true;
+
+  CHECK(ok, delay2.setFrequency(tpm_div1));
+  CHECK(ok, delay2.startDelay(9999, onFire, &fires));
+  mkl_HostSim::run(5000);
+  delay2.cancelDelay();
+  mkl_HostSim::run(20000);
+
+  printf("cancelado: disparos=%u\n", (unsigned)fires.count);
+  CHECK(ok, fires.count == 0);
+  CHECK(ok, !delay2.isPending());
+  return ok;
+}
+
+static bool checkConcurrent() {
+  Fires fires[3] = {{{0}, 0}, {{0}, 0}, {{0}, 0}};
+  bool ok = true;
+
+  CHECK(ok, delay0.setFrequency(tpm_div1));
+  CHECK(ok, delay1.setFrequency(tpm_div2));
+  CHECK(ok, delay2.setFrequency(tpm_div8));
+  uint64_t start = mkl_HostSim::cycles();
+  CHECK(ok, delay2.startDelay(2999, onFire, &fires[2]));
+  CHECK(ok, delay0.startDelay(7999, onFire, &fires[0]));
+  CHECK(ok, delay1.startDelay(1999, onFire, &fires[1]));
+  mkl_HostSim::run(30000);
+
+  printf("simultaneos: TPM0=%u TPM1=%u TPM2=%u ciclos\n",
+         (unsigned)(fires[0].cycle[0] - start),
+         (unsigned)(fires[1].cycle[0] - start),
+         (unsigned)(fires[2].cycle[0] - start));
+  for (uint32_t i = 0; i < 3; i++) {
+    CHECK(ok, fires[i].count == 1);
+  }
+  CHECK(ok, firedAt(fires[0], 0, start, 8000));
+  CHECK(ok, firedAt(fires[1], 0, start, 2000*2));
+  CHECK(ok, firedAt(fires[2], 0, start, 3000*8));
+  return ok;
+}
+
+int main() {
+  bool ok = true;
+
+  mkl_HostSim::enableIrq();
+  ok &= checkOneShot();
+  ok &= checkPeriodic();
+  ok &= checkCancel();
+  ok &= checkConcurrent();
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,138 @@
+/*!
+ * @brief       Captura de entrada do mkl_TPMInputCapture com trens de
+ *              pulsos: tacômetro de 40 Hz, captura nas duas bordas a 60 Hz
+ *              e descarte com o buffer cheio.
+ *
+ * @file        test_TPMInputCapture.cpp
+ *
+ * @details     O tacômetro, no TPM1 canal 0 (PTA12) com tpm_div16, recebe
+ *              20 pulsos de 40 Hz, e cada período deve ter exatamente as
+ *              32768 contagens de 1/40 s, ou 40,00 Hz.
+ *
+ *              O sinal de 60 Hz, no TPM2 canal 0 (PTA1) com tpm_div1, tem
+ *              um quarto do período em '1'. Capturado nas duas bordas, os
+ *              períodos alternam a largura do pulso e a do intervalo,
+ *              maiores que o MOD de 0xFFFF: a marca estendida pelos
+ *              estouros deve dar as contagens exatas, e a soma de um par,
+ *              60,00 Hz.
+ *
+ *              Sem leituras, o buffer de kBufferSize entradas guarda
+ *              kBufferSize - 1 períodos, e os demais são contados em
+ *              readOverruns.
+ */
+#include <mkl_TPMInputCapture/mkl_TPMInputCapture.h>
+#include "hostsim_bench.h"
+
+static const uint32_t kTachPeriod = HOSTSIM_TPM_CLOCK/40;
+static const uint32_t kSignalPeriod = HOSTSIM_TPM_CLOCK/60;
+static const uint32_t kSignalHigh = kSignalPeriod/4;
+
+mkl_TPMInputCapture tach(tpm_PTA12);
+mkl_TPMInputCapture signal60(tpm_PTA1);
+
+extern "C" void TPM1_IRQHandler() {
+  mkl_TPMInputCapture::handleInterrupt(tpm_TPM1);
+}
+
+extern "C" void TPM2_IRQHandler() {
+  mkl_TPMInputCapture::handleInterrupt(tpm_TPM2);
+}
+
+/*!
+ *  Roda "pulses" períodos de "period" ciclos, lendo o buffer a cada
+ *  período, e retorna os períodos lidos.
+ */
+static uint32_t collect(mkl_TPMInputCapture &capture, uint32_t period,
+                        uint32_t pulses, uint32_t *periods, uint32_t max) {
+  uint32_t count = 0;
+
+  for (uint32_t i = 0; i <= pulses; i++) {
+    mkl_HostSim::run(period);
+    count += capture.readPeriods(periods + count,
+                                 static_cast<uint8_t>(max - count));
+  }
+  return count;
+}
+
+static bool checkTach() {
+  uint32_t periods[32];
+  bool ok = true;
+
+  CHECK(ok, tach.setFrequency(tpm_div16));
+  CHECK(ok, tach.enableCapture(tpm_rising));
+  mkl_HostSim::startPulseTrain(0, 12, kTachPeriod, kTachPeriod/10, 20);
+  uint32_t count = collect(tach, kTachPeriod, 20, periods, 32);
+  tach.disableCapture();
+
+  printf("tacometro: periodos=%u primeiro=%u freq=%u cHz overruns=%u\n",
+         (unsigned)count, (unsigned)periods[0],
+         (unsigned)tach.toCentiHertz(periods[0]),
+         (unsigned)tach.readOverruns());
+  CHECK(ok, count == 19);
+  for (uint32_t i = 0; i < count; i++) {
+    CHECK(ok, periods[i] == kTachPeriod/16);
+    CHECK(ok, tach.toCentiHertz(periods[i]) == 4000);
+  }
+  CHECK(ok, tach.readOverruns() == 0);
+  return ok;
+}
+
+static bool checkBothEdges() {
+  uint32_t periods[32];
+  bool ok = true;
+
+  CHECK(ok, signal60.setFrequency(tpm_div1));
+  CHECK(ok, signal60.enableCapture(tpm_both));
+  mkl_HostSim::startPulseTrain(0, 1, kSignalPeriod, kSignalHigh, 10);
+  uint32_t count = collect(signal60, kSignalPeriod, 10, periods, 32);
+
+  printf("60 Hz: periodos=%u alto=%u baixo=%u freq=%u cHz\n",
+         (unsigned)count, (unsigned)periods[0], (unsigned)periods[1],
+         (unsigned)signal60.toCentiHertz(periods[0] + periods[1]));
+  CHECK(ok, count == 19);
+  for (uint32_t i = 0; i < count; i++) {
+    CHECK(ok, periods[i] == (i % 2 == 0 ? kSignalHigh
+                                        : kSignalPeriod - kSignalHigh));
+  }
+  for (uint32_t i = 0; i + 1 < count; i += 2) {
+    CHECK(ok, signal60.toCentiHertz(periods[i] + periods[i + 1]) == 6000);
+  }
+  CHECK(ok, signal60.readOverruns() == 0);
+  return ok;
+}
+
+static bool checkOverrun() {
+  uint32_t periods[32];
+  bool ok = true;
+
+  /*!
+   *  Captura reiniciada (sem a última marca) e 30 pulsos nas duas bordas,
+   *  sem leitura: 59 períodos.
+   */
+  CHECK(ok, signal60.enableCapture(tpm_both));
+  mkl_HostSim::startPulseTrain(0, 1, kSignalPeriod, kSignalHigh, 30);
+  mkl_HostSim::run(31*kSignalPeriod);
+  uint32_t count = signal60.readPeriods(periods, 32);
+  uint32_t overruns = signal60.readOverruns();
+  signal60.disableCapture();
+
+  printf("sem leitura: guardados=%u descartados=%u\n", (unsigned)count,
+         (unsigned)overruns);
+  CHECK(ok, count == mkl_TPMInputCapture::kBufferSize - 1);
+  CHECK(ok, count + overruns == 59);
+  for (uint32_t i = 0; i < count; i++) {
+    CHECK(ok, periods[i] == (i % 2 == 0 ? kSignalHigh
+                                        : kSignalPeriod - kSignalHigh));
+  }
+  return ok;
+}
+
+int main() {
+  bool ok = true;
+
+  mkl_HostSim::enableIrq();
+  ok &= checkTach();
+  ok &= checkBothEdges();
+  ok &= checkOverrun();
+  return ok ? 0 : 1;
+}
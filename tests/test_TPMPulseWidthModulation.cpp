@@ -0,0 +1,152 @@
+/*!
+ * @brief       Larguras, troca no fim do período e alinhamento no centro do
+ *              mkl_TPMPulseWidthModulation, e o dsf_DisplayDimmer.
+ *
+ * @file        test_TPMPulseWidthModulation.cpp
+ *
+ * @details     O observador de pinos registra as bordas do PTD4 (TPM0,
+ *              canal 4) e do PTC2 (TPM0, canal 1, OE do dimmer). As
+ *              larguras e os períodos medidos são comparados com o CnV e o
+ *              MOD programados, em ciclos do TPM (tpm_div1).
+ */
+#include <mkl_TPMPulseWidthModulation/mkl_TPMPulseWidthModulation.h>
+#include <dsf_DisplayDimmer.h>
+#include "hostsim_bench.h"
+
+static const int kMaxEdges = 256;
+
+static uint8_t watchedPort;
+static uint32_t watchedBit;
+static uint64_t rises[kMaxEdges], falls[kMaxEdges];
+static int nRises, nFalls;
+
+static void observePins(uint8_t GPIONumber, uint32_t oldLevels,
+                        uint32_t newLevels, uint64_t cycle) {
+  if (GPIONumber != watchedPort || !((oldLevels ^ newLevels) & watchedBit)) {
+    return;
+  }
+  if ((newLevels & watchedBit) && nRises < kMaxEdges) {
+    rises[nRises++] = cycle;
+  } else if (!(newLevels & watchedBit) && nFalls < kMaxEdges) {
+    falls[nFalls++] = cycle;
+  }
+}
+
+static void watch(uint8_t GPIONumber, uint8_t pinNumber) {
+  watchedPort = GPIONumber;
+  watchedBit = 1u << pinNumber;
+  nRises = nFalls = 0;
+}
+
+/*!
+ *  Confere períodos (entre subidas) e larguras em '1' (subida até a
+ *  descida seguinte) contra os valores esperados; "widthB" é a largura
+ *  aceita após uma troca do CnV (0 se não houve troca).
+ */
+static bool checkPulses(const char *name, uint64_t period, uint64_t widthA,
+                        uint64_t widthB) {
+  bool ok = true;
+  int changes = 0, pulses = 0;
+  uint64_t last = widthA;
+
+  for (int r = 1; r < nRises; r++) {
+    CHECK(ok, rises[r] - rises[r - 1] == period);
+  }
+  for (int r = 0, f = 0; r < nRises; r++) {
+    while (f < nFalls && falls[f] < rises[r]) {
+      f++;
+    }
+    if (f == nFalls) {
+      break;
+    }
+    uint64_t width = falls[f] - rises[r];
+    pulses++;
+    CHECK(ok, width == widthA || (widthB && width == widthB));
+    if (width != last) {
+      changes++;
+      last = width;
+    }
+  }
+  printf("%-24s pulses=%d period=%llu changes=%d\n", name, pulses,
+         (unsigned long long)period, changes);
+  CHECK(ok, pulses > 4);
+  CHECK(ok, changes == (widthB ? 1 : 0));
+  return ok;
+}
+
+int main() {
+  bool ok = true;
+  mkl_TPMPulseWidthModulation fan(tpm_PTD4);
+
+  mkl_HostSim::setPinObserver(observePins);
+
+  /*!
+   *  Alinhado na borda: período de MOD + 1 e largura de CnV contagens.
+   */
+  watch(3, 4);
+  fan.setDutyCycle(250);
+  fan.enableOutput(tpm_highTrue);
+  fan.setFrequency(tpm_div1, 999);
+  mkl_HostSim::run(20000);
+  ok &= checkPulses("edge 250/1000", 1000, 250, 0);
+
+  /*!
+   *  Troca no meio do período: o período corrente termina com a largura
+   *  antiga, e a nova vale do seguinte em diante, sem mistura.
+   */
+  watch(3, 4);
+  mkl_HostSim::run(10000 + 400);
+  fan.setDutyCycle(600);
+  mkl_HostSim::run(10000);
+  ok &= checkPulses("edge 250 -> 600", 1000, 250, 600);
+
+  /*!
+   *  CnV = 0 mantém a saída em '0'; CnV > MOD a mantém em '1'.
+   */
+  fan.setDutyCycle(0);
+  mkl_HostSim::run(2000);
+  watch(3, 4);
+  mkl_HostSim::run(5000);
+  CHECK(ok, nRises == 0 && !(mkl_HostSim::readOutputPins(3) & (1u << 4)));
+  fan.setDutyCycle(1000);
+  mkl_HostSim::run(2000);
+  watch(3, 4);
+  mkl_HostSim::run(5000);
+  CHECK(ok, nFalls == 0 && (mkl_HostSim::readOutputPins(3) & (1u << 4)));
+
+  /*!
+   *  Alinhado no centro: período de 2*MOD e largura de 2*CnV.
+   */
+  fan.setDutyCycle(100);
+  fan.setFrequency(tpm_div1, 500, tpm_centerAligned);
+  mkl_HostSim::run(2000);
+  watch(3, 4);
+  mkl_HostSim::run(20000);
+  ok &= checkPulses("center 200/1000", 1000, 200, 0);
+  CHECK(ok, fan.readModulo() == 500 && fan.readDutyCycle() == 100);
+  fan.disableOutput();
+
+  /*!
+   *  Dimmer no OE: pulsos em '0' de "level" contagens a cada 255.
+   */
+  dsf_DisplayDimmer dimmer(tpm_PTC2);
+  dimmer.setBrightness(64);
+  mkl_HostSim::run(1000);
+  watch(2, 2);
+  mkl_HostSim::run(10000);
+  uint64_t lowWidth = 0;
+  for (int f = 0; f < nFalls; f++) {
+    for (int r = 0; r < nRises; r++) {
+      if (rises[r] > falls[f]) {
+        lowWidth = rises[r] - falls[f];
+        break;
+      }
+    }
+  }
+  printf("dimmer 64/255: low=%llu\n", (unsigned long long)lowWidth);
+  CHECK(ok, lowWidth == 64);
+  for (int f = 1; f < nFalls; f++) {
+    CHECK(ok, falls[f] - falls[f - 1] == 255);
+  }
+  return ok ? 0 : 1;
+}
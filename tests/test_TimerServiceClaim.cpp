@@ -0,0 +1,76 @@
+/*!
+ * @brief       Reserva dos TPM e dos canais do PIT entre o mkl_TimerService
+ *              e os outros drivers.
+ *
+ * @file        test_TimerServiceClaim.cpp
+ *
+ * @details     Um PWM configurado antes tira o TPM0 do serviço; uma captura
+ *              no TPM que o serviço abriu é recusada até o temporizador ser
+ *              fechado; e, com o mkl_PITLifetimeTimer, o serviço recusa o
+ *              tick nos dois canais do PIT.
+ */
+#include <mkl_TimerService/mkl_TimerService.h>
+#include <mkl_TPMPulseWidthModulation/mkl_TPMPulseWidthModulation.h>
+#include <mkl_TPMInputCapture/mkl_TPMInputCapture.h>
+#include <mkl_PITLifetimeTimer/mkl_PITLifetimeTimer.h>
+#include "hostsim_bench.h"
+
+using std::chrono::microseconds;
+
+mkl_TPMPulseWidthModulation fan(tpm_PTD4);
+mkl_TPMInputCapture tach(tpm_PTA12);
+mkl_TimerService timers(PIT_Ch1);
+mkl_TimerService timersOnCh0(PIT_Ch0);
+mkl_PITLifetimeTimer lifetime;
+
+int main() {
+  bool ok = true;
+  mkl_VirtualTimer scan, fast;
+
+  /*!
+   *  Com o contador de 64 bits, nenhum canal do PIT serve para o tick.
+   */
+  CHECK(ok, lifetime.start());
+  CHECK(ok, !timersOnCh0.start(1000));
+  CHECK(ok, !timers.start(1000));
+  lifetime.stop();
+
+  /*!
+   *  Canal 1 encadeado por fora dos drivers: o tick no canal 0 é recusado
+   *  mesmo com o canal 0 livre.
+   */
+  mkl_PIT chained;
+  chained.bindChannel(PIT_Ch1);
+  chained.enableChainMode();
+  CHECK(ok, !timersOnCh0.start(1000));
+  chained.disableChainMode();
+
+  CHECK(ok, fan.setFrequency(tpm_div1, 1047));
+  CHECK(ok, fan.enableOutput(tpm_highTrue));
+  CHECK(ok, timers.start(1000));
+
+  timers.openTimer(scan, microseconds(312), microseconds(1));
+  printf("scan: resource=%d\n", scan.readResource());
+  CHECK(ok, scan.readResource() == timer_TPM1);
+  CHECK(ok, !tach.setFrequency(tpm_div16));
+  CHECK(ok, !tach.enableCapture(tpm_rising));
+
+  timers.openTimer(fast, microseconds(100), microseconds(1));
+  CHECK(ok, fast.readResource() == timer_TPM2);
+
+  timers.closeTimer(scan);
+  CHECK(ok, tach.setFrequency(tpm_div16));
+  CHECK(ok, tach.enableCapture(tpm_rising));
+  timers.openTimer(scan, microseconds(312), microseconds(1));
+  printf("scan after capture: resource=%d\n", scan.readResource());
+  CHECK(ok, scan.readResource() == timer_PIT0);
+
+  /*!
+   *  Os drivers do TPM também se recusam entre si.
+   */
+  mkl_TPMDelay delay(tpm_TPM0);
+  CHECK(ok, !delay.startDelay(1000));
+  mkl_TPMPulseWidthModulation led(tpm_PTA13);
+  CHECK(ok, !led.setFrequency(tpm_div1, 1047));
+  return ok ? 0 : 1;
+}
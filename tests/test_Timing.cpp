@@ -0,0 +1,101 @@
+/*!
+ * @brief       Divisor, módulo e erro de mkl_TPMTiming::from e
+ *              mkl_PITTiming::from, na compilação e em tempo de execução.
+ *
+ * @file        test_Timing.cpp
+ *
+ * @details     Os static_assert conferem, na compilação, os valores de
+ *              algumas durações contra as contas feitas à mão, com
+ *              TPM_CLOCK = PIT_BUS_CLOCK = 20971520 Hz:
+ *
+ *              - 30 ms = 629145,6 ciclos: cabe no tpm_div16, com
+ *                39322 contagens (módulo 39321) e 305 ns a mais;
+ *              - 100 ms = 2097152 ciclos: exatos no tpm_div32, módulo
+ *                65535;
+ *              - 400 ms: o maior delay do TPM, exato no tpm_div128;
+ *              - 1/60 s = 349525,33 ciclos: LDVALn 349524, 15 ns a menos.
+ *
+ *              Uma duração fora do alcance em uma variável constexpr não
+ *              compila (1 s no TPM, 300 s no PIT), por isso o caso é
+ *              conferido em tempo de execução, em que from() retorna o
+ *              maior delay com errorNs = kOutOfRange.
+ */
+#include <mkl_TPM/mkl_TPM.h>
+#include <mkl_PIT/mkl_PIT.h>
+#include "hostsim_bench.h"
+
+using std::chrono::microseconds;
+using std::chrono::milliseconds;
+using std::chrono::nanoseconds;
+using std::chrono::seconds;
+
+typedef std::chrono::duration<int32_t, std::ratio<1, 60> > sixtieths;
+
+constexpr mkl_TPMTiming kTpm1us = mkl_TPMTiming::from(microseconds(1));
+constexpr mkl_TPMTiming kTpm1ms = mkl_TPMTiming::from(milliseconds(1));
+constexpr mkl_TPMTiming kTpm30ms = mkl_TPMTiming::from(milliseconds(30));
+constexpr mkl_TPMTiming kTpm100ms = mkl_TPMTiming::from(milliseconds(100));
+constexpr mkl_TPMTiming kTpm400ms = mkl_TPMTiming::from(milliseconds(400));
+
+static_assert(kTpm1us.div == tpm_div1 && kTpm1us.modulo == 20 &&
+              kTpm1us.errorNs == 1, "1 us no TPM");
+static_assert(kTpm1ms.div == tpm_div1 && kTpm1ms.modulo == 20971 &&
+              kTpm1ms.errorNs == 23, "1 ms no TPM");
+static_assert(kTpm30ms.div == tpm_div16 && kTpm30ms.modulo == 39321 &&
+              kTpm30ms.errorNs == 305, "30 ms no TPM");
+static_assert(kTpm100ms.div == tpm_div32 && kTpm100ms.modulo == 0xFFFF &&
+              kTpm100ms.errorNs == 0, "100 ms no TPM");
+static_assert(kTpm400ms.div == tpm_div128 && kTpm400ms.modulo == 0xFFFF &&
+              kTpm400ms.errorNs == 0, "400 ms no TPM");
+
+constexpr mkl_PITTiming kPit1us = mkl_PITTiming::from(microseconds(1));
+constexpr mkl_PITTiming kPit1ms = mkl_PITTiming::from(milliseconds(1));
+constexpr mkl_PITTiming kPit60Hz = mkl_PITTiming::from(sixtieths(1));
+constexpr mkl_PITTiming kPit1s = mkl_PITTiming::from(seconds(1));
+constexpr mkl_PITTiming kPit200s = mkl_PITTiming::from(seconds(200));
+
+static_assert(kPit1us.ldval == 20 && kPit1us.errorNs == 1, "1 us no PIT");
+static_assert(kPit1ms.ldval == 20971 && kPit1ms.errorNs == 23,
+              "1 ms no PIT");
+static_assert(kPit60Hz.ldval == 349524 && kPit60Hz.errorNs == -15,
+              "1/60 s no PIT");
+static_assert(kPit1s.ldval == 20971519 && kPit1s.errorNs == 0, "1 s no PIT");
+static_assert(kPit200s.ldval == 4194303999u && kPit200s.errorNs == 0,
+              "200 s no PIT");
+
+/*!
+ *  Durações lidas de uma variável volatile, fora de uma expressão
+ *  constante: from() é avaliado em tempo de execução.
+ */
+static volatile int32_t runtimeScale = 1;
+
+static bool checkOutOfRange() {
+  bool ok = true;
+
+  mkl_TPMTiming tpmLong = mkl_TPMTiming::from(seconds(runtimeScale));
+  mkl_TPMTiming tpmShort = mkl_TPMTiming::from(nanoseconds(10*runtimeScale));
+  mkl_TPMTiming tpm30ms = mkl_TPMTiming::from(milliseconds(30*runtimeScale));
+  mkl_PITTiming pitLong = mkl_PITTiming::from(seconds(300*runtimeScale));
+  mkl_PITTiming pitShort = mkl_PITTiming::from(nanoseconds(10*runtimeScale));
+  mkl_PITTiming pit1ms = mkl_PITTiming::from(milliseconds(runtimeScale));
+
+  printf("TPM 1 s: div=%d modulo=%u erro=%d\n", (int)tpmLong.div,
+         (unsigned)tpmLong.modulo, (int)tpmLong.errorNs);
+  printf("PIT 300 s: ldval=%u erro=%d\n", (unsigned)pitLong.ldval,
+         (int)pitLong.errorNs);
+  CHECK(ok, tpmLong.div == tpm_div128 && tpmLong.modulo == 0xFFFF);
+  CHECK(ok, tpmLong.errorNs == mkl_TPMTiming::kOutOfRange);
+  CHECK(ok, tpmShort.errorNs == mkl_TPMTiming::kOutOfRange);
+  CHECK(ok, tpm30ms.div == kTpm30ms.div && tpm30ms.modulo == kTpm30ms.modulo &&
+            tpm30ms.errorNs == kTpm30ms.errorNs);
+  CHECK(ok, pitLong.ldval == 0xFFFFFFFF);
+  CHECK(ok, pitLong.errorNs == mkl_PITTiming::kOutOfRange);
+  CHECK(ok, pitShort.errorNs == mkl_PITTiming::kOutOfRange);
+  CHECK(ok, pit1ms.ldval == kPit1ms.ldval &&
+            pit1ms.errorNs == kPit1ms.errorNs);
+  return ok;
+}
+
+int main() {
+  return checkOutOfRange() ? 0 : 1;
+}
@@ -0,0 +1,89 @@
+/*!
+ * @brief       Codificação dos segmentos de todos os caracteres da tabela
+ *              de glifos do dsf_SerialDisplays.
+ *
+ * @file        test_glyphs.cpp
+ *
+ * @details     A tabela kSegments descreve cada caractere ASCII imprimível
+ *              pelas letras dos segmentos acesos (a a g, ponto em p), como no
+ *              desenho do display; vazia quando o caractere não tem
+ *              representação. Cada glifo deve ser o byte de catodo comum em
+ *              '0' correspondente. Uma mudança na tabela do driver exige a
+ *              mesma mudança aqui.
+ */
+#include <string.h>
+#include <dsf_SerialDisplays.h>
+#include "hostsim_bench.h"
+
+static const char *const kSegments[95] = {
+  "",       "",       "bf",     "",       "",       "",       "",       "b",
+  "",       "",       "abfg",   "",       "",       "g",      "",       "",
+  "abcdef", "bc",     "abdeg",  "abcdg",  "bcfg",   "acdfg",  "acdefg", "abc",
+  "abcdefg", "abcdfg", "",      "",       "",       "dg",     "",       "",
+  "",       "abcefg", "cdefg",  "adef",   "bcdeg",  "adefg",  "aefg",   "acdef",
+  "bcefg",  "ef",     "bcde",   "",       "def",    "",       "abcef",  "abcdef",
+  "abefg",  "abcfg",  "eg",     "acdfg",  "defg",   "bcdef",  "",       "",
+  "",       "bcdfg",  "abdeg",  "adef",   "",       "abcd",   "",       "d",
+  "",       "abcefg", "cdefg",  "deg",    "bcdeg",  "adefg",  "aefg",   "acdef",
+  "cefg",   "e",      "bcde",   "",       "def",    "",       "ceg",    "cdeg",
+  "abefg",  "abcfg",  "eg",     "acdfg",  "defg",   "cde",    "",       "",
+  "",       "bcdfg",  "abdeg",  "",       "",       "",       ""
+};
+
+/*!
+ *  Byte dos segmentos (catodo em '0') descrito pelas letras.
+ */
+static uint8_t encode(const char *segments) {
+  uint8_t on = 0;
+  for (; *segments; segments++) {
+    on |= 1 << (*segments == 'p' ? 7 : *segments - 'a');
+  }
+  return ~on;
+}
+
+/*!
+ *  Transporte que só guarda os quadros recebidos.
+ */
+class CaptureTransport : public dsf_DisplayTransport {
+ public:
+  uint8_t frames[8];
+
+  void sendFrames(const uint8_t *frames, uint8_t count) {
+    memcpy(this->frames, frames, 2*count);
+  }
+};
+
+static_assert(dsf_SerialDisplays::glyph('8') == 0x80,
+              "glyph deve ser avaliado na compilação");
+
+int main() {
+  CaptureTransport capture;
+  dsf_SerialDisplays disp(&capture);
+  bool ok = true;
+
+  for (int c = 0x20; c < 0x7F; c++) {
+    uint8_t expected = encode(kSegments[c - 0x20]);
+    char text[2] = {(char)c, 0};
+    if (dsf_SerialDisplays::glyph(c) != expected) {
+      printf("glyph('%c') = 0x%02X, esperado 0x%02X\n", c,
+             dsf_SerialDisplays::glyph(c), expected);
+      ok = false;
+    }
+    // O ponto se junta ao dígito anterior; os demais vão para o dígito 0.
+    if (c != '.') {
+      disp.writeString(text);
+      disp.updateDisplays();
+      CHECK(ok, capture.frames[0] == expected);
+    }
+  }
+  CHECK(ok, dsf_SerialDisplays::glyph('\t') == 0xFF);
+  CHECK(ok, dsf_SerialDisplays::glyph(0x7F) == 0xFF);
+
+  disp.writeString("2.5");
+  disp.updateDisplays();
+  CHECK(ok, capture.frames[2] == (encode("abdeg") & ~0x80));
+  CHECK(ok, capture.frames[0] == encode("acdfg"));
+
+  printf("glifos: %s\n", ok ? "ok" : "divergentes");
+  return ok ? 0 : 1;
+}
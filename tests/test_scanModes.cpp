@@ -0,0 +1,116 @@
+/*!
+ * @brief       Ciclo de trabalho de cada dígito e taxa de atualização nos
+ *              modos de varredura do dsf_SerialDisplays.
+ *
+ * @file        test_scanModes.cpp
+ *
+ * @details     O observador de pinos reconstrói o registrador de
+ *              deslocamento dos 74HC595 a partir do DIO (PTC7) e do SCLK
+ *              (PTC0) e, a cada borda de subida do RCLK (PTC3), mede por
+ *              quanto tempo o quadro anterior ficou nas saídas. O PIT é
+ *              programado com scanFrequency(100) e a varredura roda por 1 s
+ *              de tempo simulado em cada modo.
+ */
+#include <dsf_SerialDisplays.h>
+#include <dsf_BitBangTransport.h>
+#include <mkl_PITPeriodicInterrupt/mkl_PITPeriodicInterrupt.h>
+#include "hostsim_bench.h"
+
+static const uint32_t kRefreshHz = 100;
+
+dsf_BitBangTransport bitBang(gpio_PTC7, gpio_PTC0, gpio_PTC3);
+dsf_SerialDisplays disp(&bitBang);
+mkl_PITInterruptInterrupt pit(PIT_Ch0);
+
+static uint32_t shiftRegister, latched;
+static uint64_t latchedAt, litCycles[4], totalCycles;
+static uint32_t latches[4];
+
+/*!
+ *  Bordas de subida do SCLK deslocam o DIO; as do RCLK mostram o quadro.
+ */
+static void observePins(uint8_t GPIONumber, uint32_t oldLevels,
+                        uint32_t newLevels, uint64_t cycle) {
+  if (GPIONumber != 2) {
+    return;
+  }
+  if (!(oldLevels & (1 << 0)) && (newLevels & (1 << 0))) {
+    shiftRegister = (shiftRegister << 1) | ((newLevels >> 7) & 1);
+  }
+  if (!(oldLevels & (1 << 3)) && (newLevels & (1 << 3))) {
+    if (latchedAt) {
+      for (int i = 0; i < 4; i++) {
+        if ((latched & (1 << i)) && (latched >> 8) != 0xFF) {
+          litCycles[i] += cycle - latchedAt;
+        }
+      }
+      totalCycles += cycle - latchedAt;
+    }
+    latched = shiftRegister & 0xFFFF;
+    latchedAt = cycle;
+    for (int i = 0; i < 4; i++) {
+      latches[i] += (latched >> i) & 1;
+    }
+  }
+}
+
+extern "C" void PIT_IRQHandler() {
+  disp.updateDisplays();
+  pit.clearInterruptFlag();
+}
+
+/*!
+ *  Varre por 1 s e confere a taxa de atualização e o ciclo de trabalho
+ *  (em milésimos) esperados de cada dígito.
+ */
+static bool scan(const char *name, dsf_ScanMode mode,
+                 const uint32_t dutyPerMille[4]) {
+  bool ok = true;
+
+  latchedAt = totalCycles = 0;
+  for (int i = 0; i < 4; i++) {
+    litCycles[i] = 0;
+    latches[i] = 0;
+  }
+  disp.setScanMode(mode);
+  pit.setFrequency(disp.scanFrequency(kRefreshHz));
+  pit.resetCounter();
+  pit.enableTimer();
+  mkl_HostSim::run(HOSTSIM_BUS_CLOCK);
+  pit.disableTimer();
+
+  printf("%-10s scan=%uHz", name, (unsigned)disp.scanFrequency(kRefreshHz));
+  for (int i = 3; i >= 0; i--) {
+    uint32_t duty = (uint32_t)((1000*litCycles[i] + totalCycles/2) /
+                               totalCycles);
+    printf(" d%d=%u/s %u.%u%%", i, (unsigned)latches[i], (unsigned)duty/10,
+           (unsigned)duty%10);
+    CHECK(ok, latches[i] >= kRefreshHz - 1 && latches[i] <= kRefreshHz + 1);
+    CHECK(ok, duty + 5 >= dutyPerMille[i] && duty <= dutyPerMille[i] + 5);
+  }
+  printf("\n");
+  return ok;
+}
+
+int main() {
+  static const uint32_t kOneDigit[4] = {250, 250, 250, 250};
+  static const uint32_t kOneDigitBlank[4] = {250, 0, 250, 250};
+  static const uint32_t kAllDigits[4] = {0, 0, 0, 1000};
+  bool ok = true;
+
+  mkl_HostSim::setPinObserver(observePins);
+  disp.writeWord(1234);
+  pit.enablePeripheralModule();
+  pit.enableInterruptRequests();
+  mkl_HostSim::enableIrq();
+
+  CHECK(ok, disp.scanFrequency(kRefreshHz) == kRefreshHz);
+  ok &= scan("all", dsf_scanAllDigits, kAllDigits);
+  ok &= scan("one", dsf_scanOneDigit, kOneDigit);
+  CHECK(ok, disp.scanFrequency(kRefreshHz) == 4*kRefreshHz);
+
+  // Brilho 0 apaga o quadro do dígito sem mudar a varredura.
+  disp.setDigitBrightness(1, 0);
+  ok &= scan("one blank1", dsf_scanOneDigit, kOneDigitBlank);
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,78 @@
+/*!
+ * @brief       Conversão sem divisão do writeWord, comparada com / e % por
+ *              10 em todos os valores de 0 a 9999.
+ *
+ * @file        test_writeWord.cpp
+ *
+ * @details     O transporte de captura guarda os quatro quadros enviados por
+ *              updateDisplays; cada dígito deve ter os segmentos do valor
+ *              calculado com as divisões da biblioteca.
+ *
+ *              Acima de 9999, writeWord mostra "----"; writeNibble mostra
+ *              '-' para um valor acima de 9 e ignora um display acima de 3.
+ */
+#include <string.h>
+#include <dsf_SerialDisplays.h>
+#include "hostsim_bench.h"
+
+/*!
+ *  Transporte que só guarda os quadros recebidos.
+ */
+class CaptureTransport : public dsf_DisplayTransport {
+ public:
+  uint8_t frames[8];
+
+  void sendFrames(const uint8_t *frames, uint8_t count) {
+    memcpy(this->frames, frames, 2*count);
+  }
+};
+
+int main() {
+  static const uint8_t kDigits[10] = {
+    0xC0, 0xF9, 0xA4, 0xB0, 0x99, 0x92, 0x82, 0xF8, 0x80, 0x90
+  };
+  static const uint8_t kDash = 0xBF;
+  CaptureTransport capture;
+  dsf_SerialDisplays disp(&capture);
+  uint32_t mismatches = 0;
+  bool ok = true;
+
+  for (uint32_t value = 0; value <= 9999; value++) {
+    uint32_t expected[4] = {value % 10, value / 10 % 10, value / 100 % 10,
+                            value / 1000};
+    disp.writeWord(value);
+    disp.updateDisplays();
+    for (int i = 0; i < 4; i++) {
+      if (capture.frames[2*i] != kDigits[expected[i]] ||
+          capture.frames[2*i + 1] != (1 << i)) {
+        if (mismatches++ < 10) {
+          printf("writeWord(%u): dígito %d = 0x%02X, esperado 0x%02X\n",
+                 (unsigned)value, i, capture.frames[2*i],
+                 kDigits[expected[i]]);
+        }
+      }
+    }
+  }
+  CHECK(ok, mismatches == 0);
+  printf("writeWord 0..9999: %u divergências\n", (unsigned)mismatches);
+
+  static const uint16_t kOutOfRange[3] = {10000, 10009, 65535};
+  for (int n = 0; n < 3; n++) {
+    disp.writeWord(kOutOfRange[n]);
+    disp.updateDisplays();
+    for (int i = 0; i < 4; i++) {
+      CHECK(ok, capture.frames[2*i] == kDash);
+    }
+  }
+
+  disp.writeWord(1234);
+  disp.writeNibble(12, 1);
+  disp.writeNibble(5, 4);
+  disp.writeNibble(5, 255);
+  disp.updateDisplays();
+  CHECK(ok, capture.frames[0] == kDigits[4]);
+  CHECK(ok, capture.frames[2] == kDash);
+  CHECK(ok, capture.frames[4] == kDigits[2]);
+  CHECK(ok, capture.frames[6] == kDigits[1]);
+  return ok ? 0 : 1;
+}